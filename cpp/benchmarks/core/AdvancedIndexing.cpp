@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/AdvancedIndexing.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Kernel.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr int64_t kNumRows = 1 << 20;
+static constexpr int64_t kNumCols = 3;
+
+/// Reference: element-wise advanced indexing, as used for all indexing before
+/// the row fast path.
+static Tensor IndexGetGeneric(const Tensor& src,
+                              const std::vector<Tensor>& index_tensors) {
+    AdvancedIndexPreprocessor aip(src, index_tensors);
+    Tensor dst(aip.GetOutputShape(), src.GetDtype(), src.GetDevice());
+    kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
+                     aip.GetIndexedShape(), aip.GetIndexedStrides());
+    return dst;
+}
+
+static Tensor RandomRowIndices(const Device& device) {
+    Tensor keys = Tensor::Arange(0, kNumRows, 1, core::Int64, device)
+                          .Mul(2654435761)
+                          .Add(12345);
+    // Pseudo-random permutation-like indices in [0, kNumRows).
+    Tensor indices = keys - keys.Div(kNumRows).Mul(kNumRows);
+    return indices.Contiguous();
+}
+
+static Tensor HalfMask(const Device& device) {
+    Tensor mask = Tensor::Zeros({kNumRows}, core::Bool, device);
+    mask.Slice(0, 0, kNumRows, 2).Fill(true);
+    return mask;
+}
+
+void IndexGetRows(benchmark::State& state, const Device& device, bool generic) {
+    Tensor src = Tensor::Ones({kNumRows, kNumCols}, core::Float32, device);
+    Tensor indices = RandomRowIndices(device);
+    Tensor warm_up = generic ? IndexGetGeneric(src, {indices})
+                             : src.IndexGet({indices});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = generic ? IndexGetGeneric(src, {indices})
+                             : src.IndexGet({indices});
+    }
+}
+
+void IndexSetRows(benchmark::State& state, const Device& device, bool generic) {
+    Tensor src = Tensor::Ones({kNumRows, kNumCols}, core::Float32, device);
+    Tensor dst = Tensor::Zeros({kNumRows, kNumCols}, core::Float32, device);
+    Tensor indices = RandomRowIndices(device);
+    auto index_set = [&]() {
+        if (generic) {
+            AdvancedIndexPreprocessor aip(dst, {indices});
+            Tensor pre_processed_dst = aip.GetTensor();
+            kernel::IndexSet(src, pre_processed_dst, aip.GetIndexTensors(),
+                             aip.GetIndexedShape(), aip.GetIndexedStrides());
+        } else {
+            dst.IndexSet({indices}, src);
+        }
+    };
+    index_set();
+    for (auto _ : state) {
+        index_set();
+    }
+}
+
+void IndexGetRowsByMask(benchmark::State& state,
+                        const Device& device,
+                        bool generic) {
+    Tensor src = Tensor::Ones({kNumRows, kNumCols}, core::Float32, device);
+    Tensor mask = HalfMask(device);
+    // The generic path expands the mask with NonZero before indexing.
+    Tensor warm_up =
+            generic ? IndexGetGeneric(src, {mask}) : src.IndexGet({mask});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = generic ? IndexGetGeneric(src, {mask})
+                             : src.IndexGet({mask});
+    }
+}
+
+BENCHMARK_CAPTURE(IndexGetRows, Generic_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRows, Rows_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexSetRows, Generic_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexSetRows, Rows_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRowsByMask, Generic_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRowsByMask, Fused_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(IndexGetRows, Generic_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRows, Rows_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexSetRows, Generic_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexSetRows, Rows_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRowsByMask, Generic_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IndexGetRowsByMask, Fused_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
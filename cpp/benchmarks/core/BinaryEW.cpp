@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/BinaryEW.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr int64_t kNumPoints = 1 << 22;
+
+/// Memory layouts of {N, 3} point tensors seen by element-wise ops.
+enum class PointsLayout {
+    /// {N, 3} op {N, 3}, both contiguous.
+    Contiguous,
+    /// {N, 3} op {3}, e.g. subtracting the center of a point cloud.
+    Broadcast,
+    /// The xyz columns of a contiguous {N, 4} tensor op {N, 3}.
+    Strided,
+};
+
+static Tensor MakePoints(const Device& device, PointsLayout layout) {
+    if (layout == PointsLayout::Strided) {
+        return Tensor::Ones({kNumPoints, 4}, core::Float32, device)
+                .Slice(1, 0, 3);
+    } else {
+        return Tensor::Ones({kNumPoints, 3}, core::Float32, device);
+    }
+}
+
+static Tensor MakeOperand(const Device& device, PointsLayout layout) {
+    if (layout == PointsLayout::Broadcast) {
+        return Tensor::Init<float>({1, 2, 3}, device);
+    } else {
+        return Tensor::Ones({kNumPoints, 3}, core::Float32, device);
+    }
+}
+
+void BinaryEWPoints(benchmark::State& state,
+                    const Device& device,
+                    PointsLayout layout) {
+    Tensor lhs = MakePoints(device, layout);
+    Tensor rhs = MakeOperand(device, layout);
+    Tensor warm_up = lhs.Sub(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Sub(rhs);
+    }
+}
+
+void BinaryEWPointsCompare(benchmark::State& state,
+                           const Device& device,
+                           PointsLayout layout) {
+    Tensor lhs = MakePoints(device, layout);
+    Tensor rhs = MakeOperand(device, layout);
+    Tensor warm_up = lhs.Gt(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Gt(rhs);
+    }
+}
+
+void BinaryEWPointsInplace(benchmark::State& state,
+                           const Device& device,
+                           PointsLayout layout) {
+    Tensor lhs = MakePoints(device, layout);
+    Tensor rhs = MakeOperand(device, layout);
+    lhs.Mul_(rhs);
+    for (auto _ : state) {
+        lhs.Mul_(rhs);
+    }
+}
+
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Contiguous_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Broadcast_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Broadcast)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Strided_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Strided)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPointsCompare,
+                  Contiguous_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPointsCompare,
+                  Broadcast_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Broadcast)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPointsInplace,
+                  Broadcast_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Broadcast)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPointsInplace,
+                  Strided_CPU,
+                  Device("CPU:0"),
+                  PointsLayout::Strided)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Contiguous_CUDA,
+                  Device("CUDA:0"),
+                  PointsLayout::Contiguous)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Broadcast_CUDA,
+                  Device("CUDA:0"),
+                  PointsLayout::Broadcast)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BinaryEWPoints,
+                  Strided_CUDA,
+                  Device("CUDA:0"),
+                  PointsLayout::Strided)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
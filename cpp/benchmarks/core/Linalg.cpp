@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/Batched.h"
+
+namespace open3d {
+namespace core {
+
+/// Number of matrices per batch, e.g. one per correspondence or per point.
+static constexpr int64_t kBatchSize = 1 << 14;
+
+/// Well conditioned {kBatchSize, n, n} matrices.
+static Tensor RandomMatrices(int64_t n, const Device& device) {
+    Tensor A = Tensor::Arange(0, kBatchSize * n * n, 1, core::Float32, device)
+                       .View({kBatchSize, n, n})
+                       .Sin();
+    return A + Tensor::Eye(n, core::Float32, device) * static_cast<float>(n);
+}
+
+void LinalgMatmul(benchmark::State& state,
+                  const Device& device,
+                  int64_t n,
+                  bool batched) {
+    Tensor A = RandomMatrices(n, device);
+    Tensor B = RandomMatrices(n, device).Slice(2, 0, 1).Contiguous();
+    auto matmul = [&]() {
+        if (batched) {
+            Tensor C;
+            BatchedMatmul(A, B, C);
+        } else {
+            for (int64_t i = 0; i < kBatchSize; ++i) {
+                Tensor C = A[i].Matmul(B[i]);
+            }
+        }
+    };
+    matmul();
+    for (auto _ : state) {
+        matmul();
+    }
+}
+
+void LinalgInverse(benchmark::State& state,
+                   const Device& device,
+                   int64_t n,
+                   bool batched) {
+    Tensor A = RandomMatrices(n, device);
+    auto inverse = [&]() {
+        if (batched) {
+            Tensor A_inv;
+            BatchedInverse(A, A_inv);
+        } else {
+            for (int64_t i = 0; i < kBatchSize; ++i) {
+                Tensor A_inv = A[i].Inverse();
+            }
+        }
+    };
+    inverse();
+    for (auto _ : state) {
+        inverse();
+    }
+}
+
+void LinalgSolve(benchmark::State& state,
+                 const Device& device,
+                 int64_t n,
+                 bool batched) {
+    Tensor A = RandomMatrices(n, device);
+    Tensor b = Tensor::Ones({kBatchSize, n}, core::Float32, device);
+    auto solve = [&]() {
+        if (batched) {
+            Tensor x;
+            BatchedSolve(A, b, x);
+        } else {
+            for (int64_t i = 0; i < kBatchSize; ++i) {
+                Tensor x = A[i].Solve(b[i]);
+            }
+        }
+    };
+    solve();
+    for (auto _ : state) {
+        solve();
+    }
+}
+
+void LinalgSVD(benchmark::State& state,
+               const Device& device,
+               int64_t n,
+               bool batched) {
+    Tensor A = RandomMatrices(n, device);
+    auto svd = [&]() {
+        if (batched) {
+            Tensor U, S, VT;
+            BatchedSVD(A, U, S, VT);
+        } else {
+            for (int64_t i = 0; i < kBatchSize; ++i) {
+                A[i].SVD();
+            }
+        }
+    };
+    svd();
+    for (auto _ : state) {
+        svd();
+    }
+}
+
+void LinalgEigh(benchmark::State& state, const Device& device, int64_t n) {
+    Tensor A = RandomMatrices(n, device);
+    A = A + A.Transpose(1, 2);
+    Tensor w, V;
+    BatchedEigh(A, w, V);
+    for (auto _ : state) {
+        BatchedEigh(A, w, V);
+    }
+}
+
+#define ENUM_BATCHED_LINALG_BENCHMARKS(DEVICE_NAME, DEVICE)                  \
+    BENCHMARK_CAPTURE(LinalgMatmul, Loop3x3_##DEVICE_NAME, DEVICE, 3, false) \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgMatmul, Batched3x3_##DEVICE_NAME, DEVICE, 3,     \
+                      true)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgMatmul, Batched6x6_##DEVICE_NAME, DEVICE, 6,     \
+                      true)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgInverse, Loop3x3_##DEVICE_NAME, DEVICE, 3,       \
+                      false)                                                 \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgInverse, Batched3x3_##DEVICE_NAME, DEVICE, 3,    \
+                      true)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgInverse, Batched6x6_##DEVICE_NAME, DEVICE, 6,    \
+                      true)                                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgSolve, Loop6x6_##DEVICE_NAME, DEVICE, 6, false)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgSolve, Batched6x6_##DEVICE_NAME, DEVICE, 6, true) \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgSVD, Loop3x3_##DEVICE_NAME, DEVICE, 3, false)    \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgSVD, Batched3x3_##DEVICE_NAME, DEVICE, 3, true)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgSVD, Batched6x6_##DEVICE_NAME, DEVICE, 6, true)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgEigh, Batched3x3_##DEVICE_NAME, DEVICE, 3)       \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(LinalgEigh, Batched6x6_##DEVICE_NAME, DEVICE, 6)       \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BATCHED_LINALG_BENCHMARKS(CPU, Device("CPU:0"))
+
+#ifdef BUILD_CUDA_MODULE
+ENUM_BATCHED_LINALG_BENCHMARKS(CUDA, Device("CUDA:0"))
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -47,12 +47,153 @@ void Reduction(benchmark::State& state, const Device& device) {
     }
 }
 
+/// Point cloud sized {N, 3} Float32 tensor, e.g. for GetCenter().
+static Tensor RandomPoints(const Device& device) {
+    const int64_t num_points = 1 << 24;
+    return Tensor::Arange(0, num_points * 3, 1, core::Float32, device)
+            .View({num_points, 3})
+            .Sqrt();
+}
+
+void ReductionFloat(benchmark::State& state,
+                    const Device& device,
+                    const SizeVector& dims) {
+    Tensor src = RandomPoints(device);
+    Tensor warm_up = src.Sum(dims);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum(dims);
+    }
+}
+
+void ReductionMinMax(benchmark::State& state,
+                     const Device& device,
+                     bool fused) {
+    Tensor src = RandomPoints(device);
+    auto min_max = [&]() {
+        if (fused) {
+            return src.MinMax({0});
+        } else {
+            return std::make_tuple(src.Min({0}), src.Max({0}));
+        }
+    };
+    min_max();
+    for (auto _ : state) {
+        min_max();
+    }
+}
+
+void ReductionMeanVar(benchmark::State& state,
+                      const Device& device,
+                      bool fused) {
+    Tensor src = RandomPoints(device);
+    auto mean_var = [&]() {
+        if (fused) {
+            return src.MeanVar({0});
+        } else {
+            Tensor mean = src.Mean({0});
+            Tensor diff = src - mean;
+            return std::make_tuple(mean, (diff * diff).Mean({0}));
+        }
+    };
+    mean_var();
+    for (auto _ : state) {
+        mean_var();
+    }
+}
+
+void ReductionMeanCov(benchmark::State& state,
+                      const Device& device,
+                      bool fused) {
+    Tensor src = RandomPoints(device);
+    auto mean_cov = [&]() {
+        if (fused) {
+            return src.MeanCov();
+        } else {
+            Tensor mean = src.Mean({0});
+            Tensor diff = src - mean;
+            return std::make_tuple(
+                    mean, diff.T().Matmul(diff).Div(
+                                  static_cast<double>(src.GetShape(0))));
+        }
+    };
+    mean_cov();
+    for (auto _ : state) {
+        mean_cov();
+    }
+}
+
+void ReductionStrided(benchmark::State& state, const Device& device) {
+    // The xyz columns of a {N, 4} tensor are not contiguous, so the sum goes
+    // through the generic Indexer-based reduction.
+    Tensor src = Tensor::Ones({1 << 24, 4}, core::Float32, device)
+                         .Slice(1, 0, 3);
+    Tensor warm_up = src.Sum({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0});
+    }
+}
+
+void ReductionArgMax(benchmark::State& state, const Device& device) {
+    Tensor src = RandomPoints(device);
+    Tensor warm_up = src.ArgMax({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.ArgMax({0});
+    }
+}
+
 BENCHMARK_CAPTURE(Reduction, CPU, Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionFloat, Rows_CPU, Device("CPU:0"), SizeVector{0})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionFloat, All_CPU, Device("CPU:0"), SizeVector{0, 1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMinMax, Separate_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMinMax, Fused_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVar, Separate_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVar, Fused_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanCov, Separate_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanCov, Fused_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ReductionStrided, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionArgMax, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
 
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionFloat, Rows_CUDA, Device("CUDA:0"), SizeVector{0})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionFloat,
+                  All_CUDA,
+                  Device("CUDA:0"),
+                  SizeVector{0, 1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMinMax, Separate_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMinMax, Fused_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVar, Separate_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVar, Fused_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanCov, Separate_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanCov, Fused_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionStrided, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionArgMax, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
 #endif
 
 }  // namespace core
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+
+namespace open3d {
+namespace core {
+
+static const int64_t kNumPoints = 1 << 22;
+
+/// {kNumPoints, 3} Float32 points, e.g. to average the points of every voxel.
+static Tensor SegmentPoints(const Device& device) {
+    return Tensor::Arange(0, kNumPoints * 3, 1, core::Float32, device)
+            .View({kNumPoints, 3})
+            .Sqrt();
+}
+
+/// Unsorted segment ids in [0, num_segments), e.g. voxel indices.
+static Tensor RandomSegmentIds(int64_t num_segments, const Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(0, num_segments - 1);
+    std::vector<int64_t> segment_ids(kNumPoints);
+    for (int64_t& segment_id : segment_ids) {
+        segment_id = dist(rng);
+    }
+    return Tensor(segment_ids, {kNumPoints}, core::Int64, device);
+}
+
+void SegmentReductionIds(benchmark::State& state,
+                         const Device& device,
+                         int64_t num_segments,
+                         kernel::SegmentReductionOpCode op_code) {
+    Tensor points = SegmentPoints(device);
+    Tensor segment_ids = RandomSegmentIds(num_segments, device);
+    Tensor warm_up = kernel::SegmentReduction(points, segment_ids,
+                                              num_segments, op_code);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = kernel::SegmentReduction(points, segment_ids,
+                                              num_segments, op_code);
+    }
+}
+
+void SegmentReductionRowSplits(benchmark::State& state,
+                               const Device& device,
+                               int64_t num_segments,
+                               kernel::SegmentReductionOpCode op_code) {
+    Tensor points = SegmentPoints(device);
+    Tensor row_splits = Tensor::Arange(0, num_segments + 1, 1, core::Int64,
+                                       device) *
+                        (kNumPoints / num_segments);
+    row_splits[num_segments] = kNumPoints;
+    Tensor warm_up =
+            kernel::SegmentReductionRowSplits(points, row_splits, op_code);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst =
+                kernel::SegmentReductionRowSplits(points, row_splits, op_code);
+    }
+}
+
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_4_CPU,
+                  Device("CPU:0"),
+                  4,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_1K_CPU,
+                  Device("CPU:0"),
+                  1 << 10,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_1M_CPU,
+                  Device("CPU:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  ArgMax_1M_CPU,
+                  Device("CPU:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::ArgMax)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_4_CPU,
+                  Device("CPU:0"),
+                  4,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_1K_CPU,
+                  Device("CPU:0"),
+                  1 << 10,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_1M_CPU,
+                  Device("CPU:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_4_CUDA,
+                  Device("CUDA:0"),
+                  4,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_1K_CUDA,
+                  Device("CUDA:0"),
+                  1 << 10,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  Mean_1M_CUDA,
+                  Device("CUDA:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionIds,
+                  ArgMax_1M_CUDA,
+                  Device("CUDA:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::ArgMax)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_4_CUDA,
+                  Device("CUDA:0"),
+                  4,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_1K_CUDA,
+                  Device("CUDA:0"),
+                  1 << 10,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReductionRowSplits,
+                  Mean_1M_CUDA,
+                  Device("CUDA:0"),
+                  1 << 20,
+                  kernel::SegmentReductionOpCode::Mean)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
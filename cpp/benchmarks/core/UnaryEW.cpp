@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/UnaryEW.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr int64_t kNumPoints = 1 << 22;
+
+/// The xyz columns of a {N, 4} tensor, e.g. homogeneous coordinates.
+static Tensor StridedPoints(const Device& device) {
+    return Tensor::Ones({kNumPoints, 4}, core::Float32, device).Slice(1, 0, 3);
+}
+
+void UnaryEWContiguousCopy(benchmark::State& state, const Device& device) {
+    Tensor src = StridedPoints(device);
+    Tensor warm_up = src.Contiguous();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Contiguous();
+    }
+}
+
+void UnaryEWCast(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({kNumPoints, 3}, core::Float32, device);
+    Tensor warm_up = src.To(core::Float64);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.To(core::Float64);
+    }
+}
+
+void UnaryEWSqrt(benchmark::State& state, const Device& device, bool strided) {
+    Tensor src = strided ? StridedPoints(device)
+                         : Tensor::Ones({kNumPoints, 3}, core::Float32, device);
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+    }
+}
+
+BENCHMARK_CAPTURE(UnaryEWContiguousCopy, Strided_CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWCast, Contiguous_CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrt, Contiguous_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrt, Strided_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(UnaryEWContiguousCopy, Strided_CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWCast, Contiguous_CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrt, Contiguous_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UnaryEWSqrt, Strided_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+class LinearOctreeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        auto trimesh = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        pcd = trimesh->SamplePointsUniformly(state.range(0), false, 0);
+        max_depth = static_cast<size_t>(state.range(1));
+        queries = trimesh->SamplePointsUniformly(1000, false, 1)->points_;
+        Eigen::Vector3d extent = pcd->GetMaxBound() - pcd->GetMinBound();
+        radius = extent.maxCoeff() / 100;
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd;
+    size_t max_depth;
+    std::vector<Eigen::Vector3d> queries;
+    double radius;
+};
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, BuildOctree)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(*pcd);
+    }
+}
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, BuildLinearOctree)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::LinearOctree octree(max_depth);
+        octree.ConvertFromPointCloud(*pcd);
+    }
+}
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, SearchKNNKDTreeFlann)
+(benchmark::State& state) {
+    geometry::KDTreeFlann kdtree(*pcd);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            kdtree.SearchKNN(query, 16, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, SearchKNNLinearOctree)
+(benchmark::State& state) {
+    geometry::LinearOctree octree(max_depth);
+    octree.ConvertFromPointCloud(*pcd);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            octree.SearchKNN(query, 16, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, SearchRadiusKDTreeFlann)
+(benchmark::State& state) {
+    geometry::KDTreeFlann kdtree(*pcd);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            kdtree.SearchRadius(query, radius, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(LinearOctreeFixture, SearchRadiusLinearOctree)
+(benchmark::State& state) {
+    geometry::LinearOctree octree(max_depth);
+    octree.ConvertFromPointCloud(*pcd);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (auto _ : state) {
+        for (const auto& query : queries) {
+            octree.SearchRadius(query, radius, indices, distance2);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(LinearOctreeFixture, BuildOctree)
+        ->Args({100000, 8})
+        ->Args({1000000, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LinearOctreeFixture, BuildLinearOctree)
+        ->Args({100000, 8})
+        ->Args({1000000, 10})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LinearOctreeFixture, SearchKNNKDTreeFlann)
+        ->Args({100000, 8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LinearOctreeFixture, SearchKNNLinearOctree)
+        ->Args({100000, 8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LinearOctreeFixture, SearchRadiusKDTreeFlann)
+        ->Args({100000, 8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LinearOctreeFixture, SearchRadiusLinearOctree)
+        ->Args({100000, 8})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
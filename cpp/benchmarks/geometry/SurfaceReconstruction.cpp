@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/utility/Tracing.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Records the stages of the reconstruction while the benchmark runs.
+static void StartStageTimings() {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Clear();
+    tracer.Enable();
+}
+
+// Reports the mean time of every traced geometry stage in milliseconds. Stages
+// are only traced in builds with BUILD_TRACING.
+static void ReportStageTimings(benchmark::State& state) {
+    utility::Tracer& tracer = utility::Tracer::GetInstance();
+    tracer.Disable();
+    for (const utility::TraceStatistics& stats : tracer.GetStatistics()) {
+        if (stats.category_ == "geometry") {
+            state.counters[stats.name_ + "Ms"] = stats.MeanMs();
+        }
+    }
+    tracer.Clear();
+}
+
+class SurfaceReconstructionFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        auto trimesh = io::CreateMeshFromFile(TEST_DATA_DIR "/knot.ply");
+        trimesh->ComputeVertexNormals();
+        pcd = trimesh->SamplePointsUniformly(state.range(0), false, 0);
+
+        std::vector<double> distances = pcd->ComputeNearestNeighborDistance();
+        double avg_distance =
+                std::accumulate(distances.begin(), distances.end(), 0.0) /
+                distances.size();
+        radii = {avg_distance, 2 * avg_distance};
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd;
+    std::vector<double> radii;
+};
+
+BENCHMARK_DEFINE_F(SurfaceReconstructionFixture, BallPivoting)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii);
+    }
+}
+
+BENCHMARK_DEFINE_F(SurfaceReconstructionFixture, BallPivotingParallel)
+(benchmark::State& state) {
+    StartStageTimings();
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+                *pcd, radii, static_cast<int>(state.range(1)));
+    }
+    ReportStageTimings(state);
+}
+
+BENCHMARK_DEFINE_F(SurfaceReconstructionFixture, Poisson)
+(benchmark::State& state) {
+    StartStageTimings();
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                *pcd, static_cast<size_t>(state.range(1)));
+    }
+    ReportStageTimings(state);
+}
+
+BENCHMARK_REGISTER_F(SurfaceReconstructionFixture, BallPivoting)
+        ->Args({10000})
+        ->Args({100000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SurfaceReconstructionFixture, BallPivotingParallel)
+        ->Args({10000, 1})
+        ->Args({10000, 4})
+        ->Args({10000, -1})
+        ->Args({100000, 1})
+        ->Args({100000, 4})
+        ->Args({100000, -1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SurfaceReconstructionFixture, Poisson)
+        ->Args({100000, 6})
+        ->Args({100000, 8})
+        ->Args({1000000, 8})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
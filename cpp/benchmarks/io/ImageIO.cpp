@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// One second of a 30 FPS RGB-D stream: 640x480 JPG color and 16-bit PNG depth
+// frames.
+static const int64_t kNumFrames = 30;
+
+static const std::vector<std::string> &GetFrameFilenames(
+        const std::string &extension) {
+    static std::unordered_map<std::string, std::vector<std::string>>
+            filenames;
+    std::vector<std::string> &frames = filenames[extension];
+    if (!frames.empty()) {
+        return frames;
+    }
+    utility::LogInfo("setup {} {} frames", kNumFrames, extension);
+    for (int64_t i = 0; i < kNumFrames; ++i) {
+        frames.push_back("testframe_" + std::to_string(i) + "." + extension);
+        // Smooth gradients with some per-frame variation, so that the files
+        // are not trivially compressible.
+        core::Tensor data;
+        if (extension == "png") {
+            data = (core::Tensor::Arange(0, 480 * 640, 1, core::Int64) * 7 +
+                    i * 13)
+                           .Reshape({480, 640, 1})
+                           .To(core::UInt16);
+        } else {
+            data = (core::Tensor::Arange(0, 480 * 640 * 3, 1, core::Int64) +
+                    i * 5)
+                           .Reshape({480, 640, 3})
+                           .To(core::UInt8);
+        }
+        if (!t::io::WriteImage(frames.back(), t::geometry::Image(data))) {
+            utility::LogError("Failed to write to {}", frames.back());
+        }
+    }
+    return frames;
+}
+
+static const std::vector<std::string> g_frame_extensions({"jpg", "png"});
+
+static void BM_ReadImageSequential(::benchmark::State &state) {
+    const std::vector<std::string> &filenames =
+            GetFrameFilenames(g_frame_extensions[state.range(0)]);
+    for (auto _ : state) {
+        for (const std::string &filename : filenames) {
+            t::geometry::Image image;
+            if (!t::io::ReadImage(filename, image)) {
+                utility::LogError("Failed to read from {}", filename);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumFrames);
+}
+
+static void BM_ReadImages(::benchmark::State &state) {
+    const std::vector<std::string> &filenames =
+            GetFrameFilenames(g_frame_extensions[state.range(0)]);
+    const int downscale = static_cast<int>(state.range(1));
+    core::Tensor images;
+    for (auto _ : state) {
+        if (!t::io::ReadImages(filenames, images, downscale)) {
+            utility::LogError("Failed to read {} images", filenames.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumFrames);
+}
+
+static void BM_WriteImages(::benchmark::State &state) {
+    const std::vector<std::string> &filenames =
+            GetFrameFilenames(g_frame_extensions[state.range(0)]);
+    core::Tensor images;
+    if (!t::io::ReadImages(filenames, images)) {
+        utility::LogError("Failed to read {} images", filenames.size());
+    }
+    std::vector<t::geometry::Image> frames;
+    for (int64_t i = 0; i < kNumFrames; ++i) {
+        frames.push_back(t::geometry::Image(images[i]));
+    }
+    std::vector<std::string> out_filenames;
+    for (const std::string &filename : filenames) {
+        out_filenames.push_back("out_" + filename);
+    }
+    for (auto _ : state) {
+        if (!t::io::WriteImages(out_filenames, frames)) {
+            utility::LogError("Failed to write {} images", frames.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumFrames);
+}
+
+BENCHMARK(BM_ReadImageSequential)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+// JPG frames are also decoded at 1/2 and 1/4 resolution, as used for image
+// pyramids.
+BENCHMARK(BM_ReadImages)
+        ->Args({0, 1})
+        ->Args({0, 2})
+        ->Args({0, 4})
+        ->Args({1, 1})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriteImages)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
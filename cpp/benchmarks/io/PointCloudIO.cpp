@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -118,6 +119,8 @@ public:
         }
     }
 
+    const geometry::PointCloud &GetPointCloud() const { return pc_; }
+
     void WriteRead(int pc_args_id) {
         const auto &args = g_pc_args[pc_args_id];
         const auto &pc = pc_;
@@ -177,5 +180,111 @@ static void BM_TestPCGrid0_Args(benchmark::internal::Benchmark *b) {
 
 BENCHMARK(BM_TestPCGrid0)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
 
+// ASCII formats, read back by the legacy and the tensor readers.
+const std::vector<std::string> g_ascii_filenames(
+        {"testread.xyz", "testread.xyzn", "testread.xyzrgb", "testread.pts"});
+
+static void WriteASCIIPointCloud(const std::string &filename, int size) {
+    test_pc_grid0.Setup(size);
+    if (!WritePointCloud(filename, test_pc_grid0.GetPointCloud(),
+                         {true, false, false})) {
+        utility::LogError("Failed to write to {}", filename);
+    }
+}
+
+static void BM_ReadASCIIPointCloud(::benchmark::State &state) {
+    const std::string &filename = g_ascii_filenames[state.range(0)];
+    WriteASCIIPointCloud(filename, state.range(1));
+    for (auto _ : state) {
+        geometry::PointCloud pc;
+        if (!ReadPointCloud(filename, pc, {"auto", false, false, false})) {
+            utility::LogError("Failed to read from {}", filename);
+        }
+    }
+}
+
+static void BM_ReadASCIITensorPointCloud(::benchmark::State &state) {
+    const std::string &filename = g_ascii_filenames[state.range(0)];
+    WriteASCIIPointCloud(filename, state.range(1));
+    for (auto _ : state) {
+        t::geometry::PointCloud pc;
+        if (!t::io::ReadPointCloud(filename, pc,
+                                   {"auto", false, false, false})) {
+            utility::LogError("Failed to read from {}", filename);
+        }
+    }
+}
+
+static void BM_ReadASCIIPointCloud_Args(benchmark::internal::Benchmark *b) {
+    for (int j = 64 * 1024; j <= 1024 * 1024; j *= 4) {
+        for (int i = 0; i < int(g_ascii_filenames.size()); ++i) {
+            b->Args({i, j});
+        }
+    }
+}
+
+BENCHMARK(BM_ReadASCIIPointCloud)
+        ->Apply(BM_ReadASCIIPointCloud_Args)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadASCIITensorPointCloud)
+        ->Apply(BM_ReadASCIIPointCloud_Args)
+        ->Unit(benchmark::kMillisecond);
+
+// Binary PLY files with Float32 points and normals and UInt8 colors, written
+// and read by the tensor API.
+static const t::geometry::PointCloud &GetTensorPointCloud(int64_t size) {
+    static t::geometry::PointCloud pcd;
+    if (!pcd.HasPoints() || pcd.GetPoints().GetLength() != size) {
+        utility::LogInfo("setup tensor point cloud size={}", size);
+        pcd.SetPoints(core::Tensor::Arange(0, size * 3, 1, core::Float32)
+                              .Reshape({size, 3}));
+        pcd.SetPointNormals(
+                core::Tensor::Arange(0, size * 3, 1, core::Float32)
+                        .Reshape({size, 3}) /
+                (size * 3));
+        pcd.SetPointColors(core::Tensor::Arange(0, size * 3, 1, core::Int64)
+                                   .Reshape({size, 3})
+                                   .To(core::UInt8));
+    }
+    return pcd;
+}
+
+static void BM_WriteBinaryPLYTensorPointCloud(::benchmark::State &state) {
+    const std::string filename = "testbt.ply";
+    const t::geometry::PointCloud &pcd = GetTensorPointCloud(state.range(0));
+    for (auto _ : state) {
+        if (!t::io::WritePointCloud(filename, pcd, {false, false, false})) {
+            utility::LogError("Failed to write to {}", filename);
+        }
+    }
+}
+
+static void BM_ReadBinaryPLYTensorPointCloud(::benchmark::State &state) {
+    const std::string filename = "testbt.ply";
+    if (!t::io::WritePointCloud(filename, GetTensorPointCloud(state.range(0)),
+                                {false, false, false})) {
+        utility::LogError("Failed to write to {}", filename);
+    }
+    for (auto _ : state) {
+        t::geometry::PointCloud pcd;
+        if (!t::io::ReadPointCloud(filename, pcd,
+                                   {"auto", false, false, false})) {
+            utility::LogError("Failed to read from {}", filename);
+        }
+    }
+}
+
+// The largest file is about 2.7GB.
+BENCHMARK(BM_WriteBinaryPLYTensorPointCloud)
+        ->Arg(1000000)
+        ->Arg(10000000)
+        ->Arg(100000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadBinaryPLYTensorPointCloud)
+        ->Arg(1000000)
+        ->Arg(10000000)
+        ->Arg(100000000)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
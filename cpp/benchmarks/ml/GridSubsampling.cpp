@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/contrib/GridSubsampling.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+namespace ml {
+
+namespace {
+
+using contrib::PointXYZ;
+
+// The per-cell hash map implementation that grid_subsampling replaced, kept as
+// a baseline.
+namespace reference {
+
+struct SampledData {
+    SampledData(size_t fdim, size_t ldim)
+        : point(0, 0, 0), features(fdim), labels(ldim) {}
+
+    int count = 0;
+    PointXYZ point;
+    std::vector<float> features;
+    std::vector<std::unordered_map<int, int>> labels;
+};
+
+void GridSubsampling(const std::vector<PointXYZ>& original_points,
+                     std::vector<PointXYZ>& subsampled_points,
+                     const std::vector<float>& original_features,
+                     std::vector<float>& subsampled_features,
+                     const std::vector<int>& original_classes,
+                     std::vector<int>& subsampled_classes,
+                     float sampleDl) {
+    size_t N = original_points.size();
+    size_t fdim = original_features.size() / N;
+    size_t ldim = original_classes.size() / N;
+
+    PointXYZ minCorner = contrib::min_point(original_points);
+    PointXYZ maxCorner = contrib::max_point(original_points);
+    PointXYZ originCorner =
+            PointXYZ::floor(minCorner * (1 / sampleDl)) * sampleDl;
+    size_t sampleNX =
+            (size_t)floor((maxCorner.x - originCorner.x) / sampleDl) + 1;
+    size_t sampleNY =
+            (size_t)floor((maxCorner.y - originCorner.y) / sampleDl) + 1;
+
+    std::unordered_map<size_t, SampledData> data;
+    for (size_t i = 0; i < N; ++i) {
+        const PointXYZ& p = original_points[i];
+        size_t iX = (size_t)std::floor((p.x - originCorner.x) / sampleDl);
+        size_t iY = (size_t)std::floor((p.y - originCorner.y) / sampleDl);
+        size_t iZ = (size_t)std::floor((p.z - originCorner.z) / sampleDl);
+        size_t mapIdx = iX + sampleNX * iY + sampleNX * sampleNY * iZ;
+
+        SampledData& cell =
+                data.emplace(mapIdx, SampledData(fdim, ldim)).first->second;
+        cell.count += 1;
+        cell.point += p;
+        for (size_t k = 0; k < fdim; ++k) {
+            cell.features[k] += original_features[i * fdim + k];
+        }
+        for (size_t k = 0; k < ldim; ++k) {
+            cell.labels[k][original_classes[i * ldim + k]] += 1;
+        }
+    }
+
+    for (auto& v : data) {
+        subsampled_points.push_back(v.second.point * (1.0f / v.second.count));
+        for (float f : v.second.features) {
+            subsampled_features.push_back(f / v.second.count);
+        }
+        for (const auto& labels : v.second.labels) {
+            subsampled_classes.push_back(
+                    std::max_element(labels.begin(), labels.end(),
+                                     [](const std::pair<int, int>& a,
+                                        const std::pair<int, int>& b) {
+                                         return a.second < b.second;
+                                     })
+                            ->first);
+        }
+    }
+}
+
+void BatchGridSubsampling(const std::vector<PointXYZ>& original_points,
+                          std::vector<PointXYZ>& subsampled_points,
+                          const std::vector<float>& original_features,
+                          std::vector<float>& subsampled_features,
+                          const std::vector<int>& original_classes,
+                          std::vector<int>& subsampled_classes,
+                          const std::vector<int>& original_batches,
+                          std::vector<int>& subsampled_batches,
+                          float sampleDl) {
+    size_t N = original_points.size();
+    size_t fdim = original_features.size() / N;
+    size_t ldim = original_classes.size() / N;
+    size_t sum_b = 0;
+    for (int n : original_batches) {
+        std::vector<PointXYZ> b_points(
+                original_points.begin() + sum_b,
+                original_points.begin() + sum_b + n);
+        std::vector<float> b_features(
+                original_features.begin() + sum_b * fdim,
+                original_features.begin() + (sum_b + n) * fdim);
+        std::vector<int> b_classes(
+                original_classes.begin() + sum_b * ldim,
+                original_classes.begin() + (sum_b + n) * ldim);
+        std::vector<PointXYZ> b_s_points;
+        GridSubsampling(b_points, b_s_points, b_features, subsampled_features,
+                        b_classes, subsampled_classes, sampleDl);
+        subsampled_points.insert(subsampled_points.end(), b_s_points.begin(),
+                                 b_s_points.end());
+        subsampled_batches.push_back(static_cast<int>(b_s_points.size()));
+        sum_b += n;
+    }
+}
+
+}  // namespace reference
+
+struct SubsamplingInput {
+    SubsamplingInput(int64_t num_batches, int64_t points_per_batch) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> dist(0.f, 10.f);
+        std::uniform_int_distribution<int> class_dist(0, 19);
+        const int64_t num_points = num_batches * points_per_batch;
+        for (int64_t i = 0; i < num_points; ++i) {
+            points.emplace_back(dist(rng), dist(rng), dist(rng));
+        }
+        features.resize(num_points * kChannels);
+        for (float& f : features) {
+            f = dist(rng);
+        }
+        classes.resize(num_points);
+        for (int& c : classes) {
+            c = class_dist(rng);
+        }
+        batches.assign(num_batches, static_cast<int>(points_per_batch));
+    }
+
+    static const int kChannels = 8;
+    std::vector<PointXYZ> points;
+    std::vector<float> features;
+    std::vector<int> classes;
+    std::vector<int> batches;
+};
+
+}  // namespace
+
+// Batches of points in a 10m cube with 8 feature channels and one label
+// channel. The arguments are the number of batches, the points per batch and
+// the cell size in cm.
+static void BatchGridSubsampling(benchmark::State& state, bool use_reference) {
+    SubsamplingInput input(state.range(0), state.range(1));
+    const float sampleDl = state.range(2) / 100.f;
+    for (auto _ : state) {
+        std::vector<PointXYZ> points;
+        std::vector<float> features;
+        std::vector<int> classes;
+        std::vector<int> batches;
+        if (use_reference) {
+            reference::BatchGridSubsampling(
+                    input.points, points, input.features, features,
+                    input.classes, classes, input.batches, batches, sampleDl);
+        } else {
+            contrib::batch_grid_subsampling(
+                    input.points, points, input.features, features,
+                    input.classes, classes, input.batches, batches, sampleDl,
+                    0);
+        }
+        benchmark::DoNotOptimize(points.data());
+    }
+}
+
+static void BatchGridSubsamplingArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_batches : {1, 8}) {
+        for (int64_t points_per_batch : {100000, 1000000}) {
+            for (int64_t cell_size_cm : {5, 50}) {
+                b->Args({num_batches, points_per_batch, cell_size_cm});
+            }
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BatchGridSubsampling, Reference, true)
+        ->Apply(BatchGridSubsamplingArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BatchGridSubsampling, Parallel, false)
+        ->Apply(BatchGridSubsamplingArgs)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace ml
+}  // namespace open3d
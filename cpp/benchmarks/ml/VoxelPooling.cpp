@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/misc/VoxelPooling.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace open3d {
+namespace ml {
+
+namespace {
+
+struct VoxelPoolingOutputAllocator {
+    void AllocPooledPositions(float** ptr, size_t num) {
+        positions.resize(num * 3);
+        *ptr = positions.data();
+    }
+    void AllocPooledFeatures(float** ptr, size_t num, int channels) {
+        features.resize(num * channels);
+        *ptr = features.data();
+    }
+
+    std::vector<float> positions;
+    std::vector<float> features;
+};
+
+struct PoolingInput {
+    explicit PoolingInput(int64_t num_points) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> dist(0.f, 10.f);
+        positions.resize(num_points * 3);
+        for (float& p : positions) {
+            p = dist(rng);
+        }
+        features.resize(num_points * kChannels);
+        for (float& f : features) {
+            f = dist(rng);
+        }
+    }
+
+    static const int kChannels = 8;
+    std::vector<float> positions;
+    std::vector<float> features;
+};
+
+}  // namespace
+
+// Points in a 10m cube with 8 feature channels. The second argument is the
+// voxel size in cm, which sets the number of points per voxel.
+static void VoxelPooling(benchmark::State& state,
+                         impl::AccumulationFn position_fn,
+                         impl::AccumulationFn feature_fn) {
+    const int64_t num_points = state.range(0);
+    const float voxel_size = state.range(1) / 100.f;
+    PoolingInput input(num_points);
+    for (auto _ : state) {
+        VoxelPoolingOutputAllocator output;
+        impl::VoxelPooling<float, float>(
+                num_points, input.positions.data(), PoolingInput::kChannels,
+                input.features.data(), voxel_size, output, position_fn,
+                feature_fn);
+    }
+}
+
+static void VoxelPoolingBackprop(benchmark::State& state,
+                                 impl::AccumulationFn position_fn,
+                                 impl::AccumulationFn feature_fn) {
+    const int64_t num_points = state.range(0);
+    const float voxel_size = state.range(1) / 100.f;
+    PoolingInput input(num_points);
+    VoxelPoolingOutputAllocator output;
+    impl::VoxelPooling<float, float>(
+            num_points, input.positions.data(), PoolingInput::kChannels,
+            input.features.data(), voxel_size, output, position_fn,
+            feature_fn);
+    const size_t num_pooled = output.positions.size() / 3;
+    std::vector<float> backprop(input.features.size());
+    for (auto _ : state) {
+        impl::VoxelPoolingBackprop<float, float>(
+                backprop.data(), num_points, input.positions.data(),
+                PoolingInput::kChannels, input.features.data(), num_pooled,
+                output.positions.data(), output.features.data(), voxel_size,
+                position_fn, feature_fn);
+    }
+}
+
+static void VoxelPoolingArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points : {100000, 1000000, 10000000}) {
+        for (int64_t voxel_size_cm : {2, 10, 50}) {
+            b->Args({num_points, voxel_size_cm});
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(VoxelPooling, AverageAverage, impl::AVERAGE, impl::AVERAGE)
+        ->Apply(VoxelPoolingArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(VoxelPooling, CenterMax, impl::CENTER, impl::MAX)
+        ->Apply(VoxelPoolingArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(VoxelPoolingBackprop,
+                  AverageAverage,
+                  impl::AVERAGE,
+                  impl::AVERAGE)
+        ->Apply(VoxelPoolingArgs)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(VoxelPoolingBackprop, CenterMax, impl::CENTER, impl::MAX)
+        ->Apply(VoxelPoolingArgs)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace ml
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/misc/Voxelize.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace open3d {
+namespace ml {
+
+namespace {
+
+struct VoxelizeOutputAllocator {
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        voxel_coords.resize(rows * cols);
+        *ptr = voxel_coords.data();
+    }
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t size) {
+        point_indices.resize(size);
+        *ptr = point_indices.data();
+    }
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t size) {
+        row_splits.resize(size);
+        *ptr = row_splits.data();
+    }
+
+    std::vector<int32_t> voxel_coords;
+    std::vector<int64_t> point_indices;
+    std::vector<int64_t> row_splits;
+};
+
+}  // namespace
+
+// Uniformly distributed points in a 100m cube, voxelized with 0.5m voxels as
+// for the point-pillar style networks.
+static void VoxelizeCPU(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.f, 100.f);
+    std::vector<float> points(num_points * 3);
+    for (float& p : points) {
+        p = dist(rng);
+    }
+    const float voxel_size[] = {0.5f, 0.5f, 0.5f};
+    const float range_min[] = {0.f, 0.f, 0.f};
+    const float range_max[] = {100.f, 100.f, 100.f};
+
+    for (auto _ : state) {
+        VoxelizeOutputAllocator output;
+        impl::VoxelizeCPU<float, 3>(num_points, points.data(), voxel_size,
+                                    range_min, range_max, 32, 1 << 30, output);
+    }
+}
+
+BENCHMARK(VoxelizeCPU)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Arg(10000000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace ml
+}  // namespace open3d
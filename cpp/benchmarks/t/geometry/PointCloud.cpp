@@ -120,6 +120,123 @@ void Transform(benchmark::State& state, const core::Device& device) {
     }
 }
 
+// Accumulates many small scans into one cloud. Append (operator+) copies the
+// whole accumulated cloud on every call, while Extend writes into reserved
+// capacity that grows geometrically, giving amortized linear cost.
+static const int64_t num_sweeps = 100;
+static const int64_t num_points_per_sweep = 10000;
+
+static PointCloud MakeSweep(const core::Device& device) {
+    PointCloud sweep(device);
+    sweep.SetPoints(core::Tensor::Ones({num_points_per_sweep, 3},
+                                       core::Float32, device));
+    sweep.SetPointColors(core::Tensor::Ones({num_points_per_sweep, 3},
+                                            core::Float32, device));
+    return sweep;
+}
+
+void AppendRepeated(benchmark::State& state, const core::Device& device) {
+    PointCloud sweep = MakeSweep(device);
+    for (auto _ : state) {
+        PointCloud pcd = sweep.Clone();
+        for (int64_t i = 1; i < num_sweeps; ++i) {
+            pcd = pcd + sweep;
+        }
+    }
+}
+
+void ExtendRepeated(benchmark::State& state, const core::Device& device) {
+    PointCloud sweep = MakeSweep(device);
+    for (auto _ : state) {
+        PointCloud pcd = sweep.Clone();
+        for (int64_t i = 1; i < num_sweeps; ++i) {
+            pcd.Extend(sweep);
+        }
+    }
+}
+
+void LegacyRemoveRadiusOutliers(benchmark::State& state) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->RemoveRadiusOutliers(16, 0.05);
+    }
+}
+
+void RemoveRadiusOutliers(benchmark::State& state,
+                          const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.RemoveRadiusOutliers(16, 0.05);
+
+    for (auto _ : state) {
+        pcd.RemoveRadiusOutliers(16, 0.05);
+    }
+}
+
+void LegacyRemoveStatisticalOutliers(benchmark::State& state) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->RemoveStatisticalOutliers(20, 2.0);
+    }
+}
+
+void RemoveStatisticalOutliers(benchmark::State& state,
+                               const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.RemoveStatisticalOutliers(20, 2.0);
+
+    for (auto _ : state) {
+        pcd.RemoveStatisticalOutliers(20, 2.0);
+    }
+}
+
+void LegacyClusterDBSCAN(benchmark::State& state) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->ClusterDBSCAN(0.02, 10);
+    }
+}
+
+void ClusterDBSCAN(benchmark::State& state, const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.ClusterDBSCAN(0.02, 10);
+
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(0.02, 10);
+    }
+}
+
+void LegacySegmentPlane(benchmark::State& state) {
+    auto pcd = open3d::io::CreatePointCloudFromFile(path);
+    for (auto _ : state) {
+        pcd->SegmentPlane(0.01, 3, 1000);
+    }
+}
+
+void SegmentPlane(benchmark::State& state, const core::Device& device) {
+    PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    pcd = pcd.To(device);
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, 1000);
+
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, 1000);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -172,6 +289,40 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_BACKEND()
 
+BENCHMARK(LegacyRemoveRadiusOutliers)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RemoveRadiusOutliers, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(LegacyRemoveStatisticalOutliers)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RemoveRadiusOutliers, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef WITH_FAISS
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+#endif
+
+BENCHMARK(LegacyClusterDBSCAN)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ClusterDBSCAN, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK(LegacySegmentPlane)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentPlane, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SegmentPlane, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 BENCHMARK_CAPTURE(Transform, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -180,6 +331,17 @@ BENCHMARK_CAPTURE(Transform, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+BENCHMARK_CAPTURE(AppendRepeated, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtendRepeated, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(AppendRepeated, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ExtendRepeated, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -163,6 +163,69 @@ static void RGBDOdometryMultiScale(
     }
 }
 
+static void RGBDOdometrySequence(benchmark::State& state,
+                                 const core::Device& device,
+                                 bool use_context) {
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    std::vector<t::geometry::RGBDImage> frames;
+    for (const std::string index :
+         {"00000", "00001", "00002", "00003", "00004"}) {
+        t::geometry::RGBDImage frame;
+        frame.depth_ = t::io::CreateImageFromFile(std::string(TEST_DATA_DIR) +
+                                                  "/RGBD/depth/" + index +
+                                                  ".png")
+                               ->To(device);
+        frame.color_ = t::io::CreateImageFromFile(std::string(TEST_DATA_DIR) +
+                                                  "/RGBD/color/" + index +
+                                                  ".jpg")
+                               ->To(device);
+        frames.push_back(frame);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor identity =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    t::pipelines::odometry::OdometryLossParams loss(depth_diff);
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> criteria{
+            10, 5, 3};
+    const auto method = t::pipelines::odometry::Method::Hybrid;
+
+    // Frame-to-frame tracking over the whole sequence, either rebuilding both
+    // pyramids for every pair or reusing the previous target as the source.
+    auto track_sequence = [&]() {
+        if (use_context) {
+            t::pipelines::odometry::RGBDOdometryContext context(
+                    intrinsic_t, depth_scale, depth_max, criteria, method,
+                    loss);
+            context.SetSource(frames[0]);
+            for (size_t i = 1; i < frames.size(); ++i) {
+                context.Compute(frames[i], identity);
+            }
+        } else {
+            for (size_t i = 1; i < frames.size(); ++i) {
+                RGBDOdometryMultiScale(frames[i - 1], frames[i], intrinsic_t,
+                                       identity, depth_scale, depth_max,
+                                       criteria, method, loss);
+            }
+        }
+    };
+
+    // Warm up
+    track_sequence();
+
+    for (auto _ : state) {
+        track_sequence();
+    }
+}
+
 BENCHMARK_CAPTURE(ComputeOdometryResultPointToPlane, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 #ifdef BUILD_CUDA_MODULE
@@ -205,6 +268,30 @@ BENCHMARK_CAPTURE(RGBDOdometryMultiScale,
                   t::pipelines::odometry::Method::PointToPlane)
         ->Unit(benchmark::kMillisecond);
 #endif
+
+BENCHMARK_CAPTURE(RGBDOdometrySequence,
+                  Stateless_CPU,
+                  core::Device("CPU:0"),
+                  false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RGBDOdometrySequence,
+                  Context_CPU,
+                  core::Device("CPU:0"),
+                  true)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RGBDOdometrySequence,
+                  Stateless_CUDA,
+                  core::Device("CUDA:0"),
+                  false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RGBDOdometrySequence,
+                  Context_CUDA,
+                  core::Device("CUDA:0"),
+                  true)
+        ->Unit(benchmark::kMillisecond);
+#endif
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace t
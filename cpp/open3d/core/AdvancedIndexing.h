@@ -183,25 +183,45 @@ public:
     }
 
     inline OPEN3D_HOST_DEVICE char* GetInputPtr(int64_t workload_idx) const {
-        char* ptr = indexer_.GetInputPtr(0, workload_idx);
-        ptr += GetIndexedOffset(workload_idx) * element_byte_size_ *
+        return GetInputPtr<DYNAMIC_DIMS>(workload_idx);
+    }
+
+    inline OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
+        return GetOutputPtr<DYNAMIC_DIMS>(workload_idx);
+    }
+
+    inline OPEN3D_HOST_DEVICE int64_t
+    GetIndexedOffset(int64_t workload_idx) const {
+        return GetIndexedOffset<DYNAMIC_DIMS>(workload_idx);
+    }
+
+    /// Same as GetInputPtr(), with the number of dimensions known at compile
+    /// time. \p NDIMS must be NumDims() or DYNAMIC_DIMS.
+    template <int64_t NDIMS>
+    inline OPEN3D_HOST_DEVICE char* GetInputPtr(int64_t workload_idx) const {
+        char* ptr = indexer_.GetInputPtr<NDIMS>(0, workload_idx);
+        ptr += GetIndexedOffset<NDIMS>(workload_idx) * element_byte_size_ *
                (mode_ == AdvancedIndexerMode::GET);
         return ptr;
     }
 
+    /// Same as GetOutputPtr(), with the number of dimensions known at compile
+    /// time. \p NDIMS must be NumDims() or DYNAMIC_DIMS.
+    template <int64_t NDIMS>
     inline OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
-        char* ptr = indexer_.GetOutputPtr(workload_idx);
-        ptr += GetIndexedOffset(workload_idx) * element_byte_size_ *
+        char* ptr = indexer_.GetOutputPtr<NDIMS>(workload_idx);
+        ptr += GetIndexedOffset<NDIMS>(workload_idx) * element_byte_size_ *
                (mode_ == AdvancedIndexerMode::SET);
         return ptr;
     }
 
+    template <int64_t NDIMS>
     inline OPEN3D_HOST_DEVICE int64_t
     GetIndexedOffset(int64_t workload_idx) const {
         int64_t offset = 0;
         for (int64_t i = 0; i < num_indices_; ++i) {
             int64_t index = *(reinterpret_cast<int64_t*>(
-                    indexer_.GetInputPtr(i + 1, workload_idx)));
+                    indexer_.GetInputPtr<NDIMS>(i + 1, workload_idx)));
             OPEN3D_ASSERT(index >= -indexed_shape_[i] &&
                           index < indexed_shape_[i] && "Index out of bounds.");
             index += indexed_shape_[i] * (index < 0);
@@ -212,6 +232,8 @@ public:
 
     int64_t NumWorkloads() const { return indexer_.NumWorkloads(); }
 
+    int64_t NumDims() const { return indexer_.NumDims(); }
+
 protected:
     Indexer indexer_;
     AdvancedIndexerMode mode_;
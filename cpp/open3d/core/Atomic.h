@@ -32,6 +32,7 @@
 #include <intrin.h>
 #pragma intrinsic(_InterlockedExchangeAdd)
 #pragma intrinsic(_InterlockedExchangeAdd64)
+#pragma intrinsic(_InterlockedCompareExchange)
 #endif
 
 namespace open3d {
@@ -57,5 +58,22 @@ inline uint64_t AtomicFetchAddRelaxed(uint64_t* address, uint64_t val) {
 #endif
 }
 
+/// Stores \p desired at \p address if it holds \p expected. Returns the value
+/// held at \p address before the operation, like CUDA's atomicCAS.
+inline int32_t AtomicCompareExchange(int32_t* address,
+                                     int32_t expected,
+                                     int32_t desired) {
+#ifdef __GNUC__
+    __atomic_compare_exchange_n(address, &expected, desired, false,
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return expected;
+#elif _MSC_VER
+    return _InterlockedCompareExchange(reinterpret_cast<long*>(address),
+                                       desired, expected);
+#else
+    static_assert(false, "AtomicCompareExchange not implemented for platform");
+#endif
+}
+
 }  // namespace core
 }  // namespace open3d
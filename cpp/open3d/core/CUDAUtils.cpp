@@ -28,6 +28,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 #ifdef BUILD_CUDA_MODULE
 #include "open3d/core/MemoryManager.h"
@@ -111,6 +112,21 @@ static void SetStream(cudaStream_t stream) {
 
 cudaStream_t GetDefaultStream() { return CUDAStream::Default(); }
 
+// Trace scopes on CUDA devices wait for the current stream, so that they time
+// the asynchronously launched kernels instead of the launches.
+static struct TraceSynchronizerRegistration {
+    TraceSynchronizerRegistration() {
+        utility::Tracer::GetInstance().SetDeviceSynchronizer(
+                [](const std::string& device_str) {
+                    const Device device(device_str);
+                    if (device.GetType() == Device::DeviceType::CUDA) {
+                        CUDAScopedDevice scoped_device(device);
+                        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(GetStream()));
+                    }
+                });
+    }
+} s_trace_synchronizer_registration;
+
 #endif
 
 }  // namespace cuda
@@ -189,6 +189,30 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
     UpdateMasterStrides();
 }
 
+bool Indexer::IsContiguous() const {
+    auto is_contiguous = [this](const TensorRef& tr) -> bool {
+        for (int64_t dim = 0; dim < ndims_; ++dim) {
+            if (master_shape_[dim] > 1 &&
+                tr.byte_strides_[dim] !=
+                        master_strides_[dim] * tr.dtype_byte_size_) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (int64_t i = 0; i < num_inputs_; ++i) {
+        if (!is_contiguous(inputs_[i])) {
+            return false;
+        }
+    }
+    for (int64_t i = 0; i < num_outputs_; ++i) {
+        if (!is_contiguous(outputs_[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool Indexer::CanUse32BitIndexing() const {
     // 2^31 - 1 = 2147483647
     int64_t max_value = std::numeric_limits<int32_t>::max();
@@ -53,6 +53,41 @@ static constexpr int64_t MAX_INPUTS = 10;
 // necessary.
 static constexpr int64_t MAX_OUTPUTS = 2;
 
+// Number of dimensions passed to the Indexer's compile-time specialized
+// accessors when the number of dimensions is only known at run time.
+static constexpr int64_t DYNAMIC_DIMS = -1;
+
+/// Call a function templated on the number of dimensions of an Indexer. The
+/// low-dimensional cases seen by {N, 3} and image tensors get a compile-time
+/// constant, so that the offset computation is fully unrolled. Other cases
+/// fall back to DYNAMIC_DIMS.
+///
+///     DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+///         func<kNDims>(indexer);
+///     });
+#define DISPATCH_NDIMS_TO_TEMPLATE(NDIMS, ...)                       \
+    [&] {                                                            \
+        switch (NDIMS) {                                             \
+            case 1: {                                                \
+                static constexpr int64_t kNDims = 1;                 \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 2: {                                                \
+                static constexpr int64_t kNDims = 2;                 \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 3: {                                                \
+                static constexpr int64_t kNDims = 3;                 \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            default: {                                               \
+                static constexpr int64_t kNDims =                    \
+                        open3d::core::DYNAMIC_DIMS;                  \
+                return __VA_ARGS__();                                \
+            }                                                        \
+        }                                                            \
+    }()
+
 // Fixed-size array type usable from host and device.
 template <typename T, int size>
 struct alignas(16) SmallArray {
@@ -386,6 +421,12 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if every input and output is laid out contiguously in the
+    /// order of the Indexer's master shape, i.e. the data of workload i is the
+    /// i-th element of each operand. This is false for broadcasted inputs and
+    /// for reduction outputs.
+    bool IsContiguous() const;
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
@@ -419,6 +460,29 @@ public:
         return GetWorkloadDataPtr(outputs_[output_idx], workload_idx);
     }
 
+    /// Same as GetInputPtr(), with the number of dimensions known at compile
+    /// time. \p NDIMS must be NumDims() or DYNAMIC_DIMS.
+    template <int64_t NDIMS>
+    OPEN3D_HOST_DEVICE char* GetInputPtr(int64_t input_idx,
+                                         int64_t workload_idx) const {
+        if (input_idx < 0 || input_idx >= num_inputs_) {
+            return nullptr;
+        }
+        return GetWorkloadDataPtr<NDIMS>(inputs_[input_idx], workload_idx);
+    }
+
+    /// Same as GetOutputPtr(), with the number of dimensions known at compile
+    /// time. \p NDIMS must be NumDims() or DYNAMIC_DIMS.
+    template <int64_t NDIMS>
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t workload_idx) const {
+        return GetWorkloadDataPtr<NDIMS>(outputs_[0], workload_idx);
+    }
+    template <int64_t NDIMS>
+    OPEN3D_HOST_DEVICE char* GetOutputPtr(int64_t output_idx,
+                                          int64_t workload_idx) const {
+        return GetWorkloadDataPtr<NDIMS>(outputs_[output_idx], workload_idx);
+    }
+
 protected:
     /// Merge adjacent dimensions if either dim is 1 or if:
     /// shape[n] * stride[n] == shape[n + 1]
@@ -487,6 +551,31 @@ protected:
         return static_cast<char*>(tr.data_ptr_) + offset;
     }
 
+    /// GetWorkloadDataPtr() for a compile-time number of dimensions. The loop
+    /// is unrolled, and since master_strides_[NDIMS - 1] is always 1 the
+    /// innermost dimension needs no division.
+    template <int64_t NDIMS>
+    OPEN3D_HOST_DEVICE char* GetWorkloadDataPtr(const TensorRef& tr,
+                                                int64_t workload_idx) const {
+        if (NDIMS == DYNAMIC_DIMS) {
+            return GetWorkloadDataPtr(tr, workload_idx);
+        }
+        if (workload_idx < 0) {
+            return nullptr;
+        }
+        int64_t offset = 0;
+        for (int64_t i = 0; i < NDIMS - 1; ++i) {
+            const int64_t dim_idx = workload_idx / master_strides_[i];
+            offset += dim_idx * tr.byte_strides_[i];
+            workload_idx -= dim_idx * master_strides_[i];
+        }
+        // Clamped so that DYNAMIC_DIMS, which returned above, still compiles
+        // without an out-of-bounds index.
+        constexpr int64_t last_dim = NDIMS > 0 ? NDIMS - 1 : 0;
+        offset += workload_idx * tr.byte_strides_[last_dim];
+        return static_cast<char*>(tr.data_ptr_) + offset;
+    }
+
     /// Number of input and output Tensors.
     int64_t num_inputs_ = 0;
     int64_t num_outputs_ = 0;
@@ -29,12 +29,40 @@
 #include <algorithm>
 #include <cstdlib>
 #include <numeric>
+#include <sstream>
 
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
 
+namespace {
+
+/// Tag of the allocating thread, interned by MemoryManagerStatistic.
+thread_local const std::string* current_tag = nullptr;
+
+void AddAllocation(MemoryUsage& usage, size_t byte_size) {
+    usage.current_bytes_ += static_cast<int64_t>(byte_size);
+    usage.total_allocated_bytes_ += static_cast<int64_t>(byte_size);
+    usage.peak_bytes_ = std::max(usage.peak_bytes_, usage.current_bytes_);
+    usage.count_malloc_++;
+}
+
+void RemoveAllocation(MemoryUsage& usage, size_t byte_size) {
+    usage.current_bytes_ -= static_cast<int64_t>(byte_size);
+    usage.count_free_++;
+}
+
+std::string FormatMemoryUsage(const std::string& name,
+                              const MemoryUsage& usage) {
+    return fmt::format("{:<32} {:>14} {:>14} {:>16} {:>10} {:>10}\n", name,
+                       usage.current_bytes_, usage.peak_bytes_,
+                       usage.total_allocated_bytes_, usage.count_malloc_,
+                       usage.count_free_);
+}
+
+}  // namespace
+
 MemoryManagerStatistic& MemoryManagerStatistic::GetInstance() {
     // Ensure the static Logger instance is instantiated before the
     // MemoryManagerStatistic instance.
@@ -103,8 +131,8 @@ void MemoryManagerStatistic::Print() const {
             size_t leaking_byte_size = std::accumulate(
                     statistics.active_allocations_.begin(),
                     statistics.active_allocations_.end(), 0,
-                    [](size_t count, auto ptr_byte_size) -> size_t {
-                        return count + ptr_byte_size.second;
+                    [](size_t count, auto ptr_allocation) -> size_t {
+                        return count + ptr_allocation.second.byte_size_;
                     });
 
             utility::LogWarning("{}: {} {} --> {} with {} total bytes",
@@ -113,8 +141,11 @@ void MemoryManagerStatistic::Print() const {
                                 leaking_byte_size);
 
             for (const auto& leak : statistics.active_allocations_) {
-                utility::LogWarning("    {} @ {} bytes", fmt::ptr(leak.first),
-                                    leak.second);
+                utility::LogWarning("    {} @ {} bytes{}", fmt::ptr(leak.first),
+                                    leak.second.byte_size_,
+                                    leak.second.tag_ == nullptr
+                                            ? ""
+                                            : " [" + *leak.second.tag_ + "]");
             }
         } else {
             utility::LogInfo("{}: {} {}", device.ToString(),
@@ -144,9 +175,14 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
         return;
     }
 
-    auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
+    MemoryStatistics& statistics = statistics_[device];
+    const std::string* tag = current_tag;
+    auto it = statistics.active_allocations_.emplace(
+            ptr, Allocation{byte_size, tag});
     if (it.second) {
-        statistics_[device].count_malloc_++;
+        statistics.count_malloc_++;
+        AddAllocation(statistics.usage_, byte_size);
+        AddAllocation(statistics.tag_usage_[tag], byte_size);
         if (print_at_malloc_free_) {
             utility::LogInfo("[Malloc] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
@@ -167,16 +203,20 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
         return;
     }
 
-    auto num_to_erase = statistics_[device].active_allocations_.count(ptr);
+    MemoryStatistics& statistics = statistics_[device];
+    auto num_to_erase = statistics.active_allocations_.count(ptr);
     if (num_to_erase == 1) {
+        const Allocation allocation = statistics.active_allocations_.at(ptr);
         if (print_at_malloc_free_) {
             utility::LogInfo("[ Free ] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
-                             fmt::ptr(ptr),
-                             statistics_[device].active_allocations_.at(ptr));
+                             fmt::ptr(ptr), allocation.byte_size_);
         }
-        statistics_[device].active_allocations_.erase(ptr);
-        statistics_[device].count_free_++;
+        statistics.active_allocations_.erase(ptr);
+        statistics.count_free_++;
+        RemoveAllocation(statistics.usage_, allocation.byte_size_);
+        RemoveAllocation(statistics.tag_usage_[allocation.tag_],
+                         allocation.byte_size_);
     } else if (num_to_erase == 0) {
         // Either the statistics were reset before or the given pointer is
         // invalid. Do not increase any counts and ignore both cases.
@@ -193,6 +233,113 @@ void MemoryManagerStatistic::Reset() {
     statistics_.clear();
 }
 
+MemoryUsage MemoryManagerStatistic::GetMemoryUsage(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? MemoryUsage() : it->second.usage_;
+}
+
+std::map<std::string, MemoryUsage> MemoryManagerStatistic::GetMemoryUsageByTag(
+        const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    std::map<std::string, MemoryUsage> tag_usage;
+    auto it = statistics_.find(device);
+    if (it != statistics_.end()) {
+        for (const auto& value_pair : it->second.tag_usage_) {
+            const std::string* tag = value_pair.first;
+            tag_usage[tag == nullptr ? "" : *tag] = value_pair.second;
+        }
+    }
+    return tag_usage;
+}
+
+void MemoryManagerStatistic::ResetPeakMemoryUsage(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    if (it == statistics_.end()) {
+        return;
+    }
+    it->second.usage_.peak_bytes_ = it->second.usage_.current_bytes_;
+    for (auto& value_pair : it->second.tag_usage_) {
+        value_pair.second.peak_bytes_ = value_pair.second.current_bytes_;
+    }
+}
+
+std::string MemoryManagerStatistic::GetMemoryUsageString(
+        bool include_allocations) const {
+    std::map<Device, MemoryStatistics> statistics;
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        statistics = statistics_;
+    }
+
+    std::stringstream ss;
+    ss << fmt::format("{:<32} {:>14} {:>14} {:>16} {:>10} {:>10}\n",
+                      "(Device/Tag)", "(Current)", "(Peak)", "(Total)",
+                      "(#Malloc)", "(#Free)");
+    for (const auto& value_pair : statistics) {
+        const auto& device = value_pair.first;
+        const auto& device_statistics = value_pair.second;
+        ss << FormatMemoryUsage(device.ToString(), device_statistics.usage_);
+
+        std::map<std::string, MemoryUsage> tag_usage;
+        for (const auto& tag_pair : device_statistics.tag_usage_) {
+            if (tag_pair.first != nullptr) {
+                tag_usage[*tag_pair.first] = tag_pair.second;
+            }
+        }
+        for (const auto& tag_pair : tag_usage) {
+            ss << FormatMemoryUsage("    " + tag_pair.first, tag_pair.second);
+        }
+
+        if (include_allocations) {
+            for (const auto& allocation :
+                 device_statistics.active_allocations_) {
+                ss << fmt::format(
+                        "        {} @ {} bytes{}\n",
+                        fmt::ptr(allocation.first),
+                        allocation.second.byte_size_,
+                        allocation.second.tag_ == nullptr
+                                ? ""
+                                : " [" + *allocation.second.tag_ + "]");
+            }
+        }
+    }
+    return ss.str();
+}
+
+void MemoryManagerStatistic::PrintMemoryUsage(bool include_allocations) const {
+    utility::LogInfo("Memory Usage: (bytes)\n{}",
+                     GetMemoryUsageString(include_allocations));
+}
+
+const std::string* MemoryManagerStatistic::GetCurrentTag() {
+    return current_tag;
+}
+
+const std::string* MemoryManagerStatistic::SetCurrentTag(
+        const std::string& tag) {
+    const std::string* prev_tag = current_tag;
+    const std::string full_tag =
+            prev_tag == nullptr ? tag : *prev_tag + "/" + tag;
+    {
+        std::lock_guard<std::mutex> lock(tags_mutex_);
+        current_tag = &*tags_.insert(full_tag).first;
+    }
+    return prev_tag;
+}
+
+void MemoryManagerStatistic::RestoreCurrentTag(const std::string* tag) {
+    current_tag = tag;
+}
+
+ScopedMemoryTag::ScopedMemoryTag(const std::string& tag)
+    : prev_tag_(MemoryManagerStatistic::GetInstance().SetCurrentTag(tag)) {}
+
+ScopedMemoryTag::~ScopedMemoryTag() {
+    MemoryManagerStatistic::RestoreCurrentTag(prev_tag_);
+}
+
 bool MemoryManagerStatistic::MemoryStatistics::IsBalanced() const {
     return count_malloc_ == count_free_;
 }
@@ -29,13 +29,32 @@
 #include <cstddef>
 #include <map>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/core/Device.h"
 
 namespace open3d {
 namespace core {
 
+/// Memory usage of a device or of an allocation tag on a device.
+struct MemoryUsage {
+    /// Number of bytes held by live allocations.
+    int64_t current_bytes_ = 0;
+    /// Maximum of current_bytes_ since the last reset.
+    int64_t peak_bytes_ = 0;
+    /// Sum of the sizes of all allocations since the last reset.
+    int64_t total_allocated_bytes_ = 0;
+    int64_t count_malloc_ = 0;
+    int64_t count_free_ = 0;
+};
+
+/// Records all allocations made through the MemoryManager.
+///
+/// Besides the malloc/free counts used for leak reporting, live and peak byte
+/// counts are tracked per device and per allocation tag. Tags are set with
+/// ScopedMemoryTag on the allocating thread.
 class MemoryManagerStatistic {
 public:
     enum class PrintLevel {
@@ -84,15 +103,54 @@ public:
     /// Resets the statistics.
     void Reset();
 
+    /// Returns the memory usage of \p device.
+    MemoryUsage GetMemoryUsage(const Device& device) const;
+
+    /// Returns the memory usage of \p device for each allocation tag.
+    /// Untagged allocations are reported under the empty tag.
+    std::map<std::string, MemoryUsage> GetMemoryUsageByTag(
+            const Device& device) const;
+
+    /// Sets the peak byte counts of \p device and all of its tags to the
+    /// current byte counts, e.g. to measure the peak of a single stage.
+    void ResetPeakMemoryUsage(const Device& device);
+
+    /// Returns the memory usage of all recorded devices and tags as a table.
+    /// If \p include_allocations is true, all live allocations are listed.
+    std::string GetMemoryUsageString(bool include_allocations = false) const;
+
+    /// Prints GetMemoryUsageString() with LogInfo.
+    void PrintMemoryUsage(bool include_allocations = false) const;
+
+    /// Returns the interned tag of the calling thread. Used by
+    /// ScopedMemoryTag.
+    static const std::string* GetCurrentTag();
+
+    /// Sets the tag of the calling thread to \p tag and returns the
+    /// previous tag. Used by ScopedMemoryTag.
+    const std::string* SetCurrentTag(const std::string& tag);
+
+    /// Restores a tag previously returned by SetCurrentTag().
+    static void RestoreCurrentTag(const std::string* tag);
+
 private:
     MemoryManagerStatistic() = default;
 
+    struct Allocation {
+        size_t byte_size_;
+        /// Interned tag, or nullptr if untagged.
+        const std::string* tag_;
+    };
+
     struct MemoryStatistics {
         bool IsBalanced() const;
 
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
-        std::unordered_map<void*, size_t> active_allocations_;
+        std::unordered_map<void*, Allocation> active_allocations_;
+
+        MemoryUsage usage_;
+        std::unordered_map<const std::string*, MemoryUsage> tag_usage_;
     };
 
     /// Only print unbalanced statistics by default.
@@ -105,8 +163,33 @@ private:
     /// Print at each malloc and free, disabled by default.
     bool print_at_malloc_free_ = false;
 
-    std::mutex statistics_mutex_;
+    mutable std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
+
+    /// Interned tags. Node-based, so pointers to the elements stay valid.
+    std::mutex tags_mutex_;
+    std::unordered_set<std::string> tags_;
+};
+
+/// \brief Tags all allocations of the calling thread within its lifetime.
+///
+/// Nested tags are joined with "/", e.g.
+/// \code{.cpp}
+/// ScopedMemoryTag tsdf_tag("TSDF");
+/// {
+///     ScopedMemoryTag hashmap_tag("block_hashmap");
+///     // Allocations are tagged with "TSDF/block_hashmap".
+/// }
+/// \endcode
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(const std::string& tag);
+    ~ScopedMemoryTag();
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+private:
+    const std::string* prev_tag_;
 };
 
 }  // namespace core
@@ -0,0 +1,343 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct Event::Impl {
+    /// Set if the event was last recorded on a CPU stream.
+    std::shared_future<void> future_;
+
+#ifdef BUILD_CUDA_MODULE
+    /// One recording on a CUDA stream. Every recording creates a new CUDA
+    /// event, so copies of an Impl keep referring to the recording they were
+    /// made from when the event is recorded again.
+    struct CUDARecording {
+        explicit CUDARecording(const Device& device) : device_(device) {
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(
+                    cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+        }
+        ~CUDARecording() {
+            CUDAScopedDevice scoped_device(device_);
+            cudaEventDestroy(event_);
+        }
+        CUDARecording(const CUDARecording&) = delete;
+        void operator=(const CUDARecording&) = delete;
+
+        Device device_;
+        cudaEvent_t event_;
+    };
+    /// Set if the event was last recorded on a CUDA stream.
+    std::shared_ptr<CUDARecording> cuda_recording_;
+
+    void RecordCUDA(const Device& device, cudaStream_t stream) {
+        auto recording = std::make_shared<CUDARecording>(device);
+        CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(cudaEventRecord(recording->event_, stream));
+        cuda_recording_ = std::move(recording);
+        future_ = std::shared_future<void>();
+    }
+#endif
+
+    void Synchronize() const {
+        if (future_.valid()) {
+            future_.wait();
+        }
+#ifdef BUILD_CUDA_MODULE
+        if (cuda_recording_) {
+            OPEN3D_CUDA_CHECK(cudaEventSynchronize(cuda_recording_->event_));
+        }
+#endif
+    }
+
+    bool IsCompleted() const {
+        if (future_.valid() &&
+            future_.wait_for(std::chrono::seconds(0)) !=
+                    std::future_status::ready) {
+            return false;
+        }
+#ifdef BUILD_CUDA_MODULE
+        if (cuda_recording_) {
+            cudaError_t err = cudaEventQuery(cuda_recording_->event_);
+            if (err == cudaErrorNotReady) {
+                return false;
+            }
+            OPEN3D_CUDA_CHECK(err);
+        }
+#endif
+        return true;
+    }
+};
+
+struct Stream::Impl {
+    explicit Impl(const Device& device) : device_(device) {}
+    virtual ~Impl() = default;
+
+    virtual void Enqueue(std::function<void()> task) = 0;
+    virtual void Wait(const Event& event) = 0;
+    virtual void Record(Event::Impl& event) = 0;
+    virtual void Synchronize() = 0;
+    virtual bool IsCompleted() const = 0;
+
+    Device device_;
+};
+
+/// Executes the tasks in order on a dedicated worker thread.
+struct Stream::CPUImpl : public Stream::Impl {
+    explicit CPUImpl(const Device& device)
+        : Impl(device), worker_([this]() { Run(); }) {}
+
+    ~CPUImpl() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        task_cv_.notify_one();
+        worker_.join();
+    }
+
+    void Enqueue(std::function<void()> task) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        task_cv_.notify_one();
+    }
+
+    void Wait(const Event& event) override {
+        // Copy the recording current at the time of the call. Recording the
+        // event again while the task is queued must not affect the task.
+        const Event::Impl recording = *event.impl_;
+        Enqueue([recording]() { recording.Synchronize(); });
+    }
+
+    void Record(Event::Impl& event) override {
+        auto promise = std::make_shared<std::promise<void>>();
+        event.future_ = promise->get_future().share();
+#ifdef BUILD_CUDA_MODULE
+        event.cuda_recording_.reset();
+#endif
+        Enqueue([promise]() { promise->set_value(); });
+    }
+
+    void Synchronize() override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return tasks_.empty() && !busy_; });
+        if (exception_) {
+            std::exception_ptr exception = exception_;
+            exception_ = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+    bool IsCompleted() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.empty() && !busy_;
+    }
+
+private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            busy_ = true;
+            lock.unlock();
+
+            std::exception_ptr exception;
+            try {
+                task();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            // Destroy the captures before the task is reported as done.
+            task = nullptr;
+
+            lock.lock();
+            busy_ = false;
+            if (exception && !exception_) {
+                exception_ = exception;
+            }
+            if (tasks_.empty()) {
+                done_cv_.notify_all();
+            }
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool busy_ = false;
+    bool stop_ = false;
+    /// First exception thrown by a task since the last Synchronize().
+    std::exception_ptr exception_;
+    /// Declared last, so that the members above are initialized first.
+    std::thread worker_;
+};
+
+#ifdef BUILD_CUDA_MODULE
+/// Executes the tasks on the calling thread with the CUDA stream set as the
+/// current stream.
+struct Stream::CUDAImpl : public Stream::Impl {
+    explicit CUDAImpl(const Device& device) : Impl(device) {
+        CUDAScopedDevice scoped_device(device_);
+        // Do not synchronize implicitly with the legacy default stream, which
+        // is used by all work outside of streams.
+        OPEN3D_CUDA_CHECK(
+                cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+    }
+
+    ~CUDAImpl() override {
+        CUDAScopedDevice scoped_device(device_);
+        cudaStreamSynchronize(stream_);
+        cudaStreamDestroy(stream_);
+    }
+
+    void Enqueue(std::function<void()> task) override {
+        {
+            CUDAScopedDevice scoped_device(device_);
+            CUDAScopedStream scoped_stream(stream_);
+            task();
+        }
+        // Keep the captured tensors alive until the stream is synchronized.
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_tasks_.push_back(std::move(task));
+    }
+
+    void Wait(const Event& event) override {
+        const Event::Impl& impl = *event.impl_;
+        if (impl.future_.valid()) {
+            impl.future_.wait();
+        }
+        if (impl.cuda_recording_) {
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(
+                    stream_, impl.cuda_recording_->event_, 0));
+        }
+    }
+
+    void Record(Event::Impl& event) override {
+        event.RecordCUDA(device_, stream_);
+    }
+
+    void Synchronize() override {
+        {
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream_));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_tasks_.clear();
+    }
+
+    bool IsCompleted() const override {
+        CUDAScopedDevice scoped_device(device_);
+        cudaError_t err = cudaStreamQuery(stream_);
+        if (err == cudaErrorNotReady) {
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+        return true;
+    }
+
+private:
+    cudaStream_t stream_;
+    std::mutex mutex_;
+    std::vector<std::function<void()>> pending_tasks_;
+};
+#endif
+
+Event::Event() : impl_(std::make_shared<Impl>()) {}
+
+void Event::Record(Stream& stream) { stream.impl_->Record(*impl_); }
+
+void Event::RecordCurrentStream(const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        impl_->RecordCUDA(device, cuda::GetStream());
+        return;
+    }
+    impl_->cuda_recording_.reset();
+#endif
+    impl_->future_ = std::shared_future<void>();
+}
+
+void Event::Synchronize() const { impl_->Synchronize(); }
+
+bool Event::IsCompleted() const { return impl_->IsCompleted(); }
+
+Stream::Stream(const Device& device) {
+    if (device.GetType() == Device::DeviceType::CPU) {
+        impl_ = std::make_shared<CPUImpl>(device);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        impl_ = std::make_shared<CUDAImpl>(device);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Stream: Unimplemented device");
+    }
+}
+
+Device Stream::GetDevice() const { return impl_->device_; }
+
+void Stream::Enqueue(std::function<void()> task) {
+    impl_->Enqueue(std::move(task));
+}
+
+void Stream::Wait(const Event& event) { impl_->Wait(event); }
+
+Event Stream::Record() {
+    Event event;
+    event.Record(*this);
+    return event;
+}
+
+void Stream::Synchronize() { impl_->Synchronize(); }
+
+bool Stream::IsCompleted() const { return impl_->IsCompleted(); }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+class Stream;
+
+/// \class Event
+///
+/// Marks a point in a Stream. An Event is recorded on a stream and completes
+/// once all tasks enqueued on that stream before the recording are done.
+///
+/// Events are handles: copies refer to the same underlying event.
+class Event {
+public:
+    Event();
+
+    /// Records the event on \p stream, replacing any previous recording.
+    void Record(Stream& stream);
+
+    /// Records the event on the current CUDA stream of \p device on the
+    /// calling thread, i.e. the stream of work launched outside of a Stream.
+    /// The event completes once that work is done. On CPU devices, the event
+    /// completes immediately.
+    void RecordCurrentStream(const Device& device);
+
+    /// Blocks the calling thread until the event has completed. Returns
+    /// immediately if the event was never recorded.
+    void Synchronize() const;
+
+    /// Returns true if the event has completed or was never recorded.
+    bool IsCompleted() const;
+
+private:
+    friend class Stream;
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
+/// \class Stream
+///
+/// An ordered queue of work on a device. Tasks enqueued on the same stream run
+/// in order; tasks on different streams may run concurrently, e.g. the upload
+/// of the next frame can overlap with the processing of the current one:
+///
+/// ```cpp
+/// core::Stream upload_stream(device);
+/// core::Tensor next = frame.ToAsync(device, upload_stream);
+/// Process(current);
+/// upload_stream.Synchronize();
+/// current = next;
+/// ```
+///
+/// On CPU, each stream owns a worker thread that executes its tasks. On CUDA,
+/// a stream wraps a cudaStream_t: tasks are executed on the calling thread with
+/// the stream set as the current CUDA stream, so their kernel launches and
+/// copies are asynchronous on that stream. Tensors captured by a task are kept
+/// alive until the stream is synchronized.
+///
+/// Host memory of tensors is pageable. A copy from host to CUDA memory blocks
+/// the calling thread until the driver has staged the host data, and a copy
+/// back to the host blocks until it is done. Only the device side of these
+/// copies overlaps with work on other streams.
+///
+/// Exceptions thrown by tasks of a CPU stream are rethrown by Synchronize().
+///
+/// Streams are handles: copies refer to the same underlying stream.
+class Stream {
+public:
+    /// Creates a new stream on \p device.
+    explicit Stream(const Device& device);
+
+    Device GetDevice() const;
+
+    /// Enqueues \p task to run after all previously enqueued tasks.
+    void Enqueue(std::function<void()> task);
+
+    /// Makes all subsequently enqueued tasks wait until the current recording
+    /// of \p event has completed. Recording \p event again afterwards does
+    /// not affect the wait. The calling thread is not blocked, except for a
+    /// CUDA stream waiting on a CPU event.
+    void Wait(const Event& event);
+
+    /// Records and returns a new event on this stream.
+    Event Record();
+
+    /// Blocks the calling thread until all enqueued tasks are done.
+    void Synchronize();
+
+    /// Returns true if all enqueued tasks are done.
+    bool IsCompleted() const;
+
+private:
+    friend class Event;
+    struct Impl;
+    struct CPUImpl;
+    struct CUDAImpl;
+    std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -47,6 +47,7 @@
 #include "open3d/core/linalg/Solve.h"
 #include "open3d/core/linalg/Tri.h"
 #include "open3d/t/io/NumpyIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -566,6 +567,48 @@ Tensor Tensor::To(const Device& device, Dtype dtype, bool copy) const {
     return dst_tensor;
 }
 
+Tensor Tensor::ToAsync(const Device& device, Stream& stream) const {
+    if (stream.GetDevice() != GetDevice() && stream.GetDevice() != device) {
+        utility::LogError(
+                "Stream device {} must be the source device {} or the target "
+                "device {}.",
+                stream.GetDevice().ToString(), GetDevice().ToString(),
+                device.ToString());
+    }
+    const Tensor src_tensor = *this;
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+        // The source may still be written by work on the current stream.
+        Event src_ready;
+        src_ready.RecordCurrentStream(GetDevice());
+        stream.Wait(src_ready);
+    }
+    if (stream.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        // Tasks of a CUDA stream run on the calling thread with the stream as
+        // the current stream. Allocating in the task orders the stream-ordered
+        // allocation on the stream of the copy.
+        auto dst_tensor = std::make_shared<Tensor>();
+        const SizeVector shape = shape_;
+        const Dtype dtype = dtype_;
+        stream.Enqueue([src_tensor, dst_tensor, shape, dtype, device]() {
+            *dst_tensor = Tensor(shape, dtype, device);
+            kernel::Copy(src_tensor, *dst_tensor);
+        });
+        return *dst_tensor;
+    }
+    Tensor dst_tensor(shape_, dtype_, device);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        // The destination is allocated in order on the current stream, but
+        // the copy runs on the worker thread of the CPU stream.
+        Event dst_ready;
+        dst_ready.RecordCurrentStream(device);
+        stream.Wait(dst_ready);
+    }
+    stream.Enqueue([src_tensor, dst_tensor]() mutable {
+        kernel::Copy(src_tensor, dst_tensor);
+    });
+    return dst_tensor;
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
 Tensor Tensor::Contiguous() const {
@@ -701,6 +744,34 @@ Tensor Tensor::Slice(int64_t dim,
     return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
 }
 
+/// Returns true if \p index_tensors select rows of \p tensor, i.e. the first
+/// dimension is indexed by a 1-D Int64 tensor or a 1-D Bool mask covering the
+/// dimension, all other dimensions are full slices, and each row is
+/// contiguous in memory. Such indexing is done by copying whole rows.
+static bool IsRowIndexing(const Tensor& tensor,
+                          const std::vector<Tensor>& index_tensors) {
+    if (index_tensors.empty() ||
+        static_cast<int64_t>(index_tensors.size()) > tensor.NumDims() ||
+        index_tensors[0].NumDims() != 1 || tensor.NumElements() == 0) {
+        return false;
+    }
+    for (size_t i = 1; i < index_tensors.size(); ++i) {
+        if (index_tensors[i].NumDims() != 0 ||
+            index_tensors[i].GetDtype() != core::Int64) {
+            return false;
+        }
+    }
+    const Tensor& index = index_tensors[0];
+    if (index.GetDtype() == core::Bool) {
+        if (index.GetLength() != tensor.GetShape(0)) {
+            return false;
+        }
+    } else if (index.GetDtype() != core::Int64) {
+        return false;
+    }
+    return kernel::IsRowContiguous(tensor);
+}
+
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
     if (NumDims() == 0) {
         const std::string error_prefix =
@@ -727,6 +798,19 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
         }
     }
 
+    // Fast path: t[indices] or t[mask, :, ...] copies whole rows.
+    if (IsRowIndexing(*this, index_tensors)) {
+        Tensor index = index_tensors[0].To(GetDevice()).Contiguous();
+        if (index.GetDtype() == core::Bool) {
+            return kernel::IndexGetRowsByMask(*this, index);
+        }
+        SizeVector dst_shape = shape_;
+        dst_shape[0] = index.GetLength();
+        Tensor dst(dst_shape, dtype_, GetDevice());
+        kernel::IndexGetRows(*this, index, dst);
+        return dst;
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
 
@@ -788,6 +872,32 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
         return;
     }
 
+    // Fast path: t[indices] = src or t[mask, :, ...] = src copies whole rows
+    // when src provides exactly one row per index.
+    if (IsRowIndexing(*this, index_tensors)) {
+        Tensor index = index_tensors[0].To(GetDevice());
+        if (index.GetDtype() == core::Bool) {
+            index = index.NonZero()[0];
+        }
+        index = index.Contiguous();
+        SizeVector src_shape = shape_;
+        src_shape[0] = index.GetLength();
+        if (src_tensor.GetShape() == src_shape &&
+            src_tensor.GetDtype() == dtype_) {
+            kernel::IndexSetRows(src_tensor.Contiguous(), *this, index);
+            return;
+        }
+        // Broadcasting src falls back to the generic engine. Reuse the
+        // converted indices to avoid another NonZero pass.
+        std::vector<Tensor> int_index_tensors = index_tensors;
+        int_index_tensors[0] = index;
+        AdvancedIndexPreprocessor aip(*this, int_index_tensors);
+        Tensor pre_processed_dst = aip.GetTensor();
+        kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
+                         aip.GetIndexedShape(), aip.GetIndexedStrides());
+        return;
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
 
@@ -1019,6 +1129,32 @@ Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
     return dst;
 }
 
+std::tuple<Tensor, Tensor> Tensor::MinMax(const SizeVector& dims,
+                                          bool keepdim) const {
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    Tensor dst_min(dst_shape, dtype_, GetDevice());
+    Tensor dst_max(dst_shape, dtype_, GetDevice());
+    kernel::MinMaxReduction(*this, dst_min, dst_max, dims, keepdim);
+    return std::make_tuple(dst_min, dst_max);
+}
+
+std::tuple<Tensor, Tensor> Tensor::MeanVar(const SizeVector& dims,
+                                           bool keepdim) const {
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    Tensor dst_mean(dst_shape, dtype_, GetDevice());
+    Tensor dst_var(dst_shape, dtype_, GetDevice());
+    kernel::MeanVarReduction(*this, dst_mean, dst_var, dims, keepdim);
+    return std::make_tuple(dst_mean, dst_var);
+}
+
+std::tuple<Tensor, Tensor> Tensor::MeanCov() const {
+    AssertShapeCompatible({utility::nullopt, utility::nullopt});
+    Tensor dst_mean({shape_[1]}, dtype_, GetDevice());
+    Tensor dst_cov({shape_[1], shape_[1]}, dtype_, GetDevice());
+    kernel::MeanCov(*this, dst_mean, dst_cov);
+    return std::make_tuple(dst_mean, dst_cov);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), core::Int64,
                GetDevice());
@@ -1033,6 +1169,42 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::SegmentSum(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& segment_ids,
+                           int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::Min);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::Max);
+}
+
+Tensor Tensor::SegmentArgMin(const Tensor& segment_ids,
+                             int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::ArgMin);
+}
+
+Tensor Tensor::SegmentArgMax(const Tensor& segment_ids,
+                             int64_t num_segments) const {
+    return kernel::SegmentReduction(*this, segment_ids, num_segments,
+                                    kernel::SegmentReductionOpCode::ArgMax);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -1533,6 +1705,49 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
                   dtype, blob);
 }
 
+Tensor Tensor::FromMappedFile(const std::string& filename,
+                              int64_t byte_offset,
+                              const SizeVector& shape,
+                              Dtype dtype,
+                              bool copy_on_write) {
+    // Tensors are sliced and gathered, so there is no point in reading ahead
+    // aggressively.
+    auto mapped_file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!mapped_file->Open(filename, copy_on_write,
+                           utility::filesystem::MappedFile::AccessPattern::
+                                   Normal)) {
+        utility::LogError("Failed to map file {}: {}", filename,
+                          mapped_file->GetError());
+    }
+    return FromMappedFile(mapped_file, byte_offset, shape, dtype);
+}
+
+Tensor Tensor::FromMappedFile(
+        const std::shared_ptr<utility::filesystem::MappedFile>& mapped_file,
+        int64_t byte_offset,
+        const SizeVector& shape,
+        Dtype dtype) {
+    if (byte_offset < 0) {
+        utility::LogError("Invalid byte_offset {}.", byte_offset);
+    }
+    const int64_t byte_size = shape.NumElements() * dtype.ByteSize();
+    if (byte_offset + byte_size >
+        static_cast<int64_t>(mapped_file->GetSize())) {
+        utility::LogError(
+                "Mapped file has {} bytes, but {} bytes are required for a "
+                "tensor of shape {} and dtype {} at offset {}.",
+                mapped_file->GetSize(), byte_offset + byte_size,
+                shape.ToString(), dtype.ToString(), byte_offset);
+    }
+
+    // The deleter owns the mapping, which is unmapped with the last owner.
+    char* data_ptr = const_cast<char*>(mapped_file->GetData());
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                       [mapped_file](void*) {});
+    return Tensor(shape, shape_util::DefaultStrides(shape),
+                  data_ptr + byte_offset, dtype, blob);
+}
+
 void Tensor::Save(const std::string& file_name) const {
     t::io::WriteNpy(file_name, *this);
 }
@@ -38,10 +38,17 @@
 #include "open3d/core/Scalar.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/Stream.h"
 #include "open3d/core/TensorInit.h"
 #include "open3d/core/TensorKey.h"
 
 namespace open3d {
+namespace utility {
+namespace filesystem {
+class MappedFile;
+}  // namespace filesystem
+}  // namespace utility
+
 namespace core {
 
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
@@ -415,6 +422,19 @@ public:
     /// and have the targeted dtype.
     Tensor To(const Device& device, Dtype dtype, bool copy = false) const;
 
+    /// Returns a tensor on \p device whose copy is enqueued on \p stream.
+    /// The returned tensor is allocated immediately, but its values are only
+    /// valid once \p stream is synchronized or an Event recorded on it after
+    /// this call has completed. The stream must be on the source or the
+    /// target device.
+    ///
+    /// The copy waits for work on the current stream of a CUDA source, which
+    /// may still write to it. On a CUDA stream, the tensor is allocated on
+    /// \p stream; on a CPU stream, the copy waits for the allocation on the
+    /// current stream of a CUDA target. Host memory is pageable, so the host
+    /// side of the copy blocks the calling thread, see Stream.
+    Tensor ToAsync(const Device& device, Stream& stream) const;
+
     std::string ToString(bool with_suffix = true,
                          const std::string& indent = "") const;
 
@@ -580,6 +600,29 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Returns the min and the max of the tensor along the given \p dims,
+    /// computed in a single pass. The tensor must not be empty.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    /// \return Tuple (min, max).
+    std::tuple<Tensor, Tensor> MinMax(const SizeVector& dims,
+                                      bool keepdim = false) const;
+
+    /// Returns the mean and the population variance of the tensor along the
+    /// given \p dims, computed in a single pass with Welford's algorithm. The
+    /// tensor must be Float32 or Float64.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    /// \return Tuple (mean, variance).
+    std::tuple<Tensor, Tensor> MeanVar(const SizeVector& dims,
+                                       bool keepdim = false) const;
+
+    /// Returns the mean of shape {D} and the population covariance of shape
+    /// {D, D} of the rows of a {N, D} Float32 or Float64 tensor, computed in a
+    /// single pass with Welford's algorithm.
+    /// \return Tuple (mean, covariance).
+    std::tuple<Tensor, Tensor> MeanCov() const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -600,6 +643,34 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the sum of the rows of the tensor grouped by \p segment_ids.
+    /// The tensor has shape {N, ...} and \p segment_ids is a {N} Int64 tensor
+    /// with ids in [0, \p num_segments). Rows with other ids are skipped. The
+    /// returned tensor has shape {num_segments, ...} and is 0 for empty
+    /// segments. Ragged rows given by row splits are reduced with
+    /// kernel::SegmentReductionRowSplits().
+    Tensor SegmentSum(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the mean of the rows of the Float32 or Float64 tensor grouped by
+    /// \p segment_ids, see SegmentSum().
+    Tensor SegmentMean(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the min of the rows of the tensor grouped by \p segment_ids,
+    /// see SegmentSum().
+    Tensor SegmentMin(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the max of the rows of the tensor grouped by \p segment_ids,
+    /// see SegmentSum().
+    Tensor SegmentMax(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the Int64 row index of the minimum of every segment, or -1 for
+    /// empty segments. Ties resolve to the first row. See SegmentSum().
+    Tensor SegmentArgMin(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the Int64 row index of the maximum of every segment, or -1 for
+    /// empty segments. Ties resolve to the first row. See SegmentSum().
+    Tensor SegmentArgMax(const Tensor& segment_ids, int64_t num_segments) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -1050,6 +1121,43 @@ public:
     /// Convert DLManagedTensor to Tensor.
     static Tensor FromDLPack(const DLManagedTensor* dlmt);
 
+    /// \brief Create a tensor backed by a memory-mapped region of a file.
+    ///
+    /// No data is read upfront. The OS loads pages as they are accessed, so
+    /// views such as Slice() and gathers such as IndexGet() only read the
+    /// parts of the file they touch. The tensor is on CPU and its Blob owns
+    /// the mapping, which is released with the last tensor sharing the Blob.
+    ///
+    /// \param filename Path to the file.
+    /// \param byte_offset Position of the first element in the file.
+    /// \param shape Shape of the tensor, stored contiguously in the file.
+    /// \param dtype Data type of the tensor.
+    /// \param copy_on_write If false, the file is mapped read-only and writing
+    /// to the tensor is invalid. If true, writes are private to the process
+    /// and never stored back to the file.
+    static Tensor FromMappedFile(const std::string& filename,
+                                 int64_t byte_offset,
+                                 const SizeVector& shape,
+                                 Dtype dtype,
+                                 bool copy_on_write = false);
+
+    /// \brief Create a tensor backed by a file that is already mapped.
+    ///
+    /// The Blob of the tensor shares ownership of \p mapped_file, so the
+    /// mapping stays alive as long as a tensor refers to it. Readers that
+    /// parse a header from the mapping use the Blob for views of the data.
+    ///
+    /// \param mapped_file An open file mapping.
+    /// \param byte_offset Position of the first element in the file.
+    /// \param shape Shape of the tensor, stored contiguously in the file.
+    /// \param dtype Data type of the tensor.
+    static Tensor FromMappedFile(
+            const std::shared_ptr<utility::filesystem::MappedFile>&
+                    mapped_file,
+            int64_t byte_offset,
+            const SizeVector& shape,
+            Dtype dtype);
+
     /// Save tensor to numpy's npy format.
     void Save(const std::string& file_name) const;
 
@@ -30,6 +30,7 @@
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -71,6 +72,10 @@ void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
                      Tensor& output_masks) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "hashmap", "Insert", GetDevice().ToString(),
+            input_keys.NumElements() * input_keys.GetDtype().ByteSize(),
+            input_keys.GetLength());
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -111,6 +116,10 @@ void Hashmap::Insert(const Tensor& input_keys,
 void Hashmap::Activate(const Tensor& input_keys,
                        Tensor& output_addrs,
                        Tensor& output_masks) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "hashmap", "Activate", GetDevice().ToString(),
+            input_keys.NumElements() * input_keys.GetDtype().ByteSize(),
+            input_keys.GetLength());
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -138,6 +147,10 @@ void Hashmap::Activate(const Tensor& input_keys,
 void Hashmap::Find(const Tensor& input_keys,
                    Tensor& output_addrs,
                    Tensor& output_masks) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "hashmap", "Find", GetDevice().ToString(),
+            input_keys.NumElements() * input_keys.GetDtype().ByteSize(),
+            input_keys.GetLength());
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
@@ -163,6 +176,10 @@ void Hashmap::Find(const Tensor& input_keys,
 }
 
 void Hashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "hashmap", "Erase", GetDevice().ToString(),
+            input_keys.NumElements() * input_keys.GetDtype().ByteSize(),
+            input_keys.GetLength());
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
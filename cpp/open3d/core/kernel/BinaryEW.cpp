@@ -31,6 +31,7 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -49,6 +50,12 @@ void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "BinaryEW", lhs.GetDevice().ToString(),
+            lhs.NumElements() * lhs.GetDtype().ByteSize() +
+                    rhs.NumElements() * rhs.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize(),
+            dst.NumElements());
     // lhs, rhs and dst must be on the same device.
     for (auto device :
          std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
@@ -38,14 +38,32 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
-template <typename func_t>
+template <typename src_t, typename dst_t, typename func_t>
 static void LaunchBinaryEWKernel(const Indexer& indexer, const func_t& func) {
-    cpu_launcher::ParallelFor(
-            indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
-            [&indexer, &func](int64_t i) {
-                func(indexer.GetInputPtr(0, i), indexer.GetInputPtr(1, i),
-                     indexer.GetOutputPtr(i));
-            });
+    if (indexer.IsContiguous()) {
+        // Workload i is the i-th element of all operands, so the offsets
+        // reduce to typed pointer increments.
+        const src_t* lhs =
+                static_cast<const src_t*>(indexer.GetInput(0).data_ptr_);
+        const src_t* rhs =
+                static_cast<const src_t*>(indexer.GetInput(1).data_ptr_);
+        dst_t* dst = static_cast<dst_t*>(indexer.GetOutput().data_ptr_);
+        cpu_launcher::ParallelFor(
+                indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [lhs, rhs, dst, &func](int64_t i) {
+                    func(lhs + i, rhs + i, dst + i);
+                });
+        return;
+    }
+    DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+        cpu_launcher::ParallelFor(
+                indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [&indexer, &func](int64_t i) {
+                    func(indexer.GetInputPtr<kNDims>(0, i),
+                         indexer.GetInputPtr<kNDims>(1, i),
+                         indexer.GetOutputPtr<kNDims>(i));
+                });
+    });
 }
 
 template <typename scalar_t>
@@ -143,34 +161,40 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Indexer& indexer) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalAndElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULogicalAndElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::LogicalOr:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalOrElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULogicalOrElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::LogicalXor:
-            LaunchBinaryEWKernel(indexer,
-                                 CPULogicalXorElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULogicalXorElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Gt:
-            LaunchBinaryEWKernel(indexer, CPUGtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUGtElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Lt:
-            LaunchBinaryEWKernel(indexer, CPULtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULtElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Ge:
-            LaunchBinaryEWKernel(indexer, CPUGeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUGeqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Le:
-            LaunchBinaryEWKernel(indexer, CPULeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPULeqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Eq:
-            LaunchBinaryEWKernel(indexer, CPUEqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUEqElementKernel<src_t, dst_t>);
             break;
         case BinaryEWOpCode::Ne:
-            LaunchBinaryEWKernel(indexer, CPUNeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWKernel<src_t, dst_t>(
+                    indexer, CPUNeqElementKernel<src_t, dst_t>);
             break;
         default:
             break;
@@ -211,20 +235,20 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUAddElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUAddElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Sub:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUSubElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUSubElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Mul:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUMulElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUMulElementKernel<scalar_t>);
                     break;
                 case BinaryEWOpCode::Div:
-                    LaunchBinaryEWKernel(indexer,
-                                         CPUDivElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUDivElementKernel<scalar_t>);
                     break;
                 default:
                     break;
@@ -32,6 +32,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -42,6 +43,10 @@ void IndexGet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "IndexGet", src.GetDevice().ToString(),
+            dst.NumElements() * dst.GetDtype().ByteSize(),
+            dst.NumElements());
     // index_tensors has been preprocessed to be on the same device as src,
     // however, dst may be in a different device.
     if (dst.GetDevice() != src.GetDevice()) {
@@ -68,6 +73,10 @@ void IndexSet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "IndexSet", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
     // index_tensors has been preprocessed to be on the same device as dst,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
@@ -85,6 +94,137 @@ void IndexSet(const Tensor& src,
     }
 }
 
+bool IsRowContiguous(const Tensor& tensor) {
+    if (tensor.NumDims() == 0) {
+        return false;
+    }
+    int64_t expected_stride = 1;
+    for (int64_t dim = tensor.NumDims() - 1; dim >= 1; --dim) {
+        if (tensor.GetShape(dim) != 1 &&
+            tensor.GetStride(dim) != expected_stride) {
+            return false;
+        }
+        expected_stride *= tensor.GetShape(dim);
+    }
+    return true;
+}
+
+static void AssertRowIndices(const Tensor& indices, const Device& device) {
+    if (indices.NumDims() != 1 || indices.GetDtype() != core::Int64 ||
+        !indices.IsContiguous()) {
+        utility::LogError(
+                "Row indices must be a contiguous 1-D Int64 tensor, but got "
+                "shape {} and dtype {}.",
+                indices.GetShape().ToString(), indices.GetDtype().ToString());
+    }
+    if (indices.GetDevice() != device) {
+        utility::LogError("Row indices must be on device {}, but got {}.",
+                          device.ToString(), indices.GetDevice().ToString());
+    }
+}
+
+static void AssertRows(const Tensor& rows,
+                       const Tensor& indexed,
+                       int64_t num_rows) {
+    SizeVector expected_shape = indexed.GetShape();
+    expected_shape[0] = num_rows;
+    rows.AssertShape(expected_shape);
+    rows.AssertDtype(indexed.GetDtype());
+    if (!rows.IsContiguous()) {
+        utility::LogError("Gathered or scattered rows must be contiguous.");
+    }
+}
+
+void IndexGetRows(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "IndexGetRows", src.GetDevice().ToString(),
+            dst.NumElements() * dst.GetDtype().ByteSize(),
+            dst.NumElements());
+    if (!IsRowContiguous(src)) {
+        utility::LogError(
+                "IndexGetRows: src of shape {} and strides {} is not "
+                "row-contiguous.",
+                src.GetShape().ToString(), src.GetStrides().ToString());
+    }
+    AssertRowIndices(indices, src.GetDevice());
+    AssertRows(dst, src, indices.GetLength());
+
+    if (dst.GetDevice() != src.GetDevice()) {
+        Tensor dst_same_device(dst.GetShape(), dst.GetDtype(), src.GetDevice());
+        IndexGetRows(src, indices, dst_same_device);
+        dst.CopyFrom(dst_same_device);
+        return;
+    }
+
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, indices, dst);
+    } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexGetRowsCUDA(src, indices, dst);
+#endif
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& indices) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "IndexSetRows", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
+    if (!IsRowContiguous(dst)) {
+        utility::LogError(
+                "IndexSetRows: dst of shape {} and strides {} is not "
+                "row-contiguous.",
+                dst.GetShape().ToString(), dst.GetStrides().ToString());
+    }
+    AssertRowIndices(indices, dst.GetDevice());
+    AssertRows(src, dst, indices.GetLength());
+
+    Tensor src_same_device = src.To(dst.GetDevice());
+
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src_same_device, dst, indices);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexSetRowsCUDA(src_same_device, dst, indices);
+#endif
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+Tensor IndexGetRowsByMask(const Tensor& src, const Tensor& mask) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "IndexGetRowsByMask", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
+    if (!IsRowContiguous(src)) {
+        utility::LogError(
+                "IndexGetRowsByMask: src of shape {} and strides {} is not "
+                "row-contiguous.",
+                src.GetShape().ToString(), src.GetStrides().ToString());
+    }
+    mask.AssertShape({src.GetShape(0)});
+    mask.AssertDtype(core::Bool);
+    mask.AssertDevice(src.GetDevice());
+    if (!mask.IsContiguous()) {
+        utility::LogError("IndexGetRowsByMask: mask must be contiguous.");
+    }
+
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        return IndexGetRowsByMaskCPU(src, mask);
+    } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return IndexGetRowsByMaskCUDA(src, mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexGetRowsByMask: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -73,6 +73,60 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Returns true if the trailing dimensions of \p tensor (all dimensions but
+/// the first one) are contiguous, such that each row tensor[i] is one
+/// contiguous block of memory. The stride of the first dimension can be
+/// arbitrary.
+bool IsRowContiguous(const Tensor& tensor);
+
+/// Row gather, i.e. dst[i] = src[indices[i]].
+///
+/// \param src The row-contiguous tensor to gather from, with at least 1 dim.
+/// \param indices Contiguous 1-D Int64 tensor of row indices into \p src on
+/// the same device as \p src. Negative indices count from the end.
+/// \param dst Contiguous tensor of shape {indices.GetLength(), src.shape[1:]}
+/// with the dtype of \p src. May be on a different device than \p src.
+void IndexGetRows(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexGetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst);
+#endif
+
+/// Row scatter, i.e. dst[indices[i]] = src[i]. If \p indices contains
+/// duplicates, which of the corresponding rows is written is undefined.
+///
+/// \param src Contiguous tensor of shape {indices.GetLength(), dst.shape[1:]}
+/// with the dtype of \p dst. May be on a different device than \p dst.
+/// \param dst The row-contiguous tensor to scatter into, with at least 1 dim.
+/// \param indices Contiguous 1-D Int64 tensor of row indices into \p dst on
+/// the same device as \p dst. Negative indices count from the end.
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& indices);
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& indices);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexSetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& indices);
+#endif
+
+/// Fused mask compaction, i.e. src[mask] for a boolean mask over the first
+/// dimension. Unlike IndexGet, the selected rows are copied directly to their
+/// output position without materializing the NonZero indices first.
+///
+/// \param src The row-contiguous tensor to select from, with at least 1 dim.
+/// \param mask Contiguous 1-D Bool tensor of length src.shape[0] on the same
+/// device as \p src.
+/// \return Contiguous tensor of shape {mask.count(), src.shape[1:]} on the
+/// device of \p src, keeping the order of the selected rows.
+Tensor IndexGetRowsByMask(const Tensor& src, const Tensor& mask);
+
+Tensor IndexGetRowsByMaskCPU(const Tensor& src, const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor IndexGetRowsByMaskCUDA(const Tensor& src, const Tensor& mask);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,12 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <numeric>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
@@ -38,11 +41,14 @@ namespace kernel {
 template <typename func_t>
 static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                         const func_t& func) {
-    cpu_launcher::ParallelFor(
-            indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
-            [&indexer, &func](int64_t i) {
-                func(indexer.GetInputPtr(i), indexer.GetOutputPtr(i));
-            });
+    DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+        cpu_launcher::ParallelFor(
+                indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [&indexer, &func](int64_t i) {
+                    func(indexer.GetInputPtr<kNDims>(i),
+                         indexer.GetOutputPtr<kNDims>(i));
+                });
+    });
 }
 
 template <typename scalar_t>
@@ -98,6 +104,120 @@ void IndexSetCPU(const Tensor& src,
     }
 }
 
+/// Number of bytes of one row of a row-contiguous tensor.
+static int64_t RowByteSize(const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShape();
+    return SizeVector(shape.begin() + 1, shape.end()).NumElements() *
+           tensor.GetDtype().ByteSize();
+}
+
+/// Copies whole rows with one memcpy each. If \p gather, row indices[i] of
+/// src is copied to row i of dst, otherwise row i of src is copied to row
+/// indices[i] of dst.
+template <bool gather>
+static void CopyRowsCPU(const char* src_ptr,
+                        int64_t src_row_stride,
+                        char* dst_ptr,
+                        int64_t dst_row_stride,
+                        const int64_t* indices,
+                        int64_t num_indices,
+                        int64_t num_indexed_rows,
+                        int64_t row_byte_size) {
+    // Small copies run in serial, measured in bytes rather than rows.
+    cpu_launcher::ParallelFor(
+            num_indices, cpu_launcher::SMALL_OP_GRAIN_SIZE / row_byte_size,
+            [&](int64_t i) {
+                int64_t index = indices[i];
+                OPEN3D_ASSERT(index >= -num_indexed_rows &&
+                              index < num_indexed_rows &&
+                              "Index out of bounds.");
+                index += num_indexed_rows * (index < 0);
+                const int64_t src_row = gather ? index : i;
+                const int64_t dst_row = gather ? i : index;
+                memcpy(dst_ptr + dst_row * dst_row_stride,
+                       src_ptr + src_row * src_row_stride, row_byte_size);
+            });
+}
+
+void IndexGetRowsCPU(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    const int64_t row_byte_size = RowByteSize(src);
+    if (row_byte_size == 0 || indices.GetLength() == 0) {
+        return;
+    }
+    const int64_t element_byte_size = src.GetDtype().ByteSize();
+    CopyRowsCPU</*gather=*/true>(
+            static_cast<const char*>(src.GetDataPtr()),
+            src.GetStride(0) * element_byte_size,
+            static_cast<char*>(dst.GetDataPtr()), row_byte_size,
+            indices.GetDataPtr<int64_t>(), indices.GetLength(),
+            src.GetShape(0), row_byte_size);
+}
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& indices) {
+    const int64_t row_byte_size = RowByteSize(dst);
+    if (row_byte_size == 0 || indices.GetLength() == 0) {
+        return;
+    }
+    const int64_t element_byte_size = dst.GetDtype().ByteSize();
+    CopyRowsCPU</*gather=*/false>(
+            static_cast<const char*>(src.GetDataPtr()), row_byte_size,
+            static_cast<char*>(dst.GetDataPtr()),
+            dst.GetStride(0) * element_byte_size,
+            indices.GetDataPtr<int64_t>(), indices.GetLength(),
+            dst.GetShape(0), row_byte_size);
+}
+
+Tensor IndexGetRowsByMaskCPU(const Tensor& src, const Tensor& mask) {
+    // Rows are split into chunks. The selected rows of each chunk are counted
+    // first, then each chunk copies its rows starting at the exclusive prefix
+    // sum of the counts. The output order is therefore the input order.
+    static constexpr int64_t kMinChunkSize = 4096;
+    const int64_t num_rows = src.GetShape(0);
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads() * 4,
+                                 num_rows / kMinChunkSize));
+    const int64_t chunk_size = (num_rows + num_chunks - 1) / num_chunks;
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    cpu_launcher::ParallelFor(num_chunks, [&](int64_t chunk) {
+        const int64_t begin = chunk * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, num_rows);
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            count += mask_ptr[i];
+        }
+        chunk_offsets[chunk + 1] = count;
+    });
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = chunk_offsets.back();
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t row_byte_size = RowByteSize(src);
+    if (row_byte_size == 0 || dst_shape[0] == 0) {
+        return dst;
+    }
+
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    const int64_t src_row_stride = src.GetStride(0) * src.GetDtype().ByteSize();
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    cpu_launcher::ParallelFor(num_chunks, [&](int64_t chunk) {
+        const int64_t begin = chunk * chunk_size;
+        const int64_t end = std::min(begin + chunk_size, num_rows);
+        char* chunk_dst_ptr = dst_ptr + chunk_offsets[chunk] * row_byte_size;
+        for (int64_t i = begin; i < end; ++i) {
+            if (mask_ptr[i]) {
+                memcpy(chunk_dst_ptr, src_ptr + i * src_row_stride,
+                       row_byte_size);
+                chunk_dst_ptr += row_byte_size;
+            }
+        }
+    });
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
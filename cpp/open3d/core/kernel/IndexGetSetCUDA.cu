@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -36,14 +40,23 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+template <int64_t NDIMS, typename func_t>
+void LaunchAdvancedIndexerKernelNDims(const AdvancedIndexer& indexer,
+                                      const func_t& element_kernel) {
+    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        element_kernel(indexer.GetInputPtr<NDIMS>(i),
+                       indexer.GetOutputPtr<NDIMS>(i));
+    };
+    cuda_launcher::ParallelFor(indexer.NumWorkloads(), element_func);
+}
+
 template <typename func_t>
 void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                  const func_t& element_kernel) {
     OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
-    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
-        element_kernel(indexer.GetInputPtr(i), indexer.GetOutputPtr(i));
-    };
-    cuda_launcher::ParallelFor(indexer.NumWorkloads(), element_func);
+    DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+        LaunchAdvancedIndexerKernelNDims<kNDims>(indexer, element_kernel);
+    });
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
 }
 
@@ -118,6 +131,225 @@ void IndexSetCUDA(const Tensor& src,
     }
 }
 
+/// Number of bytes of one row of a row-contiguous tensor.
+static int64_t RowByteSize(const Tensor& tensor) {
+    const SizeVector& shape = tensor.GetShape();
+    return SizeVector(shape.begin() + 1, shape.end()).NumElements() *
+           tensor.GetDtype().ByteSize();
+}
+
+/// Largest power-of-two word size up to 16 bytes dividing all \p values, used
+/// to copy rows with as few and as wide memory transactions as possible.
+static int64_t CommonWordSize(const std::vector<int64_t>& values) {
+    for (int64_t word_size : {16, 8, 4, 2}) {
+        if (std::all_of(values.begin(), values.end(), [&](int64_t value) {
+                return value % word_size == 0;
+            })) {
+            return word_size;
+        }
+    }
+    return 1;
+}
+
+/// Copies whole rows with one thread per word. If \p gather, row indices[i]
+/// of src is copied to row i of dst, otherwise row i of src is copied to row
+/// indices[i] of dst.
+template <typename word_t>
+void LaunchCopyRowsKernel(const char* src_ptr,
+                          int64_t src_row_stride,
+                          char* dst_ptr,
+                          int64_t dst_row_stride,
+                          const int64_t* indices,
+                          int64_t num_indices,
+                          int64_t num_indexed_rows,
+                          int64_t row_byte_size,
+                          bool gather) {
+    const int64_t words_per_row = row_byte_size / sizeof(word_t);
+    cuda_launcher::ParallelFor(
+            num_indices * words_per_row, [=] OPEN3D_DEVICE(int64_t workload) {
+                const int64_t i = workload / words_per_row;
+                const int64_t word = workload % words_per_row;
+                int64_t index = indices[i];
+                OPEN3D_ASSERT(index >= -num_indexed_rows &&
+                              index < num_indexed_rows &&
+                              "Index out of bounds.");
+                index += num_indexed_rows * (index < 0);
+                const int64_t src_row = gather ? index : i;
+                const int64_t dst_row = gather ? i : index;
+                reinterpret_cast<word_t*>(dst_ptr +
+                                          dst_row * dst_row_stride)[word] =
+                        reinterpret_cast<const word_t*>(
+                                src_ptr + src_row * src_row_stride)[word];
+            });
+    OPEN3D_GET_LAST_CUDA_ERROR("LaunchCopyRowsKernel failed.");
+}
+
+static void CopyRowsCUDA(const char* src_ptr,
+                         int64_t src_row_stride,
+                         char* dst_ptr,
+                         int64_t dst_row_stride,
+                         const int64_t* indices,
+                         int64_t num_indices,
+                         int64_t num_indexed_rows,
+                         int64_t row_byte_size,
+                         bool gather) {
+    const int64_t word_size = CommonWordSize(
+            {row_byte_size, src_row_stride, dst_row_stride,
+             reinterpret_cast<int64_t>(src_ptr),
+             reinterpret_cast<int64_t>(dst_ptr)});
+    switch (word_size) {
+        case 16:
+            LaunchCopyRowsKernel<uint4>(src_ptr, src_row_stride, dst_ptr,
+                                        dst_row_stride, indices, num_indices,
+                                        num_indexed_rows, row_byte_size,
+                                        gather);
+            break;
+        case 8:
+            LaunchCopyRowsKernel<uint64_t>(src_ptr, src_row_stride, dst_ptr,
+                                           dst_row_stride, indices, num_indices,
+                                           num_indexed_rows, row_byte_size,
+                                           gather);
+            break;
+        case 4:
+            LaunchCopyRowsKernel<uint32_t>(src_ptr, src_row_stride, dst_ptr,
+                                           dst_row_stride, indices, num_indices,
+                                           num_indexed_rows, row_byte_size,
+                                           gather);
+            break;
+        case 2:
+            LaunchCopyRowsKernel<uint16_t>(src_ptr, src_row_stride, dst_ptr,
+                                           dst_row_stride, indices, num_indices,
+                                           num_indexed_rows, row_byte_size,
+                                           gather);
+            break;
+        default:
+            LaunchCopyRowsKernel<uint8_t>(src_ptr, src_row_stride, dst_ptr,
+                                          dst_row_stride, indices, num_indices,
+                                          num_indexed_rows, row_byte_size,
+                                          gather);
+            break;
+    }
+}
+
+void IndexGetRowsCUDA(const Tensor& src, const Tensor& indices, Tensor& dst) {
+    const int64_t row_byte_size = RowByteSize(src);
+    if (row_byte_size == 0 || indices.GetLength() == 0) {
+        return;
+    }
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    CopyRowsCUDA(static_cast<const char*>(src.GetDataPtr()),
+                 src.GetStride(0) * src.GetDtype().ByteSize(),
+                 static_cast<char*>(dst.GetDataPtr()), row_byte_size,
+                 indices.GetDataPtr<int64_t>(), indices.GetLength(),
+                 src.GetShape(0), row_byte_size, /*gather=*/true);
+}
+
+void IndexSetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& indices) {
+    const int64_t row_byte_size = RowByteSize(dst);
+    if (row_byte_size == 0 || indices.GetLength() == 0) {
+        return;
+    }
+    CUDAScopedDevice scoped_device(dst.GetDevice());
+    CopyRowsCUDA(static_cast<const char*>(src.GetDataPtr()), row_byte_size,
+                 static_cast<char*>(dst.GetDataPtr()),
+                 dst.GetStride(0) * dst.GetDtype().ByteSize(),
+                 indices.GetDataPtr<int64_t>(), indices.GetLength(),
+                 dst.GetShape(0), row_byte_size, /*gather=*/false);
+}
+
+struct BoolToInt64Functor {
+    __host__ __device__ int64_t operator()(bool value) const {
+        return static_cast<int64_t>(value);
+    }
+};
+
+template <typename word_t>
+void LaunchCopyMaskedRowsKernel(const char* src_ptr,
+                                int64_t src_row_stride,
+                                char* dst_ptr,
+                                const bool* mask_ptr,
+                                const int64_t* positions_ptr,
+                                int64_t num_rows,
+                                int64_t row_byte_size) {
+    const int64_t words_per_row = row_byte_size / sizeof(word_t);
+    cuda_launcher::ParallelFor(
+            num_rows * words_per_row, [=] OPEN3D_DEVICE(int64_t workload) {
+                const int64_t i = workload / words_per_row;
+                if (!mask_ptr[i]) {
+                    return;
+                }
+                const int64_t word = workload % words_per_row;
+                // positions_ptr is an inclusive scan of the mask.
+                const int64_t dst_row = positions_ptr[i] - 1;
+                reinterpret_cast<word_t*>(dst_ptr +
+                                          dst_row * row_byte_size)[word] =
+                        reinterpret_cast<const word_t*>(
+                                src_ptr + i * src_row_stride)[word];
+            });
+    OPEN3D_GET_LAST_CUDA_ERROR("LaunchCopyMaskedRowsKernel failed.");
+}
+
+Tensor IndexGetRowsByMaskCUDA(const Tensor& src, const Tensor& mask) {
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    const int64_t num_rows = src.GetShape(0);
+    SizeVector dst_shape = src.GetShape();
+    if (num_rows == 0) {
+        return Tensor(dst_shape, src.GetDtype(), src.GetDevice());
+    }
+
+    // The output row of each selected input row is given by the inclusive
+    // scan of the mask, so no separate NonZero pass is needed.
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+    Tensor positions({num_rows}, core::Int64, src.GetDevice());
+    int64_t* positions_ptr = positions.GetDataPtr<int64_t>();
+    auto flags =
+            thrust::make_transform_iterator(mask_ptr, BoolToInt64Functor());
+    thrust::inclusive_scan(thrust::device, flags, flags + num_rows,
+                           positions_ptr);
+
+    dst_shape[0] = positions[num_rows - 1].Item<int64_t>();
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t row_byte_size = RowByteSize(src);
+    if (row_byte_size == 0 || dst_shape[0] == 0) {
+        return dst;
+    }
+
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    const int64_t src_row_stride = src.GetStride(0) * src.GetDtype().ByteSize();
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    const int64_t word_size = CommonWordSize(
+            {row_byte_size, src_row_stride, reinterpret_cast<int64_t>(src_ptr),
+             reinterpret_cast<int64_t>(dst_ptr)});
+    switch (word_size) {
+        case 16:
+            LaunchCopyMaskedRowsKernel<uint4>(src_ptr, src_row_stride, dst_ptr,
+                                              mask_ptr, positions_ptr, num_rows,
+                                              row_byte_size);
+            break;
+        case 8:
+            LaunchCopyMaskedRowsKernel<uint64_t>(
+                    src_ptr, src_row_stride, dst_ptr, mask_ptr, positions_ptr,
+                    num_rows, row_byte_size);
+            break;
+        case 4:
+            LaunchCopyMaskedRowsKernel<uint32_t>(
+                    src_ptr, src_row_stride, dst_ptr, mask_ptr, positions_ptr,
+                    num_rows, row_byte_size);
+            break;
+        case 2:
+            LaunchCopyMaskedRowsKernel<uint16_t>(
+                    src_ptr, src_row_stride, dst_ptr, mask_ptr, positions_ptr,
+                    num_rows, row_byte_size);
+            break;
+        default:
+            LaunchCopyMaskedRowsKernel<uint8_t>(
+                    src_ptr, src_row_stride, dst_ptr, mask_ptr, positions_ptr,
+                    num_rows, row_byte_size);
+            break;
+    }
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
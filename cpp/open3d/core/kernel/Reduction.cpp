@@ -26,7 +26,11 @@
 
 #include "open3d/core/kernel/Reduction.h"
 
+#include <algorithm>
+
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -37,6 +41,10 @@ void Reduction(const Tensor& src,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "Reduction", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
@@ -106,6 +114,159 @@ void Reduction(const Tensor& src,
     }
 }
 
+bool IsConsecutiveReductionDims(const SizeVector& dims, int64_t num_dims) {
+    if (dims.empty()) {
+        return false;
+    }
+    SizeVector sorted_dims;
+    for (const int64_t& dim : dims) {
+        sorted_dims.push_back(shape_util::WrapDim(dim, num_dims));
+    }
+    std::sort(sorted_dims.begin(), sorted_dims.end());
+    for (size_t i = 1; i < sorted_dims.size(); ++i) {
+        if (sorted_dims[i] != sorted_dims[i - 1] + 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Checks the output shape of a multi-output reduction and reshapes \p dst to
+/// the keepdim shape.
+static void PrepareReductionOutput(const Tensor& src,
+                                   Tensor& dst,
+                                   const SizeVector& dims,
+                                   bool keepdim) {
+    SizeVector expected_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, keepdim);
+    if (dst.GetShape() != expected_shape) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          expected_shape.ToString(),
+                          dst.GetShape().ToString());
+    }
+    dst.AssertDtype(src.GetDtype());
+    dst.AssertDevice(src.GetDevice());
+    if (!keepdim) {
+        dst = dst.Reshape(
+                shape_util::ReductionShape(src.GetShape(), dims, true));
+    }
+}
+
+/// Returns true if the fused CPU kernels apply. Otherwise, the multi-output
+/// reductions are composed from single-output ones.
+static bool UseFusedReductionCPU(const Tensor& src,
+                                 const Tensor& dst,
+                                 const SizeVector& dims) {
+    return src.GetDevice().GetType() == Device::DeviceType::CPU &&
+           dst.IsContiguous() &&
+           IsConsecutiveReductionDims(dims, src.NumDims());
+}
+
+void MinMaxReduction(const Tensor& src,
+                     Tensor& dst_min,
+                     Tensor& dst_max,
+                     const SizeVector& dims,
+                     bool keepdim) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "MinMaxReduction", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
+    if (src.NumElements() == 0) {
+        utility::LogError("Zero-size Tensor does not suport MinMax.");
+    }
+    const SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, false);
+    PrepareReductionOutput(src, dst_min, dims, keepdim);
+    PrepareReductionOutput(src, dst_max, dims, keepdim);
+
+    if (UseFusedReductionCPU(src, dst_min, dims) && dst_max.IsContiguous()) {
+        MinMaxReductionCPU(src.Contiguous(), dst_min, dst_max, dims);
+    } else {
+        dst_min.AsRvalue() = src.Min(dims, true);
+        dst_max.AsRvalue() = src.Max(dims, true);
+    }
+
+    if (!keepdim) {
+        dst_min = dst_min.Reshape(non_keepdim_shape);
+        dst_max = dst_max.Reshape(non_keepdim_shape);
+    }
+}
+
+void MeanVarReduction(const Tensor& src,
+                      Tensor& dst_mean,
+                      Tensor& dst_var,
+                      const SizeVector& dims,
+                      bool keepdim) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "MeanVarReduction", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
+    if (src.GetDtype() != core::Float32 && src.GetDtype() != core::Float64) {
+        utility::LogError(
+                "Can only compute mean and variance for Float32 or Float64, "
+                "got {} instead.",
+                src.GetDtype().ToString());
+    }
+    if (src.NumElements() == 0) {
+        utility::LogWarning("Computing mean and variance of 0-sized Tensor.");
+    }
+    const SizeVector non_keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, false);
+    PrepareReductionOutput(src, dst_mean, dims, keepdim);
+    PrepareReductionOutput(src, dst_var, dims, keepdim);
+
+    if (UseFusedReductionCPU(src, dst_mean, dims) && dst_var.IsContiguous()) {
+        MeanVarReductionCPU(src.Contiguous(), dst_mean, dst_var, dims);
+    } else {
+        Tensor mean = src.Mean(dims, true);
+        Tensor diff = src - mean;
+        dst_mean.AsRvalue() = mean;
+        dst_var.AsRvalue() = (diff * diff).Mean(dims, true);
+    }
+
+    if (!keepdim) {
+        dst_mean = dst_mean.Reshape(non_keepdim_shape);
+        dst_var = dst_var.Reshape(non_keepdim_shape);
+    }
+}
+
+void MeanCov(const Tensor& src, Tensor& dst_mean, Tensor& dst_cov) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "MeanCov", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize(),
+            src.NumElements());
+    if (src.GetDtype() != core::Float32 && src.GetDtype() != core::Float64) {
+        utility::LogError(
+                "Can only compute mean and covariance for Float32 or Float64, "
+                "got {} instead.",
+                src.GetDtype().ToString());
+    }
+    if (src.NumDims() != 2) {
+        utility::LogError(
+                "Mean and covariance expect a {{N, D}} tensor, but got shape "
+                "{}.",
+                src.GetShape().ToString());
+    }
+    const int64_t dim = src.GetShape(1);
+    dst_mean.AssertShape({dim});
+    dst_mean.AssertDtype(src.GetDtype());
+    dst_mean.AssertDevice(src.GetDevice());
+    dst_cov.AssertShape({dim, dim});
+    dst_cov.AssertDtype(src.GetDtype());
+    dst_cov.AssertDevice(src.GetDevice());
+
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU &&
+        dst_mean.IsContiguous() && dst_cov.IsContiguous()) {
+        MeanCovCPU(src.Contiguous(), dst_mean, dst_cov);
+    } else {
+        Tensor mean = src.Mean({0});
+        Tensor diff = src - mean;
+        dst_mean.AsRvalue() = mean;
+        dst_cov.AsRvalue() = diff.T().Matmul(diff).Div(
+                static_cast<double>(src.GetShape(0)));
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
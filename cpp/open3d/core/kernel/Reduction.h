@@ -86,6 +86,68 @@ void ReductionCUDA(const Tensor& src,
                    ReductionOpCode op_code);
 #endif
 
+/// Returns true if \p dims, after wrapping negative dims, form one block of
+/// consecutive dimensions of a tensor with \p num_dims dimensions, e.g. {1, 2}
+/// or {2, 1} of a 4-D tensor. A contiguous tensor reduced over such dims can
+/// be viewed as {outer, reduce, inner} and reduced over the middle dimension.
+bool IsConsecutiveReductionDims(const SizeVector& dims, int64_t num_dims);
+
+/// Fused min and max reduction, reading \p src only once.
+///
+/// \param src The tensor to reduce, must not be empty.
+/// \param dst_min Output with the reduction shape and the dtype of \p src.
+/// \param dst_max Output with the reduction shape and the dtype of \p src.
+/// \param dims The dimensions to reduce.
+/// \param keepdim If true, \p dst_min and \p dst_max have the reduced dims
+/// retained as size 1.
+void MinMaxReduction(const Tensor& src,
+                     Tensor& dst_min,
+                     Tensor& dst_max,
+                     const SizeVector& dims,
+                     bool keepdim);
+
+/// \p src must be contiguous, \p dims consecutive, and \p dst_min and \p
+/// dst_max contiguous with keepdim shape.
+void MinMaxReductionCPU(const Tensor& src,
+                        Tensor& dst_min,
+                        Tensor& dst_max,
+                        const SizeVector& dims);
+
+/// Fused mean and population variance reduction for Float32 and Float64.
+/// Partial results are merged with Chan et al.'s parallel form of Welford's
+/// algorithm, so the variance does not suffer from the cancellation of the
+/// E[x^2] - E[x]^2 formula.
+///
+/// \param src The tensor to reduce.
+/// \param dst_mean Output with the reduction shape and the dtype of \p src.
+/// \param dst_var Output with the reduction shape and the dtype of \p src.
+/// \param dims The dimensions to reduce.
+/// \param keepdim If true, \p dst_mean and \p dst_var have the reduced dims
+/// retained as size 1.
+void MeanVarReduction(const Tensor& src,
+                      Tensor& dst_mean,
+                      Tensor& dst_var,
+                      const SizeVector& dims,
+                      bool keepdim);
+
+/// \p src must be contiguous, \p dims consecutive, and \p dst_mean and \p
+/// dst_var contiguous with keepdim shape.
+void MeanVarReductionCPU(const Tensor& src,
+                         Tensor& dst_mean,
+                         Tensor& dst_var,
+                         const SizeVector& dims);
+
+/// Fused mean and population covariance of the rows of a {N, D} Float32 or
+/// Float64 tensor, merged the same way as MeanVarReduction.
+///
+/// \param src The {N, D} tensor of N samples.
+/// \param dst_mean Output of shape {D} with the dtype of \p src.
+/// \param dst_cov Output of shape {D, D} with the dtype of \p src.
+void MeanCov(const Tensor& src, Tensor& dst_mean, Tensor& dst_cov);
+
+/// \p src must be contiguous, and \p dst_mean and \p dst_cov contiguous.
+void MeanCovCPU(const Tensor& src, Tensor& dst_mean, Tensor& dst_cov);
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,10 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Logging.h"
@@ -109,14 +113,17 @@ private:
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
                                             func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
-        }
+        const int64_t num_workloads = indexer.NumWorkloads();
+        DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+            for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                 ++workload_idx) {
+                scalar_t* src = reinterpret_cast<scalar_t*>(
+                        indexer.GetInputPtr<kNDims>(0, workload_idx));
+                scalar_t* dst = reinterpret_cast<scalar_t*>(
+                        indexer.GetOutputPtr<kNDims>(workload_idx));
+                *dst = element_kernel(*src, *dst);
+            }
+        });
     }
 
     /// Create num_threads workers to compute partial reductions and then reduce
@@ -141,13 +148,15 @@ private:
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
-            }
+            DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    scalar_t* src = reinterpret_cast<scalar_t*>(
+                            indexer.GetInputPtr<kNDims>(0, workload_idx));
+                    thread_results[thread_idx] =
+                            element_kernel(*src, thread_results[thread_idx]);
+                }
+            });
         }
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
@@ -217,17 +226,21 @@ public:
             // sub_indexer.NumWorkloads() == ipo.
             // sub_indexer's workload_idx is indexer_'s ipo_idx.
             Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
-            }
+            const int64_t num_workloads = sub_indexer.NumWorkloads();
+            DISPATCH_NDIMS_TO_TEMPLATE(sub_indexer.NumDims(), [&]() {
+                scalar_t dst_val = identity;
+                for (int64_t workload_idx = 0; workload_idx < num_workloads;
+                     workload_idx++) {
+                    int64_t src_idx = workload_idx;
+                    scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                            sub_indexer.GetInputPtr<kNDims>(0, workload_idx));
+                    int64_t* dst_idx = reinterpret_cast<int64_t*>(
+                            sub_indexer.GetOutputPtr<kNDims>(0,
+                                                             workload_idx));
+                    std::tie(*dst_idx, dst_val) = reduce_func(
+                            src_idx, *src_val, *dst_idx, dst_val);
+                }
+            });
         }
     }
 
@@ -235,12 +248,553 @@ private:
     Indexer indexer_;
 };
 
+/// Number of elements summed sequentially at the leaves of PairwiseSum. The
+/// rounding error grows with O(log(n)) instead of O(n) for naive summation.
+static constexpr int64_t kPairwiseBlockSize = 128;
+
+/// Number of independent accumulators used for 1-D sums, so that the inner
+/// loops can be vectorized.
+static constexpr int64_t kNumLanes = 8;
+
+/// Maximum number of independent accumulators for min and max reductions.
+static constexpr int64_t kMaxLaneWidth = 64;
+
+/// Number of rows whose statistics are computed in two passes before being
+/// merged into the running statistics of a Welford reduction.
+static constexpr int64_t kWelfordBlockSize = 256;
+
+/// Reductions with fewer elements run in serial.
+static constexpr int64_t kContiguousReductionGrainSize = 32768;
+
+/// Work partition for reducing the middle dimension of a contiguous tensor
+/// viewed as {outer, reduce, inner}. Each output row of \p inner elements is
+/// reduced from \p num_chunks_ chunks of consecutive rows. There is a single
+/// chunk, unless there are too few outputs to keep all threads busy.
+class ContiguousReduction {
+public:
+    ContiguousReduction(const Tensor& src, const SizeVector& dims) {
+        SizeVector sorted_dims;
+        for (const int64_t& dim : dims) {
+            sorted_dims.push_back(shape_util::WrapDim(dim, src.NumDims()));
+        }
+        std::sort(sorted_dims.begin(), sorted_dims.end());
+        const SizeVector& shape = src.GetShape();
+        outer_ = SizeVector(shape.begin(), shape.begin() + sorted_dims.front())
+                         .NumElements();
+        reduce_ = SizeVector(shape.begin() + sorted_dims.front(),
+                             shape.begin() + sorted_dims.back() + 1)
+                          .NumElements();
+        inner_ = SizeVector(shape.begin() + sorted_dims.back() + 1,
+                            shape.end())
+                         .NumElements();
+
+        const int64_t num_threads = utility::EstimateMaxThreads();
+        parallel_ = num_threads > 1 && !utility::InParallel() &&
+                    outer_ * reduce_ * inner_ > kContiguousReductionGrainSize;
+        num_chunks_ = 1;
+        chunk_size_ = reduce_;
+        if (parallel_ && outer_ < num_threads && reduce_ > 1) {
+            const int64_t min_chunk_size = std::max<int64_t>(
+                    1, kContiguousReductionGrainSize / inner_);
+            chunk_size_ = std::max(
+                    min_chunk_size,
+                    (reduce_ * outer_ + num_threads - 1) / num_threads);
+            chunk_size_ = std::min(chunk_size_, reduce_);
+            num_chunks_ = (reduce_ + chunk_size_ - 1) / chunk_size_;
+        }
+    }
+
+    int64_t Outer() const { return outer_; }
+    int64_t Reduce() const { return reduce_; }
+    int64_t Inner() const { return inner_; }
+    int64_t NumChunks() const { return num_chunks_; }
+
+    /// Calls func(outer_idx, chunk_idx, row_begin, row_end) for every chunk,
+    /// where rows are indexed along the reduced dimension.
+    template <typename func_t>
+    void ParallelForChunks(const func_t& func) const {
+        const int64_t num_tasks = outer_ * num_chunks_;
+#pragma omp parallel for schedule(static) if (parallel_) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t task = 0; task < num_tasks; ++task) {
+            const int64_t outer_idx = task / num_chunks_;
+            const int64_t chunk_idx = task % num_chunks_;
+            const int64_t row_begin = chunk_idx * chunk_size_;
+            const int64_t row_end = std::min(row_begin + chunk_size_, reduce_);
+            func(outer_idx, chunk_idx, row_begin, row_end);
+        }
+    }
+
+private:
+    int64_t outer_;
+    int64_t reduce_;
+    int64_t inner_;
+    int64_t num_chunks_;
+    int64_t chunk_size_;
+    bool parallel_;
+};
+
+template <typename scalar_t>
+static scalar_t PairwiseSum(const scalar_t* src, int64_t n) {
+    if (n > kPairwiseBlockSize) {
+        const int64_t half = n / 2 / kNumLanes * kNumLanes;
+        return PairwiseSum(src, half) + PairwiseSum(src + half, n - half);
+    }
+    scalar_t lanes[kNumLanes] = {};
+    int64_t i = 0;
+    for (; i + kNumLanes <= n; i += kNumLanes) {
+        for (int64_t k = 0; k < kNumLanes; ++k) {
+            lanes[k] += src[i + k];
+        }
+    }
+    scalar_t tail = 0;
+    for (; i < n; ++i) {
+        tail += src[i];
+    }
+    for (int64_t width = kNumLanes / 2; width > 0; width /= 2) {
+        for (int64_t k = 0; k < width; ++k) {
+            lanes[k] += lanes[k + width];
+        }
+    }
+    return lanes[0] + tail;
+}
+
+/// Reduces {num_rows, inner} to {inner}. Long columns of floating point
+/// values are summed with Kahan compensation, which vectorizes across columns.
+template <typename scalar_t>
+static void SumRows(const scalar_t* src,
+                    int64_t num_rows,
+                    int64_t inner,
+                    scalar_t* dst) {
+    if (inner == 1) {
+        dst[0] = PairwiseSum(src, num_rows);
+        return;
+    }
+    std::fill(dst, dst + inner, scalar_t(0));
+    if (!std::is_floating_point<scalar_t>::value ||
+        num_rows <= kPairwiseBlockSize) {
+        for (int64_t row = 0; row < num_rows; ++row) {
+            const scalar_t* src_row = src + row * inner;
+            for (int64_t j = 0; j < inner; ++j) {
+                dst[j] += src_row[j];
+            }
+        }
+        return;
+    }
+    thread_local std::vector<scalar_t> compensation;
+    compensation.assign(inner, scalar_t(0));
+    scalar_t* c = compensation.data();
+    for (int64_t row = 0; row < num_rows; ++row) {
+        const scalar_t* src_row = src + row * inner;
+        for (int64_t j = 0; j < inner; ++j) {
+            const scalar_t y = src_row[j] - c[j];
+            const scalar_t t = dst[j] + y;
+            c[j] = (t - dst[j]) - y;
+            dst[j] = t;
+        }
+    }
+}
+
+/// Reduces {num_rows, inner} to {inner} with a min or max kernel. \p
+/// num_rows must be positive. For narrow rows, the input is reduced as a flat
+/// array into lanes of a multiple of inner elements, so that the inner loop
+/// vectorizes for any number of columns. Each lane then holds the partial
+/// result of one column.
+template <typename scalar_t, typename func_t>
+static void ReduceRows(const scalar_t* src,
+                       int64_t num_rows,
+                       int64_t inner,
+                       scalar_t* dst,
+                       func_t element_kernel) {
+    if (inner <= kMaxLaneWidth) {
+        const int64_t width = inner * (kMaxLaneWidth / inner);
+        const int64_t n = num_rows * inner;
+        scalar_t lanes[kMaxLaneWidth];
+        for (int64_t k = 0; k < width; ++k) {
+            lanes[k] = src[k % inner];
+        }
+        int64_t i = 0;
+        for (; i + width <= n; i += width) {
+            for (int64_t k = 0; k < width; ++k) {
+                lanes[k] = element_kernel(src[i + k], lanes[k]);
+            }
+        }
+        for (int64_t k = 0; i + k < n; ++k) {
+            lanes[k] = element_kernel(src[i + k], lanes[k]);
+        }
+        for (int64_t j = 0; j < inner; ++j) {
+            scalar_t result = lanes[j];
+            for (int64_t k = j + inner; k < width; k += inner) {
+                result = element_kernel(lanes[k], result);
+            }
+            dst[j] = result;
+        }
+        return;
+    }
+    std::copy(src, src + inner, dst);
+    for (int64_t row = 1; row < num_rows; ++row) {
+        const scalar_t* src_row = src + row * inner;
+        for (int64_t j = 0; j < inner; ++j) {
+            dst[j] = element_kernel(src_row[j], dst[j]);
+        }
+    }
+}
+
+/// Fused min and max of {num_rows, inner} to {inner}, reduced in lanes like
+/// ReduceRows. \p num_rows must be positive.
+template <typename scalar_t>
+static void MinMaxRows(const scalar_t* src,
+                       int64_t num_rows,
+                       int64_t inner,
+                       scalar_t* dst_min,
+                       scalar_t* dst_max) {
+    if (inner <= kMaxLaneWidth) {
+        const int64_t width = inner * (kMaxLaneWidth / inner);
+        const int64_t n = num_rows * inner;
+        scalar_t min_lanes[kMaxLaneWidth];
+        scalar_t max_lanes[kMaxLaneWidth];
+        for (int64_t k = 0; k < width; ++k) {
+            min_lanes[k] = src[k % inner];
+            max_lanes[k] = src[k % inner];
+        }
+        int64_t i = 0;
+        for (; i + width <= n; i += width) {
+            for (int64_t k = 0; k < width; ++k) {
+                min_lanes[k] = std::min(src[i + k], min_lanes[k]);
+                max_lanes[k] = std::max(src[i + k], max_lanes[k]);
+            }
+        }
+        for (int64_t k = 0; i + k < n; ++k) {
+            min_lanes[k] = std::min(src[i + k], min_lanes[k]);
+            max_lanes[k] = std::max(src[i + k], max_lanes[k]);
+        }
+        for (int64_t j = 0; j < inner; ++j) {
+            scalar_t min_result = min_lanes[j];
+            scalar_t max_result = max_lanes[j];
+            for (int64_t k = j + inner; k < width; k += inner) {
+                min_result = std::min(min_lanes[k], min_result);
+                max_result = std::max(max_lanes[k], max_result);
+            }
+            dst_min[j] = min_result;
+            dst_max[j] = max_result;
+        }
+        return;
+    }
+    std::copy(src, src + inner, dst_min);
+    std::copy(src, src + inner, dst_max);
+    for (int64_t row = 1; row < num_rows; ++row) {
+        const scalar_t* src_row = src + row * inner;
+        for (int64_t j = 0; j < inner; ++j) {
+            dst_min[j] = std::min(src_row[j], dst_min[j]);
+            dst_max[j] = std::max(src_row[j], dst_max[j]);
+        }
+    }
+}
+
+/// Runs \p reduce_rows(src, num_rows, inner, dst) on every chunk and, if the
+/// reduced dimension was split, once more on the partial results.
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousReduction(const ContiguousReduction& cr,
+                                      const scalar_t* src,
+                                      scalar_t* dst,
+                                      const func_t& reduce_rows) {
+    const int64_t reduce = cr.Reduce();
+    const int64_t inner = cr.Inner();
+    const int64_t num_chunks = cr.NumChunks();
+    if (num_chunks == 1) {
+        cr.ParallelForChunks([&](int64_t outer_idx, int64_t, int64_t,
+                                 int64_t) {
+            reduce_rows(src + outer_idx * reduce * inner, reduce, inner,
+                        dst + outer_idx * inner);
+        });
+        return;
+    }
+    std::vector<scalar_t> partials(cr.Outer() * num_chunks * inner);
+    cr.ParallelForChunks([&](int64_t outer_idx, int64_t chunk_idx,
+                             int64_t row_begin, int64_t row_end) {
+        reduce_rows(src + (outer_idx * reduce + row_begin) * inner,
+                    row_end - row_begin, inner,
+                    partials.data() +
+                            (outer_idx * num_chunks + chunk_idx) * inner);
+    });
+    for (int64_t outer_idx = 0; outer_idx < cr.Outer(); ++outer_idx) {
+        reduce_rows(partials.data() + outer_idx * num_chunks * inner,
+                    num_chunks, inner, dst + outer_idx * inner);
+    }
+}
+
+/// Reduction of a non-empty contiguous tensor over consecutive dims, where
+/// each output is reduced from one contiguous range of memory instead of
+/// going through the Indexer element by element.
+static void ContiguousReductionCPU(const Tensor& src,
+                                   Tensor& dst,
+                                   const SizeVector& dims,
+                                   ReductionOpCode op_code) {
+    ContiguousReduction cr(src, dims);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchContiguousReduction(cr, src_ptr, dst_ptr,
+                                          SumRows<scalar_t>);
+                break;
+            case ReductionOpCode::Min:
+                LaunchContiguousReduction(
+                        cr, src_ptr, dst_ptr,
+                        [](const scalar_t* src, int64_t num_rows,
+                           int64_t inner, scalar_t* dst) {
+                            ReduceRows(src, num_rows, inner, dst,
+                                       [](scalar_t a, scalar_t b) {
+                                           return std::min(a, b);
+                                       });
+                        });
+                break;
+            case ReductionOpCode::Max:
+                LaunchContiguousReduction(
+                        cr, src_ptr, dst_ptr,
+                        [](const scalar_t* src, int64_t num_rows,
+                           int64_t inner, scalar_t* dst) {
+                            ReduceRows(src, num_rows, inner, dst,
+                                       [](scalar_t a, scalar_t b) {
+                                           return std::max(a, b);
+                                       });
+                        });
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+void MinMaxReductionCPU(const Tensor& src,
+                        Tensor& dst_min,
+                        Tensor& dst_max,
+                        const SizeVector& dims) {
+    ContiguousReduction cr(src, dims);
+    const int64_t reduce = cr.Reduce();
+    const int64_t inner = cr.Inner();
+    const int64_t num_chunks = cr.NumChunks();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_min_ptr = dst_min.GetDataPtr<scalar_t>();
+        scalar_t* dst_max_ptr = dst_max.GetDataPtr<scalar_t>();
+        if (num_chunks == 1) {
+            cr.ParallelForChunks([&](int64_t outer_idx, int64_t, int64_t,
+                                     int64_t) {
+                MinMaxRows(src_ptr + outer_idx * reduce * inner, reduce, inner,
+                           dst_min_ptr + outer_idx * inner,
+                           dst_max_ptr + outer_idx * inner);
+            });
+            return;
+        }
+        std::vector<scalar_t> partial_min(cr.Outer() * num_chunks * inner);
+        std::vector<scalar_t> partial_max(cr.Outer() * num_chunks * inner);
+        cr.ParallelForChunks([&](int64_t outer_idx, int64_t chunk_idx,
+                                 int64_t row_begin, int64_t row_end) {
+            const int64_t offset = (outer_idx * num_chunks + chunk_idx) * inner;
+            MinMaxRows(src_ptr + (outer_idx * reduce + row_begin) * inner,
+                       row_end - row_begin, inner, partial_min.data() + offset,
+                       partial_max.data() + offset);
+        });
+        for (int64_t outer_idx = 0; outer_idx < cr.Outer(); ++outer_idx) {
+            const int64_t offset = outer_idx * num_chunks * inner;
+            ReduceRows(partial_min.data() + offset, num_chunks, inner,
+                       dst_min_ptr + outer_idx * inner,
+                       [](scalar_t a, scalar_t b) { return std::min(a, b); });
+            ReduceRows(partial_max.data() + offset, num_chunks, inner,
+                       dst_max_ptr + outer_idx * inner,
+                       [](scalar_t a, scalar_t b) { return std::max(a, b); });
+        }
+    });
+}
+
+/// Running statistics of a set of samples for Welford's algorithm. For each of
+/// the dim variables, mean_ holds the mean, and comoment_ holds the sum of
+/// squared deviations from the mean, or with \p full_covariance, the sum of
+/// products of deviations for every pair of variables (row-major dim x dim).
+class WelfordStatistics {
+public:
+    WelfordStatistics(int64_t dim, bool full_covariance)
+        : dim_(dim),
+          full_covariance_(full_covariance),
+          count_(0),
+          mean_(dim, 0),
+          comoment_(full_covariance ? dim * dim : dim, 0),
+          block_mean_(dim, 0),
+          block_comoment_(comoment_.size(), 0) {}
+
+    /// Adds the samples {num_rows, dim} to the statistics. Blocks of rows are
+    /// centered at their own mean in two passes, and then merged.
+    template <typename scalar_t>
+    void Add(const scalar_t* src, int64_t num_rows) {
+        for (int64_t begin = 0; begin < num_rows; begin += kWelfordBlockSize) {
+            const int64_t end = std::min(begin + kWelfordBlockSize, num_rows);
+            const scalar_t* block = src + begin * dim_;
+            const int64_t block_count = end - begin;
+
+            std::fill(block_mean_.begin(), block_mean_.end(), 0);
+            for (int64_t row = 0; row < block_count; ++row) {
+                for (int64_t j = 0; j < dim_; ++j) {
+                    block_mean_[j] += block[row * dim_ + j];
+                }
+            }
+            for (int64_t j = 0; j < dim_; ++j) {
+                block_mean_[j] /= block_count;
+            }
+
+            std::fill(block_comoment_.begin(), block_comoment_.end(), 0);
+            for (int64_t row = 0; row < block_count; ++row) {
+                const scalar_t* sample = block + row * dim_;
+                if (full_covariance_) {
+                    for (int64_t i = 0; i < dim_; ++i) {
+                        const double di = sample[i] - block_mean_[i];
+                        for (int64_t j = i; j < dim_; ++j) {
+                            block_comoment_[i * dim_ + j] +=
+                                    di * (sample[j] - block_mean_[j]);
+                        }
+                    }
+                } else {
+                    for (int64_t j = 0; j < dim_; ++j) {
+                        const double d = sample[j] - block_mean_[j];
+                        block_comoment_[j] += d * d;
+                    }
+                }
+            }
+            Merge(block_count, block_mean_, block_comoment_);
+        }
+    }
+
+    /// Merges the statistics of another disjoint set of samples, following
+    /// Chan et al., "Updating Formulae and a Pairwise Algorithm for Computing
+    /// Sample Variances", 1979.
+    void Merge(const WelfordStatistics& other) {
+        Merge(other.count_, other.mean_, other.comoment_);
+    }
+
+    /// Writes the mean and the population (co)variance. For an empty set of
+    /// samples, both are NaN.
+    template <typename scalar_t>
+    void Write(scalar_t* dst_mean, scalar_t* dst_var) const {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        for (int64_t j = 0; j < dim_; ++j) {
+            dst_mean[j] = static_cast<scalar_t>(count_ > 0 ? mean_[j] : nan);
+        }
+        const int64_t size = static_cast<int64_t>(comoment_.size());
+        for (int64_t k = 0; k < size; ++k) {
+            double value = comoment_[k];
+            if (full_covariance_) {
+                // Only the upper triangle is accumulated.
+                const int64_t i = k / dim_;
+                const int64_t j = k % dim_;
+                value = comoment_[std::min(i, j) * dim_ + std::max(i, j)];
+            }
+            dst_var[k] = static_cast<scalar_t>(count_ > 0 ? value / count_
+                                                          : nan);
+        }
+    }
+
+private:
+    void Merge(int64_t count,
+               const std::vector<double>& mean,
+               const std::vector<double>& comoment) {
+        if (count == 0) {
+            return;
+        }
+        const int64_t total = count_ + count;
+        const double weight = static_cast<double>(count_) * count / total;
+        for (int64_t i = 0; i < dim_; ++i) {
+            const double delta_i = mean[i] - mean_[i];
+            if (full_covariance_) {
+                for (int64_t j = i; j < dim_; ++j) {
+                    const double delta_j = mean[j] - mean_[j];
+                    comoment_[i * dim_ + j] +=
+                            comoment[i * dim_ + j] + delta_i * delta_j * weight;
+                }
+            } else {
+                comoment_[i] += comoment[i] + delta_i * delta_i * weight;
+            }
+        }
+        for (int64_t i = 0; i < dim_; ++i) {
+            mean_[i] += (mean[i] - mean_[i]) * count / total;
+        }
+        count_ = total;
+    }
+
+    int64_t dim_;
+    bool full_covariance_;
+    int64_t count_;
+    std::vector<double> mean_;
+    std::vector<double> comoment_;
+    std::vector<double> block_mean_;
+    std::vector<double> block_comoment_;
+};
+
+void MeanVarReductionCPU(const Tensor& src,
+                         Tensor& dst_mean,
+                         Tensor& dst_var,
+                         const SizeVector& dims) {
+    ContiguousReduction cr(src, dims);
+    const int64_t reduce = cr.Reduce();
+    const int64_t inner = cr.Inner();
+    const int64_t num_chunks = cr.NumChunks();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_mean_ptr = dst_mean.GetDataPtr<scalar_t>();
+        scalar_t* dst_var_ptr = dst_var.GetDataPtr<scalar_t>();
+        std::vector<WelfordStatistics> partials(
+                cr.Outer() * num_chunks, WelfordStatistics(inner, false));
+        cr.ParallelForChunks([&](int64_t outer_idx, int64_t chunk_idx,
+                                 int64_t row_begin, int64_t row_end) {
+            partials[outer_idx * num_chunks + chunk_idx].Add(
+                    src_ptr + (outer_idx * reduce + row_begin) * inner,
+                    row_end - row_begin);
+        });
+        for (int64_t outer_idx = 0; outer_idx < cr.Outer(); ++outer_idx) {
+            WelfordStatistics& stats = partials[outer_idx * num_chunks];
+            for (int64_t chunk_idx = 1; chunk_idx < num_chunks; ++chunk_idx) {
+                stats.Merge(partials[outer_idx * num_chunks + chunk_idx]);
+            }
+            stats.Write(dst_mean_ptr + outer_idx * inner,
+                        dst_var_ptr + outer_idx * inner);
+        }
+    });
+}
+
+void MeanCovCPU(const Tensor& src, Tensor& dst_mean, Tensor& dst_cov) {
+    ContiguousReduction cr(src, {0});
+    const int64_t dim = cr.Inner();
+    const int64_t num_chunks = cr.NumChunks();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        std::vector<WelfordStatistics> partials(num_chunks,
+                                                WelfordStatistics(dim, true));
+        cr.ParallelForChunks([&](int64_t, int64_t chunk_idx, int64_t row_begin,
+                                 int64_t row_end) {
+            partials[chunk_idx].Add(src_ptr + row_begin * dim,
+                                    row_end - row_begin);
+        });
+        for (int64_t chunk_idx = 1; chunk_idx < num_chunks; ++chunk_idx) {
+            partials[0].Merge(partials[chunk_idx]);
+        }
+        partials[0].Write(dst_mean.GetDataPtr<scalar_t>(),
+                          dst_cov.GetDataPtr<scalar_t>());
+    });
+}
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
+        if (op_code != ReductionOpCode::Prod && src.NumElements() > 0 &&
+            src.IsContiguous() && dst.IsContiguous() &&
+            IsConsecutiveReductionDims(dims, src.NumDims())) {
+            ContiguousReductionCPU(src, dst, dims, op_code);
+            return;
+        }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
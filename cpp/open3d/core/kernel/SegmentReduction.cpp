@@ -0,0 +1,257 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/SegmentReduction.h"
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void CheckValues(const Tensor& values, SegmentReductionOpCode op_code) {
+    if (values.NumDims() == 0) {
+        utility::LogError("values must have at least 1 dimension, but got 0.");
+    }
+    const Dtype dtype = values.GetDtype();
+    if (op_code == SegmentReductionOpCode::Mean && dtype != core::Float32 &&
+        dtype != core::Float64) {
+        utility::LogError(
+                "Mean segment reduction only supports Float32 or Float64, "
+                "but got {}.",
+                dtype.ToString());
+    }
+}
+
+/// Segments longer than this are split into chunks whose partial results are
+/// reduced again. This keeps a few large segments spread over many threads
+/// and accumulates float sums over short runs.
+static constexpr int64_t kSegmentChunkSize = 1024;
+
+/// Runs the device kernel on the contiguous {N, num_cols} values.
+static Tensor LaunchSegmentReduction(const Tensor& values,
+                                     const Tensor& row_splits,
+                                     const Tensor& order,
+                                     SegmentReductionOpCode op_code) {
+    const bool is_arg_op = op_code == SegmentReductionOpCode::ArgMin ||
+                           op_code == SegmentReductionOpCode::ArgMax;
+    Tensor dst = Tensor::Empty({row_splits.GetLength() - 1, values.GetShape(1)},
+                               is_arg_op ? core::Int64 : values.GetDtype(),
+                               values.GetDevice());
+    if (dst.NumElements() == 0) {
+        return dst;
+    }
+    Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReductionCPU(values, row_splits, order, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentReductionCUDA(values, row_splits, order, dst, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduction: Unimplemented device");
+    }
+    return dst;
+}
+
+/// Reduces the contiguous {N, num_cols} values to {S, num_cols}.
+static Tensor ReduceSegments2D(const Tensor& values,
+                               const Tensor& row_splits,
+                               const Tensor& order,
+                               SegmentReductionOpCode op_code) {
+    const Device device = values.GetDevice();
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    const int64_t num_cols = values.GetShape(1);
+    const Tensor lengths = row_splits.Slice(0, 1, num_segments + 1) -
+                           row_splits.Slice(0, 0, num_segments);
+    if (num_segments == 0 || num_cols == 0 ||
+        lengths.Max({0}).Item<int64_t>() <= kSegmentChunkSize) {
+        return LaunchSegmentReduction(values, row_splits, order, op_code);
+    }
+
+    // Split every segment into chunks of at most kSegmentChunkSize rows. The
+    // chunks are built on the host, which only transfers the O(S) splits.
+    const std::vector<int64_t> splits = row_splits.ToFlatVector<int64_t>();
+    std::vector<int64_t> chunk_row_splits;
+    std::vector<int64_t> chunk_splits(num_segments + 1);
+    for (int64_t s = 0; s < num_segments; ++s) {
+        chunk_splits[s] = static_cast<int64_t>(chunk_row_splits.size());
+        for (int64_t row = splits[s]; row < splits[s + 1];
+             row += kSegmentChunkSize) {
+            chunk_row_splits.push_back(row);
+        }
+    }
+    const int64_t num_chunks = static_cast<int64_t>(chunk_row_splits.size());
+    chunk_splits[num_segments] = num_chunks;
+    chunk_row_splits.push_back(splits[num_segments]);
+    const Tensor chunk_row_splits_t(chunk_row_splits, {num_chunks + 1},
+                                    core::Int64, device);
+    const Tensor chunk_splits_t(chunk_splits, {num_segments + 1}, core::Int64,
+                                device);
+
+    switch (op_code) {
+        case SegmentReductionOpCode::Sum:
+        case SegmentReductionOpCode::Min:
+        case SegmentReductionOpCode::Max: {
+            const Tensor partials = LaunchSegmentReduction(
+                    values, chunk_row_splits_t, order, op_code);
+            return ReduceSegments2D(partials, chunk_splits_t, Tensor(),
+                                    op_code);
+        }
+        case SegmentReductionOpCode::Mean: {
+            const Tensor sums = ReduceSegments2D(
+                    values, row_splits, order, SegmentReductionOpCode::Sum);
+            // Empty segments have a zero sum and are divided by 1.
+            const Tensor counts = lengths + lengths.Eq(0).To(core::Int64);
+            return sums / counts.To(values.GetDtype()).View({num_segments, 1});
+        }
+        case SegmentReductionOpCode::ArgMin:
+        case SegmentReductionOpCode::ArgMax: {
+            // The arg rows of the chunks index into values. Reducing the
+            // values at these rows gives the best chunk of each segment, and
+            // ties resolve to the first chunk and thus to the first row.
+            const Tensor cols =
+                    Tensor::Arange(0, num_cols, 1, core::Int64, device);
+            const Tensor partial_rows = LaunchSegmentReduction(
+                    values, chunk_row_splits_t, order, op_code);
+            const Tensor partial_values =
+                    values.View({-1})
+                            .IndexGet({(partial_rows * num_cols + cols)
+                                               .View({-1})})
+                            .View({num_chunks, num_cols});
+            const Tensor best_chunks = ReduceSegments2D(
+                    partial_values, chunk_splits_t, Tensor(), op_code);
+            // Empty segments have no chunk and keep -1.
+            const Tensor valid = best_chunks.Ge(0).To(core::Int64);
+            const Tensor rows =
+                    partial_rows.View({-1})
+                            .IndexGet({(best_chunks * valid * num_cols + cols)
+                                               .View({-1})})
+                            .View({num_segments, num_cols});
+            return rows * valid + valid - 1;
+        }
+        default: {
+            utility::LogError("Unsupported segment reduction op code.");
+        }
+    }
+}
+
+static Tensor ReduceSegments(const Tensor& values,
+                             const Tensor& row_splits,
+                             const Tensor& order,
+                             SegmentReductionOpCode op_code) {
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    if (op_code == SegmentReductionOpCode::Count) {
+        return row_splits.Slice(0, 1, num_segments + 1) -
+               row_splits.Slice(0, 0, num_segments);
+    }
+
+    const SizeVector values_shape = values.GetShape();
+    const int64_t num_cols =
+            SizeVector(values_shape.begin() + 1, values_shape.end())
+                    .NumElements();
+    SizeVector dst_shape = values_shape;
+    dst_shape[0] = num_segments;
+    const Tensor values_2d =
+            values.Contiguous().Reshape({values.GetLength(), num_cols});
+    return ReduceSegments2D(values_2d, row_splits, order, op_code)
+            .Reshape(dst_shape);
+}
+
+Tensor SegmentReduction(const Tensor& values,
+                        const Tensor& segment_ids,
+                        int64_t num_segments,
+                        SegmentReductionOpCode op_code) {
+    CheckValues(values, op_code);
+    const Device device = values.GetDevice();
+    segment_ids.AssertDtype(core::Int64);
+    segment_ids.AssertShape({values.GetLength()});
+    segment_ids.AssertDevice(device);
+    if (num_segments < 0) {
+        utility::LogError("num_segments must be non-negative, but got {}.",
+                          num_segments);
+    }
+
+    const Tensor segment_ids_contiguous = segment_ids.Contiguous();
+    Tensor row_splits;
+    Tensor order;
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentIdsToRowSplitsCPU(segment_ids_contiguous, num_segments,
+                                 row_splits, order);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentIdsToRowSplitsCUDA(segment_ids_contiguous, num_segments,
+                                  row_splits, order);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduction: Unimplemented device");
+    }
+    return ReduceSegments(values, row_splits, order, op_code);
+}
+
+Tensor SegmentReductionRowSplits(const Tensor& values,
+                                 const Tensor& row_splits,
+                                 SegmentReductionOpCode op_code) {
+    CheckValues(values, op_code);
+    row_splits.AssertDtype(core::Int64);
+    row_splits.AssertDevice(values.GetDevice());
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() == 0) {
+        utility::LogError(
+                "row_splits must be a non-empty 1D tensor, but got shape {}.",
+                row_splits.GetShape().ToString());
+    }
+    const Tensor row_splits_contiguous = row_splits.Contiguous();
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    if (num_segments > 0 &&
+        !row_splits_contiguous.Slice(0, 1, num_segments + 1)
+                 .Ge(row_splits_contiguous.Slice(0, 0, num_segments))
+                 .All()) {
+        utility::LogError("row_splits must be non-decreasing.");
+    }
+    const int64_t first = row_splits_contiguous[0].Item<int64_t>();
+    const int64_t last = row_splits_contiguous[num_segments].Item<int64_t>();
+    if (first != 0 || last != values.GetLength()) {
+        utility::LogError(
+                "row_splits must start with 0 and end with {}, but got {} and "
+                "{}.",
+                values.GetLength(), first, last);
+    }
+    return ReduceSegments(values, row_splits_contiguous, Tensor(), op_code);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
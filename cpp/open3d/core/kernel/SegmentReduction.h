@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentReductionOpCode {
+    Sum,
+    Mean,
+    Min,
+    Max,
+    ArgMin,
+    ArgMax,
+    Count,
+};
+
+/// Reduces the rows of \p values grouped by unsorted segment ids, e.g. to
+/// average the attributes of all points falling into the same voxel.
+///
+/// \param values The {N, ...} tensor to reduce along dimension 0.
+/// \param segment_ids The {N} Int64 tensor assigning each row of \p values to
+/// a segment. Rows with ids outside [0, num_segments) are skipped.
+/// \param num_segments The number of output segments S.
+/// \param op_code The reduction to apply within each segment.
+/// \return A {S, ...} tensor. Sum, Mean, Min and Max keep the dtype of \p
+/// values, ArgMin and ArgMax return Int64 row indices into \p values and Count
+/// returns the {S} Int64 number of rows per segment. Empty segments are
+/// reduced to 0, or to -1 for ArgMin and ArgMax.
+Tensor SegmentReduction(const Tensor& values,
+                        const Tensor& segment_ids,
+                        int64_t num_segments,
+                        SegmentReductionOpCode op_code);
+
+/// Reduces the contiguous row ranges [row_splits[s], row_splits[s + 1]) of
+/// \p values, i.e. a ragged tensor with S = row_splits.GetLength() - 1 rows.
+///
+/// \param values The {N, ...} tensor to reduce along dimension 0.
+/// \param row_splits The {S + 1} Int64 exclusive prefix sum of the segment
+/// lengths, with 0 as the first element and N as the last element.
+/// \param op_code The reduction to apply within each segment.
+/// \return A {S, ...} tensor, see SegmentReduction().
+Tensor SegmentReductionRowSplits(const Tensor& values,
+                                 const Tensor& row_splits,
+                                 SegmentReductionOpCode op_code);
+
+// The device kernels below group unsorted segment ids with a stable sort and
+// reduce the contiguous {N, num_cols} values. Segment s consists of the rows
+// order[row_splits[s]], ..., order[row_splits[s + 1] - 1], or of the rows
+// row_splits[s], ..., row_splits[s + 1] - 1 if order is empty. dst is a
+// preallocated {S, num_cols} tensor.
+
+void SegmentIdsToRowSplitsCPU(const Tensor& segment_ids,
+                              int64_t num_segments,
+                              Tensor& row_splits,
+                              Tensor& order);
+
+void SegmentReductionCPU(const Tensor& values,
+                         const Tensor& row_splits,
+                         const Tensor& order,
+                         Tensor& dst,
+                         SegmentReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentIdsToRowSplitsCUDA(const Tensor& segment_ids,
+                               int64_t num_segments,
+                               Tensor& row_splits,
+                               Tensor& order);
+
+void SegmentReductionCUDA(const Tensor& values,
+                          const Tensor& row_splits,
+                          const Tensor& order,
+                          Tensor& dst,
+                          SegmentReductionOpCode op_code);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/SegmentReductionImpl.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Stable counting sort of the rows by segment id. This is a single O(N + S)
+// pass over memory, which is cheaper than sorting and keeps the rows of each
+// segment in their original order.
+void SegmentIdsToRowSplitsCPU(const Tensor& segment_ids,
+                              int64_t num_segments,
+                              Tensor& row_splits,
+                              Tensor& order) {
+    const int64_t num_rows = segment_ids.GetLength();
+    const int64_t* segment_ids_ptr = segment_ids.GetDataPtr<int64_t>();
+
+    row_splits = Tensor::Zeros({num_segments + 1}, core::Int64,
+                               segment_ids.GetDevice());
+    int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const int64_t segment = segment_ids_ptr[i];
+        if (segment >= 0 && segment < num_segments) {
+            ++row_splits_ptr[segment + 1];
+        }
+    }
+    for (int64_t s = 0; s < num_segments; ++s) {
+        row_splits_ptr[s + 1] += row_splits_ptr[s];
+    }
+
+    order = Tensor::Empty({row_splits_ptr[num_segments]}, core::Int64,
+                          segment_ids.GetDevice());
+    int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    std::vector<int64_t> offsets(row_splits_ptr,
+                                 row_splits_ptr + num_segments);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const int64_t segment = segment_ids_ptr[i];
+        if (segment >= 0 && segment < num_segments) {
+            order_ptr[offsets[segment]++] = i;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
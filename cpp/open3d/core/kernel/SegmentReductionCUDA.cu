@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/kernel/SegmentReductionImpl.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Stable sort of the row indices by segment id. Rows with ids outside
+// [0, num_segments) are sorted before row_splits[0] or after
+// row_splits[num_segments] and are therefore never reduced.
+void SegmentIdsToRowSplitsCUDA(const Tensor& segment_ids,
+                               int64_t num_segments,
+                               Tensor& row_splits,
+                               Tensor& order) {
+    const int64_t num_rows = segment_ids.GetLength();
+    const Device device = segment_ids.GetDevice();
+    Tensor sorted_ids = segment_ids.Clone();
+    order = Tensor::Arange(0, num_rows, 1, core::Int64, device);
+    row_splits = Tensor::Empty({num_segments + 1}, core::Int64, device);
+
+    int64_t* sorted_ids_ptr = sorted_ids.GetDataPtr<int64_t>();
+    thrust::stable_sort_by_key(thrust::device, sorted_ids_ptr,
+                               sorted_ids_ptr + num_rows,
+                               order.GetDataPtr<int64_t>());
+    thrust::lower_bound(thrust::device, sorted_ids_ptr,
+                        sorted_ids_ptr + num_rows,
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(num_segments + 1),
+                        row_splits.GetDataPtr<int64_t>());
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#if defined(__CUDACC__)
+namespace launcher = cuda_launcher;
+#else
+namespace launcher = cpu_launcher;
+#endif
+
+/// Returns the row of values holding the \p i-th element of the grouped
+/// segments.
+OPEN3D_HOST_DEVICE inline int64_t GetSegmentRow(const int64_t* order_ptr,
+                                                int64_t i) {
+    return order_ptr == nullptr ? i : order_ptr[i];
+}
+
+// Every workload reduces one column of one segment, so segments are reduced
+// in parallel without atomics and in a deterministic order.
+#if defined(__CUDACC__)
+void SegmentReductionCUDA
+#else
+void SegmentReductionCPU
+#endif
+        (const Tensor& values,
+         const Tensor& row_splits,
+         const Tensor& order,
+         Tensor& dst,
+         SegmentReductionOpCode op_code) {
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    const int64_t num_cols = values.GetShape(1);
+    const int64_t num_workloads = num_segments * num_cols;
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t* order_ptr =
+            order.NumElements() == 0 ? nullptr : order.GetDataPtr<int64_t>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        if (op_code == SegmentReductionOpCode::Sum ||
+            op_code == SegmentReductionOpCode::Mean) {
+            const bool is_mean = op_code == SegmentReductionOpCode::Mean;
+            scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+            launcher::ParallelFor(
+                    num_workloads, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t segment = workload_idx / num_cols;
+                        const int64_t col = workload_idx % num_cols;
+                        const int64_t begin = row_splits_ptr[segment];
+                        const int64_t end = row_splits_ptr[segment + 1];
+                        scalar_t sum = 0;
+                        for (int64_t i = begin; i < end; ++i) {
+                            const int64_t row = GetSegmentRow(order_ptr, i);
+                            sum += values_ptr[row * num_cols + col];
+                        }
+                        if (is_mean && end > begin) {
+                            sum /= static_cast<scalar_t>(end - begin);
+                        }
+                        dst_ptr[workload_idx] = sum;
+                    });
+        } else if (op_code == SegmentReductionOpCode::Min ||
+                   op_code == SegmentReductionOpCode::Max) {
+            const bool is_max = op_code == SegmentReductionOpCode::Max;
+            scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+            launcher::ParallelFor(
+                    num_workloads, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t segment = workload_idx / num_cols;
+                        const int64_t col = workload_idx % num_cols;
+                        const int64_t begin = row_splits_ptr[segment];
+                        const int64_t end = row_splits_ptr[segment + 1];
+                        scalar_t best = 0;
+                        for (int64_t i = begin; i < end; ++i) {
+                            const int64_t row = GetSegmentRow(order_ptr, i);
+                            const scalar_t value =
+                                    values_ptr[row * num_cols + col];
+                            if (i == begin ||
+                                (is_max ? value > best : value < best)) {
+                                best = value;
+                            }
+                        }
+                        dst_ptr[workload_idx] = best;
+                    });
+        } else if (op_code == SegmentReductionOpCode::ArgMin ||
+                   op_code == SegmentReductionOpCode::ArgMax) {
+            const bool is_max = op_code == SegmentReductionOpCode::ArgMax;
+            int64_t* dst_ptr = dst.GetDataPtr<int64_t>();
+            launcher::ParallelFor(
+                    num_workloads, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t segment = workload_idx / num_cols;
+                        const int64_t col = workload_idx % num_cols;
+                        const int64_t begin = row_splits_ptr[segment];
+                        const int64_t end = row_splits_ptr[segment + 1];
+                        scalar_t best = 0;
+                        int64_t best_row = -1;
+                        for (int64_t i = begin; i < end; ++i) {
+                            const int64_t row = GetSegmentRow(order_ptr, i);
+                            const scalar_t value =
+                                    values_ptr[row * num_cols + col];
+                            if (best_row < 0 ||
+                                (is_max ? value > best : value < best)) {
+                                best = value;
+                                best_row = row;
+                            }
+                        }
+                        dst_ptr[workload_idx] = best_row;
+                    });
+        } else {
+            utility::LogError("Unsupported segment reduction op code.");
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -29,12 +29,18 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "core", "UnaryEW", src.GetDevice().ToString(),
+            src.NumElements() * src.GetDtype().ByteSize() +
+                    dst.NumElements() * dst.GetDtype().ByteSize(),
+            dst.NumElements());
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -42,12 +42,32 @@ namespace core {
 namespace kernel {
 
 template <typename func_t>
+static void LaunchStridedUnaryEWKernel(const Indexer& indexer,
+                                       const func_t& func) {
+    DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+        cpu_launcher::ParallelFor(
+                indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [&indexer, &func](int64_t i) {
+                    func(indexer.GetInputPtr<kNDims>(0, i),
+                         indexer.GetOutputPtr<kNDims>(i));
+                });
+    });
+}
+
+template <typename src_t, typename dst_t, typename func_t>
 static void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
-    cpu_launcher::ParallelFor(
-            indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
-            [&indexer, &func](int64_t i) {
-                func(indexer.GetInputPtr(0, i), indexer.GetOutputPtr(i));
-            });
+    if (indexer.IsContiguous()) {
+        // Workload i is the i-th element of both operands, so the offsets
+        // reduce to typed pointer increments.
+        const src_t* src =
+                static_cast<const src_t*>(indexer.GetInput(0).data_ptr_);
+        dst_t* dst = static_cast<dst_t*>(indexer.GetOutput().data_ptr_);
+        cpu_launcher::ParallelFor(
+                indexer.NumWorkloads(), cpu_launcher::SMALL_OP_GRAIN_SIZE,
+                [src, dst, &func](int64_t i) { func(src + i, dst + i); });
+    } else {
+        LaunchStridedUnaryEWKernel(indexer, func);
+    }
 }
 
 template <typename src_t, typename dst_t>
@@ -175,17 +195,18 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
         if (src.GetDtype().IsObject()) {
             int64_t object_byte_size = src.GetDtype().ByteSize();
-            LaunchUnaryEWKernel(indexer, [&](const void* src, void* dst) {
-                CPUCopyObjectElementKernel(src, dst, object_byte_size);
-            });
+            LaunchStridedUnaryEWKernel(
+                    indexer, [&](const void* src, void* dst) {
+                        CPUCopyObjectElementKernel(src, dst, object_byte_size);
+                    });
 
         } else {
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
                 using src_t = scalar_t;
                 DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
                     using dst_t = scalar_t;
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUCopyElementKernel<src_t, dst_t>);
+                    LaunchUnaryEWKernel<src_t, dst_t>(
+                            indexer, CPUCopyElementKernel<src_t, dst_t>);
                 });
             });
         }
@@ -209,14 +230,14 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-                LaunchUnaryEWKernel(
+                LaunchUnaryEWKernel<scalar_t, scalar_t>(
                         indexer,
                         CPULogicalNotElementKernel<scalar_t, scalar_t>);
             } else if (dst_dtype == core::Bool) {
                 Indexer indexer({src}, dst,
                                 DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                LaunchUnaryEWKernel(indexer,
-                                    CPULogicalNotElementKernel<scalar_t, bool>);
+                LaunchUnaryEWKernel<scalar_t, bool>(
+                        indexer, CPULogicalNotElementKernel<scalar_t, bool>);
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -230,13 +251,15 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
-                LaunchUnaryEWKernel(indexer, CPUIsNanElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool>(
+                        indexer, CPUIsNanElementKernel<scalar_t>);
             } else if (op_code == UnaryEWOpCode::IsInf) {
-                LaunchUnaryEWKernel(indexer, CPUIsInfElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool>(
+                        indexer, CPUIsInfElementKernel<scalar_t>);
 
             } else if (op_code == UnaryEWOpCode::IsFinite) {
-                LaunchUnaryEWKernel(indexer,
-                                    CPUIsFiniteElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool>(
+                        indexer, CPUIsFiniteElementKernel<scalar_t>);
             }
         });
     } else {
@@ -245,42 +268,47 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUSqrtElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUSqrtElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUSinElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUSinElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUCosElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUCosElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Neg:
-                    LaunchUnaryEWKernel(indexer, CPUNegElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUNegElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel(indexer, CPUExpElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUExpElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Abs:
-                    LaunchUnaryEWKernel(indexer, CPUAbsElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUAbsElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Floor:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUFloorElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUFloorElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Ceil:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUCeilElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUCeilElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Round:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPURoundElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPURoundElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Trunc:
-                    LaunchUnaryEWKernel(indexer,
-                                        CPUTruncElementKernel<scalar_t>);
+                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
+                            indexer, CPUTruncElementKernel<scalar_t>);
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
@@ -37,13 +37,22 @@ namespace kernel {
 
 // Cannot be a static function since on Windows a function enclosing
 // __host__ __device__ lambda function must have external linkage.
-template <typename func_t>
-void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& element_kernel) {
-    OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
+template <int64_t NDIMS, typename func_t>
+void LaunchUnaryEWKernelNDims(const Indexer& indexer,
+                              const func_t& element_kernel) {
     auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
-        element_kernel(indexer.GetInputPtr(0, i), indexer.GetOutputPtr(i));
+        element_kernel(indexer.GetInputPtr<NDIMS>(0, i),
+                       indexer.GetOutputPtr<NDIMS>(i));
     };
     cuda_launcher::ParallelFor(indexer.NumWorkloads(), element_func);
+}
+
+template <typename func_t>
+void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& element_kernel) {
+    OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
+    DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+        LaunchUnaryEWKernelNDims<kNDims>(indexer, element_kernel);
+    });
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
 }
 
@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/Batched.h"
+
+#include <algorithm>
+
+#include "open3d/core/linalg/Inverse.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
+
+namespace open3d {
+namespace core {
+
+static void CheckBatchedDtype(const Dtype& dtype) {
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        utility::LogError(
+                "Only tensors with Float32 or Float64 are supported, but "
+                "received {}.",
+                dtype.ToString());
+    }
+}
+
+/// Returns the leading batch dimensions of a tensor holding matrices in its
+/// last num_matrix_dims dimensions.
+static SizeVector GetBatchShape(const Tensor& A,
+                                const std::string& name,
+                                int64_t num_matrix_dims = 2) {
+    SizeVector shape = A.GetShape();
+    if (static_cast<int64_t>(shape.size()) < num_matrix_dims) {
+        utility::LogError("Tensor {} must be at least {}D, but got {}D.", name,
+                          num_matrix_dims, shape.size());
+    }
+    return SizeVector(shape.begin(), shape.end() - num_matrix_dims);
+}
+
+static SizeVector BatchedShape(const SizeVector& batch_shape,
+                               const SizeVector& matrix_shape) {
+    SizeVector shape = batch_shape;
+    shape.insert(shape.end(), matrix_shape.begin(), matrix_shape.end());
+    return shape;
+}
+
+static void CheckSquare(int64_t m, int64_t n, const std::string& name) {
+    if (m != n) {
+        utility::LogError("Tensor {} must be square, but got {} x {}.", name,
+                          m, n);
+    }
+    if (n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+}
+
+static bool UseSmallMatrixKernel(int64_t n) {
+    return n <= kMaxSmallMatrixSize;
+}
+
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    Device device = A.GetDevice();
+    if (device != B.GetDevice()) {
+        utility::LogError("Tensor A device {} and Tensor B device {} mismatch.",
+                          A.GetDevice().ToString(), B.GetDevice().ToString());
+    }
+    Dtype dtype = A.GetDtype();
+    if (dtype != B.GetDtype()) {
+        utility::LogError("Tensor A dtype {} and Tensor B dtype {} mismatch.",
+                          A.GetDtype().ToString(), B.GetDtype().ToString());
+    }
+    CheckBatchedDtype(dtype);
+
+    SizeVector batch_shape = GetBatchShape(A, "A");
+    if (GetBatchShape(B, "B") != batch_shape) {
+        utility::LogError("Tensor A batch shape {} mismatch with Tensor B {}.",
+                          A.GetShape().ToString(), B.GetShape().ToString());
+    }
+    int64_t m = A.GetShape(-2), k = A.GetShape(-1);
+    int64_t n = B.GetShape(-1);
+    if (B.GetShape(-2) != k) {
+        utility::LogError("Tensor A columns {} mismatch with Tensor B rows {}.",
+                          k, B.GetShape(-2));
+    }
+    if (m == 0 || k == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+
+    int64_t batch_size = batch_shape.NumElements();
+    output = Tensor::Empty({batch_size, m, n}, dtype, device);
+    if (batch_size > 0) {
+        Tensor A_flat = A.Contiguous().Reshape({batch_size, m, k});
+        Tensor B_flat = B.Contiguous().Reshape({batch_size, k, n});
+        if (UseSmallMatrixKernel(std::max({m, k, n}))) {
+            if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+                BatchedMatmulCUDA(A_flat, B_flat, output);
+#else
+                utility::LogError("Unimplemented device.");
+#endif
+            } else {
+                BatchedMatmulCPU(A_flat, B_flat, output);
+            }
+        } else {
+            for (int64_t i = 0; i < batch_size; ++i) {
+                Tensor output_i;
+                Matmul(A_flat[i], B_flat[i], output_i);
+                output[i] = output_i;
+            }
+        }
+    }
+    output = output.Reshape(BatchedShape(batch_shape, {m, n}));
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    CheckBatchedDtype(dtype);
+
+    SizeVector batch_shape = GetBatchShape(A, "A");
+    int64_t n = A.GetShape(-1);
+    CheckSquare(A.GetShape(-2), n, "A");
+
+    int64_t batch_size = batch_shape.NumElements();
+    output = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (batch_size > 0) {
+        Tensor A_flat = A.Contiguous().Reshape({batch_size, n, n});
+        if (UseSmallMatrixKernel(n)) {
+            Tensor singular = Tensor::Empty({batch_size}, core::Bool, device);
+            if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+                BatchedInverseCUDA(A_flat, output, singular);
+#else
+                utility::LogError("Unimplemented device.");
+#endif
+            } else {
+                BatchedInverseCPU(A_flat, output, singular);
+            }
+            if (singular.Any()) {
+                utility::LogError(
+                        "BatchedInverse: singular condition detected.");
+            }
+        } else {
+            for (int64_t i = 0; i < batch_size; ++i) {
+                Tensor output_i;
+                Inverse(A_flat[i], output_i);
+                output[i] = output_i;
+            }
+        }
+    }
+    output = output.Reshape(BatchedShape(batch_shape, {n, n}));
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    Device device = A.GetDevice();
+    if (device != B.GetDevice()) {
+        utility::LogError("Tensor A device {} and Tensor B device {} mismatch.",
+                          A.GetDevice().ToString(), B.GetDevice().ToString());
+    }
+    Dtype dtype = A.GetDtype();
+    if (dtype != B.GetDtype()) {
+        utility::LogError("Tensor A dtype {} and Tensor B dtype {} mismatch.",
+                          A.GetDtype().ToString(), B.GetDtype().ToString());
+    }
+    CheckBatchedDtype(dtype);
+
+    SizeVector batch_shape = GetBatchShape(A, "A");
+    int64_t n = A.GetShape(-1);
+    CheckSquare(A.GetShape(-2), n, "A");
+
+    // B is either a batch of vectors {..., n} or of matrices {..., n, k}.
+    bool B_is_vector = B.NumDims() == A.NumDims() - 1;
+    SizeVector B_batch_shape = GetBatchShape(B, "B", B_is_vector ? 1 : 2);
+    if (B_batch_shape != batch_shape) {
+        utility::LogError("Tensor A batch shape {} mismatch with Tensor B {}.",
+                          A.GetShape().ToString(), B.GetShape().ToString());
+    }
+    int64_t B_rows = B_is_vector ? B.GetShape(-1) : B.GetShape(-2);
+    int64_t k = B_is_vector ? 1 : B.GetShape(-1);
+    if (B_rows != n) {
+        utility::LogError("Tensor A and B's row dimensions {} and {} mismatch.",
+                          n, B_rows);
+    }
+    if (k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+
+    int64_t batch_size = batch_shape.NumElements();
+    X = Tensor::Empty({batch_size, n, k}, dtype, device);
+    if (batch_size > 0) {
+        Tensor A_flat = A.Contiguous().Reshape({batch_size, n, n});
+        Tensor B_flat = B.Contiguous().Reshape({batch_size, n, k});
+        if (UseSmallMatrixKernel(n)) {
+            Tensor singular = Tensor::Empty({batch_size}, core::Bool, device);
+            if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+                BatchedSolveCUDA(A_flat, B_flat, X, singular);
+#else
+                utility::LogError("Unimplemented device.");
+#endif
+            } else {
+                BatchedSolveCPU(A_flat, B_flat, X, singular);
+            }
+            if (singular.Any()) {
+                utility::LogError("BatchedSolve: singular condition detected.");
+            }
+        } else {
+            for (int64_t i = 0; i < batch_size; ++i) {
+                Tensor X_i;
+                Solve(A_flat[i], B_flat[i], X_i);
+                X[i] = X_i;
+            }
+        }
+    }
+    X = X.Reshape(B.GetShape());
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    CheckBatchedDtype(dtype);
+
+    SizeVector batch_shape = GetBatchShape(A, "A");
+    int64_t m = A.GetShape(-2), n = A.GetShape(-1);
+    if (m == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (m < n) {
+        utility::LogError("Only support m >= n, but got {} and {} matrix", m,
+                          n);
+    }
+
+    int64_t batch_size = batch_shape.NumElements();
+    U = Tensor::Empty({batch_size, m, m}, dtype, device);
+    S = Tensor::Empty({batch_size, n}, dtype, device);
+    VT = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (batch_size > 0) {
+        Tensor A_flat = A.Contiguous().Reshape({batch_size, m, n});
+        // The fused kernel handles square matrices only.
+        if (m == n && UseSmallMatrixKernel(n)) {
+            if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+                BatchedSVDCUDA(A_flat, U, S, VT);
+#else
+                utility::LogError("Unimplemented device.");
+#endif
+            } else {
+                BatchedSVDCPU(A_flat, U, S, VT);
+            }
+        } else {
+            for (int64_t i = 0; i < batch_size; ++i) {
+                Tensor U_i, S_i, VT_i;
+                SVD(A_flat[i], U_i, S_i, VT_i);
+                U[i] = U_i;
+                S[i] = S_i;
+                VT[i] = VT_i;
+            }
+        }
+    }
+    U = U.Reshape(BatchedShape(batch_shape, {m, m}));
+    S = S.Reshape(BatchedShape(batch_shape, {n}));
+    VT = VT.Reshape(BatchedShape(batch_shape, {n, n}));
+}
+
+void BatchedEigh(const Tensor& A, Tensor& eigenvalues, Tensor& eigenvectors) {
+    Device device = A.GetDevice();
+    Dtype dtype = A.GetDtype();
+    CheckBatchedDtype(dtype);
+
+    SizeVector batch_shape = GetBatchShape(A, "A");
+    int64_t n = A.GetShape(-1);
+    CheckSquare(A.GetShape(-2), n, "A");
+    if (!UseSmallMatrixKernel(n)) {
+        utility::LogError("BatchedEigh supports matrices up to {} x {}, but "
+                          "got {} x {}.",
+                          kMaxSmallMatrixSize, kMaxSmallMatrixSize, n, n);
+    }
+
+    int64_t batch_size = batch_shape.NumElements();
+    eigenvalues = Tensor::Empty({batch_size, n}, dtype, device);
+    eigenvectors = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (batch_size > 0) {
+        Tensor A_flat = A.Contiguous().Reshape({batch_size, n, n});
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            BatchedEighCUDA(A_flat, eigenvalues, eigenvectors);
+#else
+            utility::LogError("Unimplemented device.");
+#endif
+        } else {
+            BatchedEighCPU(A_flat, eigenvalues, eigenvectors);
+        }
+    }
+    eigenvalues = eigenvalues.Reshape(BatchedShape(batch_shape, {n}));
+    eigenvectors = eigenvectors.Reshape(BatchedShape(batch_shape, {n, n}));
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Largest matrix size handled by the fused small-matrix kernels. Batched
+/// operations on larger matrices fall back to one LAPACK/cuSOLVER call per
+/// batch element.
+constexpr int64_t kMaxSmallMatrixSize = 8;
+
+/// Computes the batched matrix product output[i] = A[i] B[i], where A is a
+/// {..., m, k} tensor and B is a {..., k, n} tensor with the same leading batch
+/// dimensions. The output is a {..., m, n} tensor.
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& output);
+
+/// Computes the inverse of every matrix in a {..., n, n} tensor.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Solves the linear systems A[i] X[i] = B[i], where A is a {..., n, n}
+/// tensor and B is a {..., n} or {..., n, k} tensor with the same leading batch
+/// dimensions.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Computes the SVD A[i] = U[i] S[i] VT[i] of every matrix in a {..., m, n}
+/// tensor with m >= n. U is {..., m, m}, S is {..., n} and VT is {..., n, n}.
+/// Singular values are sorted in descending order.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+/// Computes the eigendecomposition A[i] = V[i] diag(w[i]) V[i]^T of every
+/// symmetric matrix in a {..., n, n} tensor, with n <= kMaxSmallMatrixSize.
+/// Only the upper triangle is read. The eigenvalues w are a {..., n} tensor in
+/// ascending order and the eigenvectors V are the columns of a {..., n, n}
+/// tensor.
+void BatchedEigh(const Tensor& A, Tensor& eigenvalues, Tensor& eigenvectors);
+
+// The device kernels below operate on contiguous {batch_size, ...} tensors
+// with matrix sizes up to kMaxSmallMatrixSize and preallocated outputs.
+// singular is a {batch_size} Bool tensor set for singular input matrices.
+
+void BatchedMatmulCPU(const Tensor& A, const Tensor& B, Tensor& output);
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output, Tensor& singular);
+
+void BatchedSolveCPU(const Tensor& A,
+                     const Tensor& B,
+                     Tensor& X,
+                     Tensor& singular);
+
+void BatchedSVDCPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+void BatchedEighCPU(const Tensor& A, Tensor& eigenvalues, Tensor& eigenvectors);
+
+#ifdef BUILD_CUDA_MODULE
+void BatchedMatmulCUDA(const Tensor& A, const Tensor& B, Tensor& output);
+
+void BatchedInverseCUDA(const Tensor& A, Tensor& output, Tensor& singular);
+
+void BatchedSolveCUDA(const Tensor& A,
+                      const Tensor& B,
+                      Tensor& X,
+                      Tensor& singular);
+
+void BatchedSVDCUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+void BatchedEighCUDA(const Tensor& A,
+                     Tensor& eigenvalues,
+                     Tensor& eigenvectors);
+#endif
+
+}  // namespace core
+}  // namespace open3d
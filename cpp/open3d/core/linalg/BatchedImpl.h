@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/Batched.h"
+#include "open3d/core/linalg/kernel/SmallMatrix.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Dispatches a runtime matrix size in [1, kMaxSmallMatrixSize] to the
+/// compile-time constant kN.
+#define DISPATCH_SMALL_MATRIX_SIZE(N, ...)                                  \
+    [&] {                                                                   \
+        switch (N) {                                                        \
+            case 1: {                                                       \
+                constexpr int kN = 1;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 2: {                                                       \
+                constexpr int kN = 2;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 3: {                                                       \
+                constexpr int kN = 3;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 4: {                                                       \
+                constexpr int kN = 4;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 5: {                                                       \
+                constexpr int kN = 5;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 6: {                                                       \
+                constexpr int kN = 6;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 7: {                                                       \
+                constexpr int kN = 7;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            case 8: {                                                       \
+                constexpr int kN = 8;                                       \
+                return __VA_ARGS__();                                       \
+            }                                                               \
+            default: {                                                      \
+                utility::LogError("Unsupported small matrix size {}.", N); \
+            }                                                               \
+        }                                                                   \
+    }()
+
+#if defined(__CUDACC__)
+namespace launcher = kernel::cuda_launcher;
+#else
+namespace launcher = kernel::cpu_launcher;
+#endif
+
+#if defined(__CUDACC__)
+void BatchedMatmulCUDA
+#else
+void BatchedMatmulCPU
+#endif
+        (const Tensor& A, const Tensor& B, Tensor& output) {
+    const int64_t batch_size = A.GetShape(0);
+    const int64_t m = A.GetShape(1);
+    const int64_t n = B.GetShape(2);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+        scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+        DISPATCH_SMALL_MATRIX_SIZE(A.GetShape(2), [&]() {
+            launcher::ParallelFor(
+                    batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        linalg::kernel::matmul_mxk_kxn<scalar_t, kN>(
+                                A_ptr + workload_idx * m * kN,
+                                B_ptr + workload_idx * kN * n,
+                                output_ptr + workload_idx * m * n, m, n);
+                    });
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedInverseCUDA
+#else
+void BatchedInverseCPU
+#endif
+        (const Tensor& A, Tensor& output, Tensor& singular) {
+    const int64_t batch_size = A.GetShape(0);
+    bool* singular_ptr = singular.GetDataPtr<bool>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+        DISPATCH_SMALL_MATRIX_SIZE(A.GetShape(1), [&]() {
+            launcher::ParallelFor(
+                    batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t offset = workload_idx * kN * kN;
+                        singular_ptr[workload_idx] =
+                                !linalg::kernel::inverse_nxn<scalar_t, kN>(
+                                        A_ptr + offset, output_ptr + offset);
+                    });
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedSolveCUDA
+#else
+void BatchedSolveCPU
+#endif
+        (const Tensor& A, const Tensor& B, Tensor& X, Tensor& singular) {
+    const int64_t batch_size = A.GetShape(0);
+    const int64_t k = B.GetShape(2);
+    bool* singular_ptr = singular.GetDataPtr<bool>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+        scalar_t* X_ptr = X.GetDataPtr<scalar_t>();
+        DISPATCH_SMALL_MATRIX_SIZE(A.GetShape(1), [&]() {
+            launcher::ParallelFor(
+                    batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        singular_ptr[workload_idx] =
+                                !linalg::kernel::solve_nxn<scalar_t, kN>(
+                                        A_ptr + workload_idx * kN * kN,
+                                        B_ptr + workload_idx * kN * k,
+                                        X_ptr + workload_idx * kN * k, k);
+                    });
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedSVDCUDA
+#else
+void BatchedSVDCPU
+#endif
+        (const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const int64_t batch_size = A.GetShape(0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        scalar_t* U_ptr = U.GetDataPtr<scalar_t>();
+        scalar_t* S_ptr = S.GetDataPtr<scalar_t>();
+        scalar_t* VT_ptr = VT.GetDataPtr<scalar_t>();
+        DISPATCH_SMALL_MATRIX_SIZE(A.GetShape(1), [&]() {
+            launcher::ParallelFor(
+                    batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t offset = workload_idx * kN * kN;
+                        scalar_t V[kN * kN];
+                        linalg::kernel::svd_nxn<scalar_t, kN>(
+                                A_ptr + offset, U_ptr + offset,
+                                S_ptr + workload_idx * kN, V);
+                        for (int i = 0; i < kN; ++i) {
+                            for (int j = 0; j < kN; ++j) {
+                                VT_ptr[offset + i * kN + j] = V[j * kN + i];
+                            }
+                        }
+                    });
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedEighCUDA
+#else
+void BatchedEighCPU
+#endif
+        (const Tensor& A, Tensor& eigenvalues, Tensor& eigenvectors) {
+    const int64_t batch_size = A.GetShape(0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        scalar_t* w_ptr = eigenvalues.GetDataPtr<scalar_t>();
+        scalar_t* V_ptr = eigenvectors.GetDataPtr<scalar_t>();
+        DISPATCH_SMALL_MATRIX_SIZE(A.GetShape(1), [&]() {
+            launcher::ParallelFor(
+                    batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t offset = workload_idx * kN * kN;
+                        linalg::kernel::eigh_nxn<scalar_t, kN>(
+                                A_ptr + offset, w_ptr + workload_idx * kN,
+                                V_ptr + offset);
+                    });
+        });
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
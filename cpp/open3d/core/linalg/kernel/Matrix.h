@@ -114,15 +114,15 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE scalar_t det3x3(const scalar_t* A_3x3) {
 template <typename scalar_t>
 OPEN3D_DEVICE OPEN3D_FORCE_INLINE bool inverse2x2(const scalar_t* A_2x2,
                                                   scalar_t* output_2x2) {
-    scalar_t det = det3x3(A_2x2);
-    if (det < 1e-12) {
+    scalar_t det = det2x2(A_2x2);
+    if (det < 1e-12 && det > -1e-12) {
         return false;
     } else {
         scalar_t invdet = 1.0 / det;
-        output_2x2[0] = A_2x2[3] * det;
-        output_2x2[1] = -A_2x2[1] * det;
-        output_2x2[2] = -A_2x2[2] * det;
-        output_2x2[3] = A_2x2[0] * det;
+        output_2x2[0] = A_2x2[3] * invdet;
+        output_2x2[1] = -A_2x2[1] * invdet;
+        output_2x2[2] = -A_2x2[2] * invdet;
+        output_2x2[3] = A_2x2[0] * invdet;
     }
     return true;
 }
@@ -132,7 +132,7 @@ template <typename scalar_t>
 OPEN3D_DEVICE OPEN3D_FORCE_INLINE bool inverse3x3(const scalar_t* A_3x3,
                                                   scalar_t* output_3x3) {
     scalar_t det = det3x3(A_3x3);
-    if (det < 1e-12) {
+    if (det < 1e-12 && det > -1e-12) {
         return false;
     } else {
         scalar_t invdet = 1.0 / det;
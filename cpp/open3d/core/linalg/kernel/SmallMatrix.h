@@ -0,0 +1,445 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+
+// Small dense matrix routines for batched linear algebra. All matrices are
+// row-major, and the matrix size N is a compile-time constant so that the
+// loops can be fully unrolled by the compiler. Each routine works on a single
+// matrix and is meant to be called once per batch element from a CPU or CUDA
+// kernel.
+
+namespace open3d {
+namespace core {
+namespace linalg {
+namespace kernel {
+
+/// Maximum number of Jacobi sweeps for eigen and singular value
+/// decompositions. Convergence is quadratic, so a handful of sweeps is
+/// usually enough for the sizes handled here.
+static constexpr int kMaxJacobiSweeps = 32;
+
+template <typename scalar_t>
+OPEN3D_DEVICE OPEN3D_FORCE_INLINE scalar_t abs_small(scalar_t x) {
+    return x < 0 ? -x : x;
+}
+
+/// Machine epsilon of scalar_t, usable in device code.
+template <typename scalar_t>
+OPEN3D_DEVICE OPEN3D_FORCE_INLINE scalar_t epsilon_small() {
+    return sizeof(scalar_t) == sizeof(float)
+                   ? static_cast<scalar_t>(1.1920928955078125e-7)
+                   : static_cast<scalar_t>(2.220446049250313e-16);
+}
+
+// ---- Matmul ----
+/// C = A * B, where A is M x K, B is K x N and C is M x N.
+template <typename scalar_t, int K>
+OPEN3D_DEVICE OPEN3D_FORCE_INLINE void matmul_mxk_kxn(const scalar_t* A,
+                                                      const scalar_t* B,
+                                                      scalar_t* C,
+                                                      int64_t m,
+                                                      int64_t n) {
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t sum = 0;
+            for (int k = 0; k < K; ++k) {
+                sum += A[i * K + k] * B[k * n + j];
+            }
+            C[i * n + j] = sum;
+        }
+    }
+}
+
+// ---- LU ----
+/// In-place LU factorization with partial pivoting, P A = L U. The unit lower
+/// triangle L and the upper triangle U overwrite A, and perm holds the row
+/// permutation P. Returns false if A is singular.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE bool lu_nxn_(scalar_t* A, int* perm) {
+    for (int i = 0; i < N; ++i) {
+        perm[i] = i;
+    }
+    for (int k = 0; k < N; ++k) {
+        int pivot = k;
+        scalar_t pivot_abs = abs_small(A[k * N + k]);
+        for (int i = k + 1; i < N; ++i) {
+            scalar_t candidate = abs_small(A[i * N + k]);
+            if (candidate > pivot_abs) {
+                pivot = i;
+                pivot_abs = candidate;
+            }
+        }
+        if (pivot_abs == 0) {
+            return false;
+        }
+        if (pivot != k) {
+            for (int j = 0; j < N; ++j) {
+                scalar_t tmp = A[k * N + j];
+                A[k * N + j] = A[pivot * N + j];
+                A[pivot * N + j] = tmp;
+            }
+            int tmp = perm[k];
+            perm[k] = perm[pivot];
+            perm[pivot] = tmp;
+        }
+        scalar_t inv_pivot = 1 / A[k * N + k];
+        for (int i = k + 1; i < N; ++i) {
+            scalar_t factor = A[i * N + k] * inv_pivot;
+            A[i * N + k] = factor;
+            for (int j = k + 1; j < N; ++j) {
+                A[i * N + j] -= factor * A[k * N + j];
+            }
+        }
+    }
+    return true;
+}
+
+/// Solves A x = b given the output of lu_nxn_. b and x are strided vectors of
+/// length N and may alias.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE void lu_solve_nxn(const scalar_t* LU,
+                                const int* perm,
+                                const scalar_t* b,
+                                int64_t b_stride,
+                                scalar_t* x,
+                                int64_t x_stride) {
+    scalar_t y[N];
+    for (int i = 0; i < N; ++i) {
+        scalar_t sum = b[perm[i] * b_stride];
+        for (int j = 0; j < i; ++j) {
+            sum -= LU[i * N + j] * y[j];
+        }
+        y[i] = sum;
+    }
+    for (int i = N - 1; i >= 0; --i) {
+        scalar_t sum = y[i];
+        for (int j = i + 1; j < N; ++j) {
+            sum -= LU[i * N + j] * y[j];
+        }
+        y[i] = sum / LU[i * N + i];
+    }
+    for (int i = 0; i < N; ++i) {
+        x[i * x_stride] = y[i];
+    }
+}
+
+// ---- Inverse ----
+/// Computes the inverse of an N x N matrix. Uses the closed form for N <= 3
+/// and LU factorization otherwise. Returns false if A is singular.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE bool inverse_nxn(const scalar_t* A, scalar_t* output) {
+    if (N == 1) {
+        if (A[0] == 0) {
+            return false;
+        }
+        output[0] = 1 / A[0];
+        return true;
+    } else if (N == 2) {
+        return inverse2x2(A, output);
+    } else if (N == 3) {
+        return inverse3x3(A, output);
+    }
+
+    scalar_t LU[N * N];
+    int perm[N];
+    for (int i = 0; i < N * N; ++i) {
+        LU[i] = A[i];
+    }
+    if (!lu_nxn_<scalar_t, N>(LU, perm)) {
+        return false;
+    }
+    // Solve for the columns of the identity. lu_solve_nxn applies the row
+    // permutation, so column j of the identity is read from a unit vector.
+    for (int j = 0; j < N; ++j) {
+        scalar_t e[N];
+        for (int i = 0; i < N; ++i) {
+            e[i] = i == j ? 1 : 0;
+        }
+        lu_solve_nxn<scalar_t, N>(LU, perm, e, 1, output + j, N);
+    }
+    return true;
+}
+
+// ---- Solve ----
+/// Solves A X = B, where A is N x N and B, X are N x k. B and X may alias.
+/// Returns false if A is singular.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE bool solve_nxn(const scalar_t* A,
+                             const scalar_t* B,
+                             scalar_t* X,
+                             int64_t k) {
+    scalar_t LU[N * N];
+    int perm[N];
+    for (int i = 0; i < N * N; ++i) {
+        LU[i] = A[i];
+    }
+    if (!lu_nxn_<scalar_t, N>(LU, perm)) {
+        return false;
+    }
+    for (int64_t j = 0; j < k; ++j) {
+        lu_solve_nxn<scalar_t, N>(LU, perm, B + j, k, X + j, k);
+    }
+    return true;
+}
+
+// ---- Symmetric eigendecomposition ----
+/// Computes A = V diag(w) V^T for a symmetric N x N matrix with the cyclic
+/// Jacobi method. Only the upper triangle of A is read. Eigenvalues are
+/// sorted in ascending order and V holds the eigenvectors as columns.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE void eigh_nxn(const scalar_t* A, scalar_t* w, scalar_t* V) {
+    scalar_t a[N * N];
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            a[i * N + j] = i <= j ? A[i * N + j] : A[j * N + i];
+            V[i * N + j] = i == j ? 1 : 0;
+        }
+    }
+
+    const scalar_t eps = epsilon_small<scalar_t>();
+    for (int sweep = 0; sweep < kMaxJacobiSweeps; ++sweep) {
+        scalar_t off = 0, diag = 0;
+        for (int i = 0; i < N; ++i) {
+            diag += a[i * N + i] * a[i * N + i];
+            for (int j = i + 1; j < N; ++j) {
+                off += a[i * N + j] * a[i * N + j];
+            }
+        }
+        if (off <= eps * eps * diag || off == 0) {
+            break;
+        }
+
+        for (int p = 0; p < N; ++p) {
+            for (int q = p + 1; q < N; ++q) {
+                scalar_t apq = a[p * N + q];
+                if (apq == 0) {
+                    continue;
+                }
+                scalar_t theta = (a[q * N + q] - a[p * N + p]) / (2 * apq);
+                scalar_t t = 1 / (abs_small(theta) + sqrt(theta * theta + 1));
+                if (theta < 0) {
+                    t = -t;
+                }
+                scalar_t c = 1 / sqrt(t * t + 1);
+                scalar_t s = t * c;
+                for (int k = 0; k < N; ++k) {
+                    scalar_t akp = a[k * N + p], akq = a[k * N + q];
+                    a[k * N + p] = c * akp - s * akq;
+                    a[k * N + q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < N; ++k) {
+                    scalar_t apk = a[p * N + k], aqk = a[q * N + k];
+                    a[p * N + k] = c * apk - s * aqk;
+                    a[q * N + k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < N; ++k) {
+                    scalar_t vkp = V[k * N + p], vkq = V[k * N + q];
+                    V[k * N + p] = c * vkp - s * vkq;
+                    V[k * N + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < N; ++i) {
+        w[i] = a[i * N + i];
+    }
+    // Selection sort, ascending.
+    for (int i = 0; i < N - 1; ++i) {
+        int min_idx = i;
+        for (int j = i + 1; j < N; ++j) {
+            if (w[j] < w[min_idx]) {
+                min_idx = j;
+            }
+        }
+        if (min_idx != i) {
+            scalar_t tmp = w[i];
+            w[i] = w[min_idx];
+            w[min_idx] = tmp;
+            for (int k = 0; k < N; ++k) {
+                tmp = V[k * N + i];
+                V[k * N + i] = V[k * N + min_idx];
+                V[k * N + min_idx] = tmp;
+            }
+        }
+    }
+}
+
+// ---- SVD ----
+/// Sorts singular values in descending order together with the columns of U
+/// and V, after flipping the sign of negative singular values into U.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE void sort_svd_nxn_(scalar_t* U, scalar_t* S, scalar_t* V) {
+    for (int j = 0; j < N; ++j) {
+        if (S[j] < 0) {
+            S[j] = -S[j];
+            for (int k = 0; k < N; ++k) {
+                U[k * N + j] = -U[k * N + j];
+            }
+        }
+    }
+    for (int i = 0; i < N - 1; ++i) {
+        int max_idx = i;
+        for (int j = i + 1; j < N; ++j) {
+            if (S[j] > S[max_idx]) {
+                max_idx = j;
+            }
+        }
+        if (max_idx != i) {
+            scalar_t tmp = S[i];
+            S[i] = S[max_idx];
+            S[max_idx] = tmp;
+            for (int k = 0; k < N; ++k) {
+                tmp = U[k * N + i];
+                U[k * N + i] = U[k * N + max_idx];
+                U[k * N + max_idx] = tmp;
+                tmp = V[k * N + i];
+                V[k * N + i] = V[k * N + max_idx];
+                V[k * N + max_idx] = tmp;
+            }
+        }
+    }
+}
+
+/// Computes A = U diag(S) V^T for an N x N matrix. The single precision 3 x 3
+/// case uses svd3x3, other cases use one-sided Jacobi rotations, since svd3x3
+/// is tuned for single precision only. Singular values are
+/// non-negative and sorted in descending order. Columns of U belonging to
+/// zero singular values are completed to an orthonormal basis.
+template <typename scalar_t, int N>
+OPEN3D_DEVICE void svd_nxn(const scalar_t* A,
+                           scalar_t* U,
+                           scalar_t* S,
+                           scalar_t* V) {
+    if (N == 3 && sizeof(scalar_t) == sizeof(float)) {
+        svd3x3(A, U, S, V);
+        sort_svd_nxn_<scalar_t, N>(U, S, V);
+        return;
+    }
+
+    for (int i = 0; i < N * N; ++i) {
+        U[i] = A[i];
+        V[i] = i % (N + 1) == 0 ? 1 : 0;
+    }
+
+    const scalar_t eps = epsilon_small<scalar_t>();
+    for (int sweep = 0; sweep < kMaxJacobiSweeps; ++sweep) {
+        bool converged = true;
+        for (int p = 0; p < N; ++p) {
+            for (int q = p + 1; q < N; ++q) {
+                scalar_t alpha = 0, beta = 0, gamma = 0;
+                for (int k = 0; k < N; ++k) {
+                    alpha += U[k * N + p] * U[k * N + p];
+                    beta += U[k * N + q] * U[k * N + q];
+                    gamma += U[k * N + p] * U[k * N + q];
+                }
+                if (abs_small(gamma) <= eps * sqrt(alpha * beta)) {
+                    continue;
+                }
+                converged = false;
+                scalar_t zeta = (beta - alpha) / (2 * gamma);
+                scalar_t t = 1 / (abs_small(zeta) + sqrt(1 + zeta * zeta));
+                if (zeta < 0) {
+                    t = -t;
+                }
+                scalar_t c = 1 / sqrt(1 + t * t);
+                scalar_t s = c * t;
+                for (int k = 0; k < N; ++k) {
+                    scalar_t ukp = U[k * N + p], ukq = U[k * N + q];
+                    U[k * N + p] = c * ukp - s * ukq;
+                    U[k * N + q] = s * ukp + c * ukq;
+                    scalar_t vkp = V[k * N + p], vkq = V[k * N + q];
+                    V[k * N + p] = c * vkp - s * vkq;
+                    V[k * N + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+        if (converged) {
+            break;
+        }
+    }
+
+    for (int j = 0; j < N; ++j) {
+        scalar_t norm = 0;
+        for (int k = 0; k < N; ++k) {
+            norm += U[k * N + j] * U[k * N + j];
+        }
+        S[j] = sqrt(norm);
+    }
+    sort_svd_nxn_<scalar_t, N>(U, S, V);
+
+    // Normalize the columns of U. Columns of (numerically) zero singular
+    // values are replaced by unit vectors orthogonalized against the previous
+    // columns.
+    const scalar_t tolerance = N * eps * S[0];
+    for (int j = 0; j < N; ++j) {
+        if (S[j] > tolerance && S[j] > 0) {
+            scalar_t inv_norm = 1 / S[j];
+            for (int k = 0; k < N; ++k) {
+                U[k * N + j] *= inv_norm;
+            }
+            continue;
+        }
+        for (int e = 0; e < N; ++e) {
+            scalar_t u[N];
+            for (int k = 0; k < N; ++k) {
+                u[k] = k == e ? 1 : 0;
+            }
+            for (int i = 0; i < j; ++i) {
+                scalar_t dot = 0;
+                for (int k = 0; k < N; ++k) {
+                    dot += U[k * N + i] * u[k];
+                }
+                for (int k = 0; k < N; ++k) {
+                    u[k] -= dot * U[k * N + i];
+                }
+            }
+            scalar_t norm = 0;
+            for (int k = 0; k < N; ++k) {
+                norm += u[k] * u[k];
+            }
+            if (norm > static_cast<scalar_t>(0.25)) {
+                scalar_t inv_norm = 1 / sqrt(norm);
+                for (int k = 0; k < N; ++k) {
+                    U[k * N + j] = u[k] * inv_norm;
+                }
+                break;
+            }
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace linalg
+}  // namespace core
+}  // namespace open3d
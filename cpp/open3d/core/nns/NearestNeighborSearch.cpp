@@ -27,6 +27,7 @@
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -102,6 +103,10 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "nns", "KnnSearch", query_points.GetDevice().ToString(),
+            query_points.NumElements() * query_points.GetDtype().ByteSize(),
+            query_points.GetLength());
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
@@ -117,6 +122,10 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "nns", "FixedRadiusSearch", query_points.GetDevice().ToString(),
+            query_points.NumElements() * query_points.GetDtype().ByteSize(),
+            query_points.GetLength());
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius,
@@ -139,6 +148,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "nns", "MultiRadiusSearch", query_points.GetDevice().ToString(),
+            query_points.NumElements() * query_points.GetDtype().ByteSize(),
+            query_points.GetLength());
     AssertNotCUDA(query_points);
     if (!nanoflann_index_) {
         utility::LogError(
@@ -160,6 +173,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "nns", "HybridSearch", query_points.GetDevice().ToString(),
+            query_points.NumElements() * query_points.GetDtype().ByteSize(),
+            query_points.GetLength());
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchHybrid(query_points, radius,
@@ -0,0 +1,553 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// 21 bits per dimension fit into a 64 bit Morton code.
+constexpr size_t kMaxDepth = 21;
+
+/// Inserts two zero bits between each of the lowest 21 bits of \p v.
+uint64_t SplitBy3(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+/// Inverse of SplitBy3.
+uint64_t CompactBy3(uint64_t v) {
+    v &= 0x1249249249249249;
+    v = (v ^ (v >> 2)) & 0x10c30c30c30c30c3;
+    v = (v ^ (v >> 4)) & 0x100f00f00f00f00f;
+    v = (v ^ (v >> 8)) & 0x1f0000ff0000ff;
+    v = (v ^ (v >> 16)) & 0x1f00000000ffff;
+    v = (v ^ (v >> 32)) & 0x1fffff;
+    return v;
+}
+
+/// The x coordinate is the lowest bit of every triplet, such that the lowest
+/// triplet of a code is the child index of OctreeInternalNode.
+uint64_t EncodeMorton(uint64_t x, uint64_t y, uint64_t z) {
+    return SplitBy3(x) | (SplitBy3(y) << 1) | (SplitBy3(z) << 2);
+}
+
+Eigen::Vector3i DecodeMorton(uint64_t code) {
+    return Eigen::Vector3i(int(CompactBy3(code)), int(CompactBy3(code >> 1)),
+                           int(CompactBy3(code >> 2)));
+}
+
+/// Sorts \p keys in ascending order with a stable least significant digit
+/// radix sort and applies the same permutation to \p values. Only the lowest
+/// \p num_bits bits of the keys are sorted. Every pass builds per-thread
+/// histograms of a contiguous chunk, so that the scatter keeps the order.
+void RadixSortPairs(std::vector<uint64_t>& keys,
+                    std::vector<int64_t>& values,
+                    int num_bits) {
+    constexpr int kRadixBits = 8;
+    constexpr int kNumBuckets = 1 << kRadixBits;
+    const int64_t n = int64_t(keys.size());
+    const int num_chunks =
+            n < (int64_t(1) << 16) ? 1 : utility::EstimateMaxThreads();
+
+    std::vector<uint64_t> keys_out(n);
+    std::vector<int64_t> values_out(n);
+    std::vector<int64_t> offsets(num_chunks * kNumBuckets);
+    for (int shift = 0; shift < num_bits; shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int64_t* histogram = offsets.data() + chunk * kNumBuckets;
+            const int64_t end = n * (chunk + 1) / num_chunks;
+            for (int64_t i = n * chunk / num_chunks; i < end; ++i) {
+                histogram[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+            }
+        }
+
+        // Exclusive prefix sum in (bucket, chunk) order.
+        int64_t offset = 0;
+        for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+            for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                int64_t count = offsets[chunk * kNumBuckets + bucket];
+                offsets[chunk * kNumBuckets + bucket] = offset;
+                offset += count;
+            }
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int64_t* offset_ptr = offsets.data() + chunk * kNumBuckets;
+            const int64_t end = n * (chunk + 1) / num_chunks;
+            for (int64_t i = n * chunk / num_chunks; i < end; ++i) {
+                int64_t dst =
+                        offset_ptr[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+                keys_out[dst] = keys[i];
+                values_out[dst] = values[i];
+            }
+        }
+        keys.swap(keys_out);
+        values.swap(values_out);
+    }
+}
+
+}  // namespace
+
+LinearOctree& LinearOctree::Clear() {
+    nodes_.clear();
+    level_offsets_.clear();
+    points_.clear();
+    colors_.clear();
+    indices_.clear();
+    return *this;
+}
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud& point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    // Same bounds as Octree::ConvertFromPointCloud.
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    Build(point_cloud.points_, point_cloud.colors_);
+}
+
+void LinearOctree::CreateFromOctree(const Octree& octree) {
+    Clear();
+    origin_ = octree.origin_;
+    size_ = octree.size_;
+    max_depth_ = octree.max_depth_;
+
+    std::vector<Eigen::Vector3d> points;
+    std::vector<Eigen::Vector3d> colors;
+    octree.Traverse([&](const std::shared_ptr<OctreeNode>& node,
+                        const std::shared_ptr<OctreeNodeInfo>& node_info) {
+        if (auto leaf_node =
+                    std::dynamic_pointer_cast<OctreeColorLeafNode>(node)) {
+            points.push_back(node_info->origin_ +
+                             Eigen::Vector3d::Constant(node_info->size_ / 2));
+            colors.push_back(leaf_node->color_);
+        }
+        return false;
+    });
+    Build(points, colors);
+}
+
+void LinearOctree::CreateFromVoxelGrid(const VoxelGrid& voxel_grid) {
+    Clear();
+    if (!voxel_grid.HasVoxels()) {
+        return;
+    }
+
+    Eigen::Vector3i min_index = voxel_grid.voxels_.begin()->first;
+    Eigen::Vector3i max_index = min_index;
+    for (const auto& it : voxel_grid.voxels_) {
+        min_index = min_index.cwiseMin(it.first);
+        max_index = max_index.cwiseMax(it.first);
+    }
+
+    // Align the leaves with the voxels.
+    const int extent = (max_index - min_index).maxCoeff() + 1;
+    max_depth_ = 0;
+    while ((int64_t(1) << max_depth_) < extent) {
+        max_depth_++;
+    }
+    origin_ = voxel_grid.origin_ +
+              min_index.cast<double>() * voxel_grid.voxel_size_;
+    size_ = voxel_grid.voxel_size_ * double(int64_t(1) << max_depth_);
+
+    std::vector<Eigen::Vector3d> points;
+    std::vector<Eigen::Vector3d> colors;
+    points.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
+    for (const auto& it : voxel_grid.voxels_) {
+        points.push_back(voxel_grid.origin_ +
+                         (it.first.cast<double>() +
+                          Eigen::Vector3d::Constant(0.5)) *
+                                 voxel_grid.voxel_size_);
+        colors.push_back(it.second.color_);
+    }
+    Build(points, colors);
+}
+
+void LinearOctree::Build(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors) {
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the maximum depth {}",
+                          max_depth_, kMaxDepth);
+    }
+    const int64_t num_points = int64_t(points.size());
+    if (num_points == 0) {
+        return;
+    }
+    const bool has_colors = colors.size() == points.size();
+
+    // Morton codes of the leaf cells. Points outside of the bounds are clamped
+    // to the closest leaf.
+    const int64_t resolution = int64_t(1) << max_depth_;
+    const double cell_size = size_ / double(resolution);
+    std::vector<uint64_t> codes(num_points);
+    std::vector<int64_t> order(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        Eigen::Array3d cell =
+                ((points[i] - origin_) / cell_size).array().floor();
+        cell = cell.max(0.0).min(double(resolution - 1));
+        codes[i] = EncodeMorton(uint64_t(cell(0)), uint64_t(cell(1)),
+                                uint64_t(cell(2)));
+        order[i] = i;
+    }
+    RadixSortPairs(codes, order, 3 * int(max_depth_));
+
+    points_.resize(num_points);
+    colors_.resize(has_colors ? num_points : 0);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        points_[i] = points[order[i]];
+        if (has_colors) {
+            colors_[i] = colors[order[i]];
+        }
+    }
+    indices_ = std::move(order);
+
+    // Leaves are runs of equal codes. Parents are runs of equal codes shifted
+    // by one level, and so on up to the root.
+    std::vector<std::vector<LinearOctreeNode>> levels(max_depth_ + 1);
+    std::vector<LinearOctreeNode>& leaves = levels[max_depth_];
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (i == 0 || codes[i] != codes[i - 1]) {
+            LinearOctreeNode leaf;
+            leaf.code_ = codes[i];
+            leaf.depth_ = uint32_t(max_depth_);
+            leaf.point_begin_ = i;
+            leaves.push_back(leaf);
+        }
+        leaves.back().point_end_ = i + 1;
+    }
+    for (int64_t depth = int64_t(max_depth_) - 1; depth >= 0; --depth) {
+        const std::vector<LinearOctreeNode>& children = levels[depth + 1];
+        std::vector<LinearOctreeNode>& parents = levels[depth];
+        for (size_t cidx = 0; cidx < children.size(); ++cidx) {
+            const LinearOctreeNode& child = children[cidx];
+            if (parents.empty() || parents.back().code_ != child.code_ >> 3) {
+                LinearOctreeNode parent;
+                parent.code_ = child.code_ >> 3;
+                parent.depth_ = uint32_t(depth);
+                // Relative to the next level for now.
+                parent.first_child_ = int64_t(cidx);
+                parent.point_begin_ = child.point_begin_;
+                parents.push_back(parent);
+            }
+            parents.back().child_mask_ |= uint8_t(1 << (child.code_ & 7));
+            parents.back().point_end_ = child.point_end_;
+        }
+    }
+
+    level_offsets_.resize(max_depth_ + 2);
+    level_offsets_[0] = 0;
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets_[depth + 1] =
+                level_offsets_[depth] + int64_t(levels[depth].size());
+    }
+    nodes_.reserve(level_offsets_.back());
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        for (LinearOctreeNode& node : levels[depth]) {
+            if (depth < max_depth_) {
+                node.first_child_ += level_offsets_[depth + 1];
+            }
+            nodes_.push_back(node);
+        }
+    }
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+
+    // Children are stored after their parents, so create the nodes backwards.
+    std::vector<std::shared_ptr<OctreeNode>> octree_nodes(nodes_.size());
+    for (int64_t nidx = int64_t(nodes_.size()) - 1; nidx >= 0; --nidx) {
+        const LinearOctreeNode& node = nodes_[nidx];
+        std::vector<size_t> indices(indices_.begin() + node.point_begin_,
+                                    indices_.begin() + node.point_end_);
+        // Octree keeps the indices in insertion order.
+        std::sort(indices.begin(), indices.end());
+        if (node.IsLeaf()) {
+            auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+            if (!colors_.empty()) {
+                // Like Octree::ConvertFromPointCloud, the last inserted point
+                // determines the color.
+                auto last = std::max_element(
+                        indices_.begin() + node.point_begin_,
+                        indices_.begin() + node.point_end_);
+                leaf_node->color_ = colors_[last - indices_.begin()];
+            }
+            leaf_node->indices_ = std::move(indices);
+            octree_nodes[nidx] = leaf_node;
+        } else {
+            auto internal_node = std::make_shared<OctreeInternalPointNode>();
+            int64_t child = node.first_child_;
+            for (size_t cidx = 0; cidx < 8; ++cidx) {
+                if (node.HasChild(cidx)) {
+                    internal_node->children_[cidx] = octree_nodes[child++];
+                }
+            }
+            internal_node->indices_ = std::move(indices);
+            octree_nodes[nidx] = internal_node;
+        }
+    }
+    octree->root_node_ = octree_nodes[0];
+    return octree;
+}
+
+std::shared_ptr<VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    voxel_grid->voxel_size_ = size_ / double(int64_t(1) << max_depth_);
+    if (IsEmpty()) {
+        return voxel_grid;
+    }
+    for (int64_t nidx = level_offsets_[max_depth_];
+         nidx < level_offsets_[max_depth_ + 1]; ++nidx) {
+        const LinearOctreeNode& leaf = nodes_[nidx];
+        Eigen::Vector3d color = Eigen::Vector3d::Zero();
+        if (!colors_.empty()) {
+            for (int64_t i = leaf.point_begin_; i < leaf.point_end_; ++i) {
+                color += colors_[i];
+            }
+            color /= double(leaf.point_end_ - leaf.point_begin_);
+        }
+        voxel_grid->AddVoxel(Voxel(DecodeMorton(leaf.code_), color));
+    }
+    return voxel_grid;
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (IsEmpty() || !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    const int64_t resolution = int64_t(1) << max_depth_;
+    Eigen::Array3d cell =
+            ((point - origin_) / (size_ / double(resolution))).array().floor();
+    cell = cell.max(0.0).min(double(resolution - 1));
+    const uint64_t code = EncodeMorton(uint64_t(cell(0)), uint64_t(cell(1)),
+                                       uint64_t(cell(2)));
+
+    auto begin = nodes_.begin() + level_offsets_[max_depth_];
+    auto end = nodes_.begin() + level_offsets_[max_depth_ + 1];
+    auto it = std::lower_bound(begin, end, code,
+                               [](const LinearOctreeNode& node,
+                                  uint64_t code) { return node.code_ < code; });
+    if (it == end || it->code_ != code) {
+        return -1;
+    }
+    return int64_t(it - nodes_.begin());
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(const LinearOctreeNode& node) const {
+    const double node_size = size_ / double(int64_t(1) << node.depth_);
+    Eigen::Vector3d node_origin =
+            origin_ + DecodeMorton(node.code_).cast<double>() * node_size;
+    return OctreeNodeInfo(node_origin, node_size, node.depth_,
+                          node.depth_ == 0 ? 0 : size_t(node.code_ & 7));
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(const LinearOctreeNode&,
+                                 const OctreeNodeInfo&)>& f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    std::vector<int64_t> stack = {0};
+    while (!stack.empty()) {
+        const LinearOctreeNode& node = nodes_[stack.back()];
+        stack.pop_back();
+        // Allow caller to avoid traversing further down this tree path
+        if (f(node, GetNodeInfo(node)) || node.IsLeaf()) {
+            continue;
+        }
+        // Push in reverse order such that child 0 is visited first.
+        int64_t child = node.first_child_;
+        for (size_t cidx = 0; cidx < 8; ++cidx) {
+            child += node.HasChild(cidx);
+        }
+        while (child > node.first_child_) {
+            stack.push_back(--child);
+        }
+    }
+}
+
+double LinearOctree::NodeDistance2(const Eigen::Vector3d& query,
+                                   const LinearOctreeNode& node) const {
+    const double node_size = size_ / double(int64_t(1) << node.depth_);
+    Eigen::Array3d min_bound =
+            origin_.array() +
+            DecodeMorton(node.code_).cast<double>().array() * node_size;
+    Eigen::Array3d delta = (min_bound - query.array())
+                                   .max(query.array() - min_bound - node_size)
+                                   .max(0.0);
+    return delta.matrix().squaredNorm();
+}
+
+int LinearOctree::SearchKNN(const Eigen::Vector3d& query,
+                            int knn,
+                            std::vector<int>& indices,
+                            std::vector<double>& distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (IsEmpty() || knn <= 0) {
+        return 0;
+    }
+
+    // Best-first search: nodes are visited in the order of their distance to
+    // the query until the closest unvisited node is farther than the k-th
+    // neighbor found so far.
+    typedef std::pair<double, int64_t> Entry;
+    std::priority_queue<Entry> neighbors;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    queue.emplace(NodeDistance2(query, nodes_[0]), 0);
+    while (!queue.empty()) {
+        const Entry entry = queue.top();
+        queue.pop();
+        if (int(neighbors.size()) == knn &&
+            entry.first > neighbors.top().first) {
+            break;
+        }
+        const LinearOctreeNode& node = nodes_[entry.second];
+        if (node.IsLeaf()) {
+            for (int64_t i = node.point_begin_; i < node.point_end_; ++i) {
+                const double dist2 = (points_[i] - query).squaredNorm();
+                if (int(neighbors.size()) < knn) {
+                    neighbors.emplace(dist2, i);
+                } else if (dist2 < neighbors.top().first) {
+                    neighbors.pop();
+                    neighbors.emplace(dist2, i);
+                }
+            }
+            continue;
+        }
+        int64_t child = node.first_child_;
+        for (size_t cidx = 0; cidx < 8; ++cidx) {
+            if (node.HasChild(cidx)) {
+                const double dist2 = NodeDistance2(query, nodes_[child]);
+                if (int(neighbors.size()) < knn ||
+                    dist2 <= neighbors.top().first) {
+                    queue.emplace(dist2, child);
+                }
+                ++child;
+            }
+        }
+    }
+
+    const int num_neighbors = int(neighbors.size());
+    indices.resize(num_neighbors);
+    distance2.resize(num_neighbors);
+    for (int i = num_neighbors - 1; i >= 0; --i) {
+        indices[i] = int(indices_[neighbors.top().second]);
+        distance2[i] = neighbors.top().first;
+        neighbors.pop();
+    }
+    return num_neighbors;
+}
+
+int LinearOctree::SearchRadius(const Eigen::Vector3d& query,
+                               double radius,
+                               std::vector<int>& indices,
+                               std::vector<double>& distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (IsEmpty()) {
+        return 0;
+    }
+
+    const double radius2 = radius * radius;
+    std::vector<std::pair<double, int64_t>> neighbors;
+    std::vector<int64_t> stack = {0};
+    while (!stack.empty()) {
+        const LinearOctreeNode& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (NodeDistance2(query, node) > radius2) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (int64_t i = node.point_begin_; i < node.point_end_; ++i) {
+                const double dist2 = (points_[i] - query).squaredNorm();
+                if (dist2 <= radius2) {
+                    neighbors.emplace_back(dist2, i);
+                }
+            }
+            continue;
+        }
+        int64_t child = node.first_child_;
+        for (size_t cidx = 0; cidx < 8; ++cidx) {
+            if (node.HasChild(cidx)) {
+                stack.push_back(child++);
+            }
+        }
+    }
+
+    std::sort(neighbors.begin(), neighbors.end());
+    indices.resize(neighbors.size());
+    distance2.resize(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); ++i) {
+        indices[i] = int(indices_[neighbors[i].second]);
+        distance2[i] = neighbors[i].first;
+    }
+    return int(neighbors.size());
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctreeNode
+///
+/// \brief Node of a LinearOctree.
+///
+/// Nodes do not own children or points. The children of a node are stored
+/// contiguously in LinearOctree::nodes_ and the points of a node are a
+/// contiguous range of the Morton-ordered points of the LinearOctree.
+class LinearOctreeNode {
+public:
+    /// Returns true if the node has no children.
+    bool IsLeaf() const { return first_child_ < 0; }
+    /// Returns true if the child with index \p child_index exists.
+    bool HasChild(size_t child_index) const {
+        return (child_mask_ >> child_index) & 1;
+    }
+
+public:
+    /// Morton code of the node at its depth. The lowest three bits are the
+    /// child index of the node in its parent, using the same child ordering
+    /// convention as OctreeInternalNode.
+    uint64_t code_ = 0;
+    /// Depth of the node to the root. The root is of depth 0.
+    uint32_t depth_ = 0;
+    /// Bit i is set if the child with index i exists.
+    uint8_t child_mask_ = 0;
+    /// Index of the first existing child in LinearOctree::nodes_, or -1 for
+    /// leaf nodes. The existing children follow in ascending child index.
+    int64_t first_child_ = -1;
+    /// Begin of the range of points in the node.
+    int64_t point_begin_ = 0;
+    /// End (exclusive) of the range of points in the node.
+    int64_t point_end_ = 0;
+};
+
+/// \class LinearOctree
+///
+/// \brief Pointerless octree backed by Morton-sorted points.
+///
+/// The points are sorted by the Morton code of their leaf cell with a parallel
+/// radix sort. The nodes are stored level by level in a single array, such
+/// that every node covers a contiguous range of the sorted points. Compared to
+/// Octree, no per-node heap allocations are needed and the tree is built in
+/// O(N) instead of inserting points one by one.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    /// At most 21 levels are supported.
+    LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    ~LinearOctree() {}
+
+public:
+    /// Clears all nodes and points.
+    LinearOctree& Clear();
+    /// Returns true if the LinearOctree contains no points.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// \brief Build the octree from a point cloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Build the octree from an Octree with the same origin, size and
+    /// max depth. Every leaf becomes one point at the center of the leaf.
+    void CreateFromOctree(const Octree& octree);
+
+    /// \brief Build the octree from a VoxelGrid. Every voxel becomes one point
+    /// at the center of the voxel.
+    ///
+    /// \param voxel_grid Input voxel grid.
+    void CreateFromVoxelGrid(const VoxelGrid& voxel_grid);
+
+    /// \brief Convert to an Octree with OctreeInternalPointNode internal
+    /// nodes and OctreePointColorLeafNode leaves. As in
+    /// Octree::ConvertFromPointCloud, the color of a leaf is the color of the
+    /// last point inserted into it.
+    std::shared_ptr<Octree> ToOctree() const;
+
+    /// \brief Convert to a VoxelGrid with one voxel per leaf. The voxel size
+    /// is the size of the leaves.
+    std::shared_ptr<VoxelGrid> ToVoxelGrid() const;
+
+    /// \brief Returns the index of the leaf node in nodes_ where the query
+    /// point resides, or -1 if there is no such leaf.
+    ///
+    /// \param point Coordinates of the point.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// \brief Computes the origin, size, depth and child index of a node.
+    ///
+    /// \param node Node of this octree.
+    OctreeNodeInfo GetNodeInfo(const LinearOctreeNode& node) const;
+
+    /// \brief DFS traversal of the LinearOctree from the root, with callback
+    /// function called for each node.
+    ///
+    /// \param f Callback which fires with each traversed internal/leaf node.
+    /// If f returns true, children of this node will not be traversed.
+    void Traverse(const std::function<bool(const LinearOctreeNode&,
+                                           const OctreeNodeInfo&)>& f) const;
+
+    /// \brief Searches the \p knn nearest points of \p query.
+    ///
+    /// \param query Coordinates of the query point.
+    /// \param knn Number of neighbors to search.
+    /// \param indices Output indices of the neighbors in the input points,
+    /// sorted by distance.
+    /// \param distance2 Output squared distances of the neighbors.
+    /// \return The number of neighbors found.
+    int SearchKNN(const Eigen::Vector3d& query,
+                  int knn,
+                  std::vector<int>& indices,
+                  std::vector<double>& distance2) const;
+
+    /// \brief Searches all points within \p radius of \p query.
+    ///
+    /// \param query Coordinates of the query point.
+    /// \param radius Search radius.
+    /// \param indices Output indices of the neighbors in the input points,
+    /// sorted by distance.
+    /// \param distance2 Output squared distances of the neighbors.
+    /// \return The number of neighbors found.
+    int SearchRadius(const Eigen::Vector3d& query,
+                     double radius,
+                     std::vector<int>& indices,
+                     std::vector<double>& distance2) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Max depth of the octree. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+    /// Nodes stored level by level, each level sorted by Morton code. The
+    /// root is nodes_[0].
+    std::vector<LinearOctreeNode> nodes_;
+
+    /// Offset of the first node of each depth in nodes_. The nodes of depth d
+    /// are nodes_[level_offsets_[d]] to nodes_[level_offsets_[d + 1] - 1].
+    std::vector<int64_t> level_offsets_;
+
+    /// Points sorted by Morton code.
+    std::vector<Eigen::Vector3d> points_;
+
+    /// Colors of points_, empty if the input has no colors.
+    std::vector<Eigen::Vector3d> colors_;
+
+    /// Index of each entry of points_ in the input points.
+    std::vector<int64_t> indices_;
+
+private:
+    /// Sorts the points into the octree. origin_, size_ and max_depth_ have to
+    /// be set.
+    void Build(const std::vector<Eigen::Vector3d>& points,
+               const std::vector<Eigen::Vector3d>& colors);
+
+    /// Returns the squared distance from \p query to the bounding box of
+    /// \p node.
+    double NodeDistance2(const Eigen::Vector3d& query,
+                         const LinearOctreeNode& node) const;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -25,14 +25,18 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <iostream>
 #include <list>
+#include <unordered_set>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace geometry {
@@ -294,6 +298,7 @@ public:
                     Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
         }
         mesh_->triangle_normals_.push_back(face_normal);
+        ball_centers_.push_back(center);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
@@ -672,12 +677,73 @@ public:
         }
     }
 
+    void FindSeedTriangle(double radius, const std::vector<int>& candidates) {
+        for (int vidx : candidates) {
+            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
+                              radius, vidx);
+            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(vertices[vidx], radius)) {
+                    ExpandTriangulation(radius);
+                }
+            }
+        }
+    }
+
+    void UpdateBorderEdges(double radius) {
+        for (auto it = border_edges_.begin(); it != border_edges_.end();) {
+            BallPivotingEdgePtr edge = *it;
+            BallPivotingTrianglePtr triangle = edge->triangle0_;
+            utility::LogDebug(
+                    "[UpdateBorderEdges] try edge {:d}-{:d} of triangle "
+                    "{:d}-{:d}-{:d}",
+                    edge->source_->idx_, edge->target_->idx_,
+                    triangle->vert0_->idx_, triangle->vert1_->idx_,
+                    triangle->vert2_->idx_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle->vert0_->idx_,
+                                  triangle->vert1_->idx_,
+                                  triangle->vert2_->idx_, radius, center)) {
+                utility::LogDebug("[UpdateBorderEdges]   yes, we can work on "
+                                  "this");
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle->vert0_->idx_ &&
+                        idx != triangle->vert1_->idx_ &&
+                        idx != triangle->vert2_->idx_) {
+                        utility::LogDebug(
+                                "[UpdateBorderEdges]   but no, the ball is "
+                                "not empty");
+                        empty_ball = false;
+                        break;
+                    }
+                }
+
+                if (empty_ball) {
+                    utility::LogDebug(
+                            "[UpdateBorderEdges]   yeah, add edge to "
+                            "edge_front_: {:d}",
+                            edge_front_.size());
+                    edge->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(edge);
+                    it = border_edges_.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
         }
 
         mesh_->triangles_.clear();
+        ball_centers_.clear();
 
         for (double radius : radii) {
             utility::LogDebug("[Run] ################################");
@@ -688,47 +754,7 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            UpdateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -744,6 +770,74 @@ public:
         return mesh_;
     }
 
+    /// Inserts \p triangles with their pivoting ball centers \p centers, e.g.
+    /// the result of reconstructing a spatial partition of the point cloud.
+    /// Open edges between two vertices flagged in \p is_seam_vertex are put on
+    /// the front, all other open edges are considered final borders.
+    void AddTriangles(const std::vector<Eigen::Vector3i>& triangles,
+                      const std::vector<Eigen::Vector3d>& centers,
+                      const std::vector<bool>& is_seam_vertex) {
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            const Eigen::Vector3i& triangle = triangles[tidx];
+            CreateTriangle(vertices[triangle(0)], vertices[triangle(1)],
+                           vertices[triangle(2)], centers[tidx]);
+        }
+
+        std::unordered_set<BallPivotingEdge*> visited;
+        for (const BallPivotingVertexPtr& vertex : vertices) {
+            for (const BallPivotingEdgePtr& edge : vertex->edges_) {
+                if (edge->type_ != BallPivotingEdge::Type::Front ||
+                    !visited.insert(edge.get()).second) {
+                    continue;
+                }
+                if (is_seam_vertex[edge->source_->idx_] &&
+                    is_seam_vertex[edge->target_->idx_]) {
+                    edge_front_.push_back(edge);
+                } else {
+                    edge->type_ = BallPivotingEdge::Type::Border;
+                }
+            }
+        }
+    }
+
+    /// Continues the reconstruction from the front created by AddTriangles.
+    /// Only vertices in \p seam_vertices are tried as new seeds.
+    std::shared_ptr<TriangleMesh> Stitch(
+            const std::vector<double>& radii,
+            const std::vector<int>& seam_vertices) {
+        for (double radius : radii) {
+            utility::LogDebug("[Stitch] change to radius {:.4f}", radius);
+            UpdateBorderEdges(radius);
+            ExpandTriangulation(radius);
+            FindSeedTriangle(radius, seam_vertices);
+            utility::LogDebug("[Stitch] mesh_ has {:d} triangles",
+                              mesh_->triangles_.size());
+        }
+        return mesh_;
+    }
+
+    /// Returns true if no point other than the vertices of \p triangle lies
+    /// inside the ball of radius \p radius around \p center.
+    bool IsEmptyBall(const Eigen::Vector3i& triangle,
+                     const Eigen::Vector3d& center,
+                     double radius) const {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        kdtree_.SearchRadius(center, radius, indices, dists2);
+        for (int idx : indices) {
+            if (idx != triangle(0) && idx != triangle(1) &&
+                idx != triangle(2) &&
+                (center - vertices[idx]->point_).norm() < radius - 1e-16) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const std::vector<Eigen::Vector3d>& GetBallCenters() const {
+        return ball_centers_;
+    }
+
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
@@ -751,6 +845,7 @@ private:
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
     std::shared_ptr<TriangleMesh> mesh_;
+    std::vector<Eigen::Vector3d> ball_centers_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
@@ -759,5 +854,145 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
     return bp.Run(radii);
 }
 
+std::shared_ptr<TriangleMesh>
+TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        int n_partitions) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    if (radii.empty()) {
+        return CreateFromPointCloudBallPivoting(pcd, radii);
+    }
+    if (n_partitions <= 0) {
+        n_partitions = utility::EstimateMaxThreads();
+    }
+    // Every partition should at least be able to hold a few seed triangles.
+    n_partitions = std::min(n_partitions, int(pcd.points_.size() / 64));
+    if (n_partitions <= 1) {
+        return CreateFromPointCloudBallPivoting(pcd, radii);
+    }
+
+    std::vector<std::vector<size_t>> partition_indices(n_partitions);
+    std::vector<bool> is_seam_vertex(pcd.points_.size(), false);
+    std::vector<int> seam_vertices;
+    // A ball of radius r touching points on both sides of a seam can only
+    // touch points that are closer than 2r to the seam.
+    const double seam_width =
+            2 * (*std::max_element(radii.begin(), radii.end()));
+    std::vector<double> seams(n_partitions - 1);
+    auto near_seam = [&](double coord) {
+        auto seam = std::upper_bound(seams.begin(), seams.end(), coord);
+        return (seam != seams.end() && *seam - coord < seam_width) ||
+               (seam != seams.begin() && coord - *(seam - 1) < seam_width);
+    };
+    int axis;
+    {
+        OPEN3D_TRACE_SCOPE("geometry", "BallPivotingPartition");
+        // Split the points into slabs along the longest axis of the bounding
+        // box. The slab boundaries are chosen such that every slab holds the
+        // same number of points.
+        (pcd.GetMaxBound() - pcd.GetMinBound()).maxCoeff(&axis);
+        std::vector<double> coords(pcd.points_.size());
+        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
+            coords[vidx] = pcd.points_[vidx](axis);
+        }
+        std::vector<double> sorted_coords(coords);
+        std::sort(sorted_coords.begin(), sorted_coords.end());
+        for (int pidx = 1; pidx < n_partitions; ++pidx) {
+            seams[pidx - 1] =
+                    sorted_coords[sorted_coords.size() * pidx / n_partitions];
+        }
+
+        for (size_t vidx = 0; vidx < coords.size(); ++vidx) {
+            auto seam =
+                    std::upper_bound(seams.begin(), seams.end(), coords[vidx]);
+            partition_indices[seam - seams.begin()].push_back(vidx);
+            if (near_seam(coords[vidx])) {
+                is_seam_vertex[vidx] = true;
+                seam_vertices.push_back(static_cast<int>(vidx));
+            }
+        }
+    }
+
+    // Reconstruct every partition independently.
+    std::vector<std::vector<Eigen::Vector3i>> partition_triangles(
+            n_partitions);
+    std::vector<std::vector<Eigen::Vector3d>> partition_centers(n_partitions);
+    {
+        OPEN3D_TRACE_SCOPE("geometry", "BallPivotingSlabs");
+#pragma omp parallel for schedule(dynamic)
+        for (int pidx = 0; pidx < n_partitions; ++pidx) {
+            const std::vector<size_t>& indices = partition_indices[pidx];
+            // BallPivoting refers to the points, keep the partition alive.
+            std::shared_ptr<PointCloud> partition = pcd.SelectByIndex(indices);
+            BallPivoting bp(*partition);
+            std::shared_ptr<TriangleMesh> mesh = bp.Run(radii);
+            partition_triangles[pidx].reserve(mesh->triangles_.size());
+            for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+                partition_triangles[pidx].emplace_back(indices[triangle(0)],
+                                                       indices[triangle(1)],
+                                                       indices[triangle(2)]);
+            }
+            partition_centers[pidx] = bp.GetBallCenters();
+        }
+    }
+
+    std::vector<Eigen::Vector3i> triangles;
+    std::vector<Eigen::Vector3d> centers;
+    for (int pidx = 0; pidx < n_partitions; ++pidx) {
+        triangles.insert(triangles.end(), partition_triangles[pidx].begin(),
+                         partition_triangles[pidx].end());
+        centers.insert(centers.end(), partition_centers[pidx].begin(),
+                       partition_centers[pidx].end());
+    }
+
+    BallPivoting bp(pcd);
+    {
+        OPEN3D_TRACE_SCOPE("geometry", "BallPivotingSeamCheck");
+        // A slab only sees its own points, so the ball of a triangle close to
+        // a seam may contain points of the neighbouring slab. Drop such
+        // triangles and let the stitching pivot over their vertices again.
+        std::vector<char> is_valid(triangles.size(), 1);
+#pragma omp parallel for schedule(static)
+        for (int64_t tidx = 0; tidx < int64_t(triangles.size()); ++tidx) {
+            const Eigen::Vector3d& center = centers[tidx];
+            if (near_seam(center(axis))) {
+                const Eigen::Vector3i& triangle = triangles[tidx];
+                const double radius =
+                        (center - pcd.points_[triangle(0)]).norm();
+                is_valid[tidx] = bp.IsEmptyBall(triangle, center, radius);
+            }
+        }
+        size_t num_valid = 0;
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            if (is_valid[tidx]) {
+                triangles[num_valid] = triangles[tidx];
+                centers[num_valid] = centers[tidx];
+                ++num_valid;
+                continue;
+            }
+            for (int i = 0; i < 3; ++i) {
+                const int vidx = triangles[tidx](i);
+                if (!is_seam_vertex[vidx]) {
+                    is_seam_vertex[vidx] = true;
+                    seam_vertices.push_back(vidx);
+                }
+            }
+        }
+        utility::LogDebug("Dropped {} of {} slab triangles at the seams.",
+                          triangles.size() - num_valid, triangles.size());
+        triangles.resize(num_valid);
+        centers.resize(num_valid);
+    }
+
+    // Stitch the partitions by continuing the reconstruction from the open
+    // edges along the seams.
+    OPEN3D_TRACE_SCOPE("geometry", "BallPivotingStitch");
+    bp.AddTriangles(triangles, centers, is_seam_vertex);
+    return bp.Stitch(radii, seam_vertices);
+}
+
 }  // namespace geometry
 }  // namespace open3d
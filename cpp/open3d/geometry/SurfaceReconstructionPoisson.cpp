@@ -35,6 +35,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 // clang-format off
 #ifdef _MSC_VER
@@ -107,39 +108,54 @@ class Open3DPointStream
     : public InputPointStreamWithData<Real, DIMENSION, Open3DData> {
 public:
     Open3DPointStream(const open3d::geometry::PointCloud* pcd)
-        : pcd_(pcd), xform_(nullptr), current_(0) {}
+        : pcd_(pcd), current_(0) {}
     void reset(void) { current_ = 0; }
     bool nextPoint(Point<Real, 3>& p, Open3DData& d) {
         if (current_ >= pcd_->points_.size()) {
             return false;
         }
-        p.coords[0] = static_cast<Real>(pcd_->points_[current_](0));
-        p.coords[1] = static_cast<Real>(pcd_->points_[current_](1));
-        p.coords[2] = static_cast<Real>(pcd_->points_[current_](2));
-
-        if (xform_ != nullptr) {
-            p = (*xform_) * p;
+        if (points_.empty()) {
+            const Eigen::Vector3d& point = pcd_->points_[current_];
+            p = Point<Real, 3>(static_cast<Real>(point(0)),
+                               static_cast<Real>(point(1)),
+                               static_cast<Real>(point(2)));
+        } else {
+            p = points_[current_];
         }
 
         if (pcd_->HasNormals()) {
             d.normal_ = pcd_->normals_[current_];
         } else {
-            d.normal_ = Eigen::Vector3d(0, 0, 0);
+            d.normal_.setZero();
         }
 
         if (pcd_->HasColors()) {
             d.color_ = pcd_->colors_[current_];
         } else {
-            d.color_ = Eigen::Vector3d(0, 0, 0);
+            d.color_.setZero();
         }
 
         current_++;
         return true;
     }
 
+    /// Transforms all points in parallel into a buffer that nextPoint()
+    /// streams from afterwards.
+    void SetXForm(const XForm<Real, 4>& xform) {
+        const int64_t num_points = int64_t(pcd_->points_.size());
+        points_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; ++i) {
+            const Eigen::Vector3d& point = pcd_->points_[i];
+            points_[i] = xform * Point<Real, 3>(static_cast<Real>(point(0)),
+                                                static_cast<Real>(point(1)),
+                                                static_cast<Real>(point(2)));
+        }
+    }
+
 public:
     const open3d::geometry::PointCloud* pcd_;
-    XForm<Real, 4>* xform_;
+    std::vector<Point<Real, 3>> points_;
     size_t current_;
 };
 
@@ -385,26 +401,39 @@ void ExtractMesh(
                             !non_manifold, polygon_mesh, false);
     }
 
+    // The mesh data can only be consumed sequentially. Pull the vertices into
+    // a buffer first and convert them to the output layout in parallel.
     mesh->resetIterator();
-    out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
-        Vertex v;
-        mesh->nextOutOfCorePoint(v);
-        v.point = iXForm * v.point;
-        out_mesh->vertices_.push_back(
-                Eigen::Vector3d(v.point[0], v.point[1], v.point[2]));
-        out_mesh->vertex_normals_.push_back(v.normal_);
-        out_mesh->vertex_colors_.push_back(v.color_);
-        out_densities.push_back(v.w_);
+    const int64_t num_vertices = int64_t(mesh->outOfCorePointCount());
+    std::vector<Vertex> vertices(num_vertices);
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        mesh->nextOutOfCorePoint(vertices[vidx]);
     }
-    for (size_t tidx = 0; tidx < mesh->polygonCount(); ++tidx) {
-        std::vector<CoredVertexIndex<node_index_type>> triangle;
+    out_mesh->vertices_.resize(num_vertices);
+    out_mesh->vertex_normals_.resize(num_vertices);
+    out_mesh->vertex_colors_.resize(num_vertices);
+    out_densities.resize(num_vertices);
+#pragma omp parallel for schedule(static)
+    for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+        const Vertex& v = vertices[vidx];
+        Point<Real, Dim> point = iXForm * v.point;
+        out_mesh->vertices_[vidx] =
+                Eigen::Vector3d(point[0], point[1], point[2]);
+        out_mesh->vertex_normals_[vidx] = v.normal_;
+        out_mesh->vertex_colors_[vidx] = v.color_;
+        out_densities[vidx] = v.w_;
+    }
+
+    const size_t num_polygons = mesh->polygonCount();
+    out_mesh->triangles_.resize(num_polygons);
+    std::vector<CoredVertexIndex<node_index_type>> triangle;
+    for (size_t tidx = 0; tidx < num_polygons; ++tidx) {
         mesh->nextPolygon(triangle);
         if (triangle.size() != 3) {
             open3d::utility::LogError("got polygon");
         } else {
-            out_mesh->triangles_.push_back(Eigen::Vector3i(
-                    triangle[0].idx, triangle[1].idx, triangle[2].idx));
+            out_mesh->triangles_[tidx] = Eigen::Vector3i(
+                    triangle[0].idx, triangle[1].idx, triangle[2].idx);
         }
     }
 
@@ -465,6 +494,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
     // Read in the samples (and color data)
     {
+        OPEN3D_TRACE_SCOPE("geometry", "PoissonReadSamples");
         Open3DPointStream<Real> pointStream(&pcd);
 
         if (width > 0) {
@@ -479,7 +509,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                               : xForm;
         }
 
-        pointStream.xform_ = &xForm;
+        pointStream.SetXForm(xForm);
 
         {
             auto ProcessDataWithConfidence = [&](const Point<Real, Dim>& p,
@@ -523,6 +553,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
     DenseNodeData<Real, Sigs> solution;
     {
+        OPEN3D_TRACE_SCOPE("geometry", "PoissonSolve");
         DenseNodeData<Real, Sigs> constraints;
         InterpolationInfo* iInfo = NULL;
         int solveDepth = depth;
@@ -691,6 +722,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     }
 
     {
+        OPEN3D_TRACE_SCOPE("geometry", "PoissonIsoValue");
         profiler.start();
         double valueSum = 0, weightSum = 0;
         typename FEMTree<Dim, Real>::template MultiThreadedEvaluator<Sigs, 0>
@@ -724,10 +756,14 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         v.color_ = d.color_;
         v.w_ = w;
     };
-    ExtractMesh<Open3DVertex<Real>, Real>(
-            datax, linear_fit, UIntPack<FEMSigs...>(),
-            std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
+    {
+        OPEN3D_TRACE_SCOPE("geometry", "PoissonExtractMesh");
+        ExtractMesh<Open3DVertex<Real>, Real>(
+                datax, linear_fit, UIntPack<FEMSigs...>(),
+                std::tuple<SampleData...>(), tree, solution, isoValue,
+                &samples, &sampleData, density, SetVertex, iXForm, out_mesh,
+                out_densities);
+    }
 
     if (density) delete density, density = NULL;
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
@@ -550,6 +550,23 @@ public:
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
             const PointCloud &pcd, const std::vector<double> &radii);
 
+    /// \brief Parallel variant of CreateFromPointCloudBallPivoting.
+    ///
+    /// The point cloud is split into \p n_partitions slabs along the longest
+    /// axis of its bounding box that are reconstructed concurrently. The
+    /// partial meshes are then stitched by pivoting the ball over the open
+    /// edges close to the slab boundaries.
+    /// \param pcd defines the PointCloud from which the TriangleMesh surface is
+    /// reconstructed. Has to contain normals.
+    /// \param radii defines the radii of
+    /// the ball that are used for the surface reconstruction.
+    /// \param n_partitions Number of spatial partitions. Set to -1 to use one
+    /// partition per thread.
+    static std::shared_ptr<TriangleMesh>
+    CreateFromPointCloudBallPivotingParallel(const PointCloud &pcd,
+                                             const std::vector<double> &radii,
+                                             int n_partitions = -1);
+
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
     /// proposed in Kazhdan and Hoppe, "Screened Poisson Surface
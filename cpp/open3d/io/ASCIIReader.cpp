@@ -0,0 +1,333 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ASCIIReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Bounds of the chunk size. Each thread gets about 16 chunks, so progress
+/// is reported regularly.
+constexpr size_t kMinChunkSize = 1 << 10;
+constexpr size_t kMaxChunkSize = 1 << 20;
+
+/// Powers of ten that are exactly representable as double.
+constexpr double kExactPowersOf10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Exact conversion of decimals with at most 19 significant digits whose
+/// mantissa and power of ten are both exactly representable (Clinger's fast
+/// path). Returns false for everything else, without moving \p ptr.
+bool ParseDecimal(const char *&ptr, const char *end, double &value) {
+    const char *p = ptr;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; p < end && IsDigit(*p); ++p) {
+        has_digits = true;
+        if (mantissa == 0 && *p == '0') {
+            continue;
+        }
+        if (++num_digits > 19) {
+            return false;
+        }
+        mantissa = mantissa * 10 + (*p - '0');
+    }
+    if (p < end && (*p == 'x' || *p == 'X')) {
+        // Hexadecimal floats are left to strtod.
+        return false;
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && IsDigit(*p); ++p) {
+            has_digits = true;
+            --exponent;
+            if (mantissa == 0 && *p == '0') {
+                continue;
+            }
+            if (++num_digits > 19) {
+                return false;
+            }
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+    }
+    if (!has_digits) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int explicit_exponent = 0;
+            for (; q < end && IsDigit(*q); ++q) {
+                if (explicit_exponent > 10000) {
+                    return false;
+                }
+                explicit_exponent = explicit_exponent * 10 + (*q - '0');
+            }
+            exponent += negative_exponent ? -explicit_exponent
+                                          : explicit_exponent;
+            p = q;
+        }
+        // Otherwise the 'e' is not part of the number, as with strtod.
+    }
+
+    if (mantissa > (uint64_t(1) << 53)) {
+        return false;
+    }
+    double result = static_cast<double>(mantissa);
+    if (mantissa != 0) {
+        if (exponent < -22 || exponent > 22) {
+            return false;
+        }
+        result = exponent < 0 ? result / kExactPowersOf10[-exponent]
+                              : result * kExactPowersOf10[exponent];
+    }
+    value = negative ? -result : result;
+    ptr = p;
+    return true;
+}
+
+/// Parses \p num_fields numbers at \p begin and moves it past them.
+inline bool ParseRow(const char *&begin,
+                     const char *end,
+                     int num_fields,
+                     double *row) {
+    for (int i = 0; i < num_fields; ++i) {
+        if (!ParseASCIIDouble(begin, end, row[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+bool ParseASCIIDouble(const char *&ptr, const char *end, double &value) {
+    const char *p = ptr;
+    while (p < end && IsBlank(*p)) {
+        ++p;
+    }
+    if (p == end || *p == '\n') {
+        return false;
+    }
+    if (ParseDecimal(p, end, value)) {
+        ptr = p;
+        return true;
+    }
+
+    // The mapped file is not null-terminated, so strtod works on a copy of
+    // the token.
+    const char *token_end = p;
+    while (token_end < end && !IsBlank(*token_end) && *token_end != '\n') {
+        ++token_end;
+    }
+    const std::string token(p, token_end);
+    char *parsed_end = nullptr;
+    value = std::strtod(token.c_str(), &parsed_end);
+    if (parsed_end == token.c_str()) {
+        return false;
+    }
+    ptr = p + (parsed_end - token.c_str());
+    return true;
+}
+
+int CountASCIIFields(const char *begin, const char *end) {
+    int num_fields = 0;
+    double value;
+    while (ParseASCIIDouble(begin, end, value)) {
+        ++num_fields;
+    }
+    return num_fields;
+}
+
+std::vector<double> ReadASCIIRows(const utility::filesystem::MappedFile &file,
+                                  size_t offset,
+                                  int num_fields,
+                                  int64_t max_lines,
+                                  utility::CountingProgressReporter &reporter,
+                                  int64_t *num_lines) {
+    std::vector<double> values;
+    const int64_t num_rows = ReadASCIIColumns(
+            file, offset, {num_fields}, max_lines, reporter,
+            [&values, num_fields](int64_t max_rows) {
+                values.resize(max_rows * num_fields);
+                return std::vector<double *>{values.data()};
+            },
+            num_lines);
+    values.resize(num_rows * num_fields);
+    return values;
+}
+
+int64_t ReadASCIIColumns(const utility::filesystem::MappedFile &file,
+                         size_t offset,
+                         const std::vector<int> &column_sizes,
+                         int64_t max_lines,
+                         utility::CountingProgressReporter &reporter,
+                         const ASCIIColumnsCallback &get_buffers,
+                         int64_t *num_lines) {
+    const int num_groups = static_cast<int>(column_sizes.size());
+    const char *const data = file.GetData();
+    const size_t size = file.GetSize();
+    offset = std::min(offset, size);
+
+    // Split the data into chunks that end after a newline.
+    const int num_threads = utility::EstimateMaxThreads();
+    const size_t chunk_size = std::max(
+            kMinChunkSize,
+            std::min(kMaxChunkSize, (size - offset) / (16 * num_threads)));
+    std::vector<const char *> bounds(1, data + offset);
+    while (bounds.back() < data + size) {
+        const char *chunk_begin = bounds.back();
+        const char *chunk_end = data + size;
+        if (static_cast<size_t>(chunk_end - chunk_begin) > chunk_size) {
+            const char *search_begin = chunk_begin + chunk_size;
+            const void *newline = std::memchr(search_begin, '\n',
+                                              chunk_end - search_begin);
+            if (newline) {
+                chunk_end = static_cast<const char *>(newline) + 1;
+            }
+        }
+        bounds.push_back(chunk_end);
+    }
+    int64_t num_chunks = static_cast<int64_t>(bounds.size()) - 1;
+
+    // First pass: count the lines of each chunk. Only the last chunk may end
+    // without a newline.
+    std::vector<int64_t> line_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const char *begin = bounds[c];
+        const char *end = bounds[c + 1];
+        line_offsets[c + 1] = std::count(begin, end, '\n') +
+                              (end > begin && end[-1] != '\n' ? 1 : 0);
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        line_offsets[c + 1] += line_offsets[c];
+    }
+
+    // Drop the lines after max_lines.
+    if (max_lines >= 0 && line_offsets[num_chunks] > max_lines) {
+        int64_t c = 0;
+        while (line_offsets[c + 1] <= max_lines) {
+            ++c;
+        }
+        const char *end = bounds[c];
+        for (int64_t i = line_offsets[c]; i < max_lines; ++i) {
+            end = static_cast<const char *>(
+                          std::memchr(end, '\n', bounds[c + 1] - end)) +
+                  1;
+        }
+        bounds[c + 1] = end;
+        line_offsets[c + 1] = max_lines;
+        num_chunks = c + 1;
+    }
+    const int64_t total_lines = line_offsets[num_chunks];
+    if (num_lines) {
+        *num_lines = total_lines;
+    }
+
+    // Second pass: parse each chunk into the rows of its lines. Chunks are
+    // processed in rounds of one chunk per thread, and progress is reported
+    // from the calling thread in between, since callbacks may need locks
+    // held by the caller, e.g. the Python GIL.
+    const std::vector<double *> buffers = get_buffers(total_lines);
+    std::vector<int64_t> num_rows(num_chunks, 0);
+    for (int64_t round = 0; round < num_chunks; round += num_threads) {
+        const int64_t round_end = std::min(round + num_threads, num_chunks);
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+        for (int64_t c = round; c < round_end; ++c) {
+            int64_t count = 0;
+            const char *line = bounds[c];
+            const char *chunk_end = bounds[c + 1];
+            while (line < chunk_end) {
+                const void *newline =
+                        std::memchr(line, '\n', chunk_end - line);
+                const char *line_end =
+                        newline ? static_cast<const char *>(newline)
+                                : chunk_end;
+                // A partially parsed row is overwritten by the next one.
+                const int64_t row_id = line_offsets[c] + count;
+                const char *ptr = line;
+                bool is_valid = true;
+                for (int g = 0; g < num_groups && is_valid; ++g) {
+                    is_valid = ParseRow(ptr, line_end, column_sizes[g],
+                                        buffers[g] + row_id * column_sizes[g]);
+                }
+                if (is_valid) {
+                    ++count;
+                }
+                line = line_end + 1;
+            }
+            num_rows[c] = count;
+        }
+        reporter.Update(bounds[round_end] - data);
+    }
+
+    // Move the rows of each chunk behind the previous one if lines were
+    // skipped.
+    int64_t total_rows = 0;
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        if (total_rows != line_offsets[c]) {
+            for (int g = 0; g < num_groups; ++g) {
+                std::memmove(buffers[g] + total_rows * column_sizes[g],
+                             buffers[g] + line_offsets[c] * column_sizes[g],
+                             num_rows[c] * column_sizes[g] * sizeof(double));
+            }
+        }
+        total_rows += num_rows[c];
+    }
+    return total_rows;
+}
+
+}  // namespace io
+}  // namespace open3d
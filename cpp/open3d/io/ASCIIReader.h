@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Parses a number in [\p ptr, \p end) like the %lf conversion of
+/// sscanf, skipping leading blanks.
+///
+/// Plain decimals are converted with an exact fast path, anything else falls
+/// back to strtod. On success \p ptr is moved past the number.
+bool ParseASCIIDouble(const char *&ptr, const char *end, double &value);
+
+/// Counts the numbers at the start of the line that begins at \p begin.
+int CountASCIIFields(const char *begin, const char *end);
+
+/// \brief Reads rows of whitespace separated numbers from a memory-mapped
+/// ASCII file in parallel.
+///
+/// The file is split into chunks at newline boundaries. Lines are counted
+/// first, so that all values are written into a single allocation. Like
+/// `sscanf(line, "%lf %lf ...")`, a line is kept if it starts with at least
+/// \p num_fields numbers. Extra fields are ignored and other lines skipped.
+///
+/// \param file The mapped file.
+/// \param offset Byte offset where the rows start, e.g. after a header.
+/// \param num_fields Number of values read per row.
+/// \param max_lines Maximum number of lines to read, -1 reads all lines.
+/// \param reporter Receives the file position of the parsed data. Progress is
+/// reported from the calling thread only.
+/// \param num_lines If not null, receives the number of lines read, including
+/// the skipped ones.
+/// \return Row-major values, \p num_fields per row.
+std::vector<double> ReadASCIIRows(const utility::filesystem::MappedFile &file,
+                                  size_t offset,
+                                  int num_fields,
+                                  int64_t max_lines,
+                                  utility::CountingProgressReporter &reporter,
+                                  int64_t *num_lines = nullptr);
+
+/// Returns one buffer per column group of ReadASCIIColumns(), each with room
+/// for \p max_rows rows of the values of the group.
+using ASCIIColumnsCallback =
+        std::function<std::vector<double *>(int64_t max_rows)>;
+
+/// \brief Reads rows like ReadASCIIRows(), but stores groups of consecutive
+/// columns in separate buffers, e.g. the positions and normals of a point.
+///
+/// The values are parsed straight into the buffers returned by
+/// \p get_buffers, so callers can preallocate their final attributes.
+///
+/// \param column_sizes Number of values of each column group. Rows hold the
+/// sum of these values.
+/// \param get_buffers Called once the lines are counted. The number of lines
+/// bounds the number of rows.
+/// \return The number of rows, stored at the start of the buffers.
+int64_t ReadASCIIColumns(const utility::filesystem::MappedFile &file,
+                         size_t offset,
+                         const std::vector<int> &column_sizes,
+                         int64_t max_lines,
+                         utility::CountingProgressReporter &reporter,
+                         const ASCIIColumnsCallback &get_buffers,
+                         int64_t *num_lines = nullptr);
+
+}  // namespace io
+}  // namespace open3d
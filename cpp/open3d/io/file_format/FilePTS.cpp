@@ -24,13 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <vector>
 
+#include "open3d/io/ASCIIReader.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -44,59 +49,61 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
+        const char *data = file.GetData();
+        const char *data_end = data + file.GetSize();
+        const char *line = data;
+        const char *line_end = data_end;
+        if (file.GetSize() > 0) {
+            const void *newline = std::memchr(data, '\n', file.GetSize());
+            line_end = newline ? static_cast<const char *>(newline) : data_end;
         }
-        if (num_of_pts <= 0) {
+        double num_of_pts_value = 0;
+        if (!ParseASCIIDouble(line, line_end, num_of_pts_value) ||
+            num_of_pts_value < 1) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
+        const size_t num_of_pts = static_cast<size_t>(num_of_pts_value);
+        const size_t data_offset =
+                std::min(static_cast<size_t>(line_end - data) + 1,
+                         file.GetSize());
+
+        const int num_of_fields =
+                CountASCIIFields(data + data_offset, data_end);
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st =
-                        utility::SplitString(line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z, i;
-            int r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        // X Y Z I R G B, or X Y Z with any other number of fields.
+        const int num_of_values = num_of_fields >= 7 ? 7 : 3;
+        const std::vector<double> values =
+                ReadASCIIRows(file, data_offset, num_of_values,
+                              static_cast<int64_t>(num_of_pts), reporter);
+        const int64_t num_points =
+                static_cast<int64_t>(values.size()) / num_of_values;
+        pointcloud.points_.resize(num_points);
+        if (num_of_values == 7) {
+            pointcloud.colors_.resize(num_points);
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t idx = 0; idx < num_points; idx++) {
+            const double *row = values.data() + num_of_values * idx;
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (num_of_values == 7) {
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        static_cast<int>(row[4]), static_cast<int>(row[5]),
+                        static_cast<int>(row[6]));
             }
         }
         reporter.Finish();
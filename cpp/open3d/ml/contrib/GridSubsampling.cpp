@@ -24,10 +24,173 @@
 
 #include "open3d/ml/contrib/GridSubsampling.h"
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+
 namespace open3d {
 namespace ml {
 namespace contrib {
 
+namespace {
+
+/// Subsamples the N points starting at \p points. \p features and \p classes
+/// may be nullptr if \p fdim or \p ldim is 0. The results replace the contents
+/// of the output vectors, one entry per occupied grid cell in increasing cell
+/// index order.
+void GridSubsamplingRange(const PointXYZ* points,
+                          size_t N,
+                          const float* features,
+                          size_t fdim,
+                          const int* classes,
+                          size_t ldim,
+                          float sampleDl,
+                          std::vector<PointXYZ>& subsampled_points,
+                          std::vector<float>& subsampled_features,
+                          std::vector<int>& subsampled_classes) {
+    subsampled_points.clear();
+    subsampled_features.clear();
+    subsampled_classes.clear();
+    if (N == 0) return;
+
+    // Limits of the cloud
+    PointXYZ minCorner = points[0];
+    PointXYZ maxCorner = points[0];
+    for (size_t i = 1; i < N; ++i) {
+        const PointXYZ& p = points[i];
+        minCorner.x = std::min(minCorner.x, p.x);
+        minCorner.y = std::min(minCorner.y, p.y);
+        minCorner.z = std::min(minCorner.z, p.z);
+        maxCorner.x = std::max(maxCorner.x, p.x);
+        maxCorner.y = std::max(maxCorner.y, p.y);
+        maxCorner.z = std::max(maxCorner.z, p.z);
+    }
+    PointXYZ originCorner =
+            PointXYZ::floor(minCorner * (1 / sampleDl)) * sampleDl;
+
+    // Dimensions of the grid
+    size_t sampleNX =
+            (size_t)floor((maxCorner.x - originCorner.x) / sampleDl) + 1;
+    size_t sampleNY =
+            (size_t)floor((maxCorner.y - originCorner.y) / sampleDl) + 1;
+
+    // Sort (cell index, point index) pairs. Including the point index in the
+    // key keeps the points of each cell in input order, so the accumulated
+    // sums do not depend on the sort.
+    std::vector<std::pair<size_t, size_t>> cell_point(N);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, N),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const PointXYZ& p = points[i];
+                    size_t iX = (size_t)std::floor((p.x - originCorner.x) /
+                                                   sampleDl);
+                    size_t iY = (size_t)std::floor((p.y - originCorner.y) /
+                                                   sampleDl);
+                    size_t iZ = (size_t)std::floor((p.z - originCorner.z) /
+                                                   sampleDl);
+                    cell_point[i].first =
+                            iX + sampleNX * iY + sampleNX * sampleNY * iZ;
+                    cell_point[i].second = i;
+                }
+            });
+    tbb::parallel_sort(cell_point.begin(), cell_point.end());
+
+    std::vector<size_t> cell_starts;
+    cell_starts.push_back(0);
+    for (size_t i = 1; i < N; ++i) {
+        if (cell_point[i].first != cell_point[i - 1].first) {
+            cell_starts.push_back(i);
+        }
+    }
+    cell_starts.push_back(N);
+    const size_t num_cells = cell_starts.size() - 1;
+
+    // Accumulate directly into the flat output buffers.
+    subsampled_points.resize(num_cells);
+    subsampled_features.assign(num_cells * fdim, 0.f);
+    subsampled_classes.resize(num_cells * ldim);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_cells),
+            [&](const tbb::blocked_range<size_t>& r) {
+                std::vector<int> votes;
+                for (size_t c = r.begin(); c != r.end(); ++c) {
+                    const size_t begin = cell_starts[c];
+                    const size_t end = cell_starts[c + 1];
+
+                    PointXYZ point(0, 0, 0);
+                    float* f = subsampled_features.data() + c * fdim;
+                    for (size_t j = begin; j < end; ++j) {
+                        const size_t idx = cell_point[j].second;
+                        point += points[idx];
+                        const float* f_in = features + idx * fdim;
+                        for (size_t k = 0; k < fdim; ++k) {
+                            f[k] += f_in[k];
+                        }
+                    }
+                    const size_t count = end - begin;
+                    subsampled_points[c] = point * (1.0f / count);
+                    for (size_t k = 0; k < fdim; ++k) {
+                        f[k] /= (float)count;
+                    }
+
+                    // Majority vote per label channel.
+                    for (size_t k = 0; k < ldim; ++k) {
+                        votes.clear();
+                        for (size_t j = begin; j < end; ++j) {
+                            votes.push_back(
+                                    classes[cell_point[j].second * ldim + k]);
+                        }
+                        std::sort(votes.begin(), votes.end());
+                        int best = votes[0];
+                        size_t best_count = 0;
+                        for (size_t j = 0; j < votes.size();) {
+                            size_t run = j + 1;
+                            while (run < votes.size() &&
+                                   votes[run] == votes[j]) {
+                                ++run;
+                            }
+                            if (run - j > best_count) {
+                                best = votes[j];
+                                best_count = run - j;
+                            }
+                            j = run;
+                        }
+                        subsampled_classes[c * ldim + k] = best;
+                    }
+                }
+            });
+}
+
+/// Keeps \p max_p of the subsampled cells, picked evenly over the whole cell
+/// range. Cells are ordered by their linear index, which increases with z, so
+/// truncating the range would drop the top of the cloud.
+void KeepEvenlySpacedCells(size_t max_p,
+                           size_t fdim,
+                           size_t ldim,
+                           std::vector<PointXYZ>& points,
+                           std::vector<float>& features,
+                           std::vector<int>& classes) {
+    const size_t n = points.size();
+    if (n <= max_p) return;
+    for (size_t i = 0; i < max_p; ++i) {
+        // Increasing and never smaller than i, so the copy is in place.
+        const size_t c = i * n / max_p;
+        points[i] = points[c];
+        std::copy(features.begin() + c * fdim,
+                  features.begin() + (c + 1) * fdim,
+                  features.begin() + i * fdim);
+        std::copy(classes.begin() + c * ldim, classes.begin() + (c + 1) * ldim,
+                  classes.begin() + i * ldim);
+    }
+    points.resize(max_p);
+    features.resize(max_p * fdim);
+    classes.resize(max_p * ldim);
+}
+
+}  // namespace
+
 void grid_subsampling(std::vector<PointXYZ>& original_points,
                       std::vector<PointXYZ>& subsampled_points,
                       std::vector<float>& original_features,
@@ -36,104 +199,43 @@ void grid_subsampling(std::vector<PointXYZ>& original_points,
                       std::vector<int>& subsampled_classes,
                       float sampleDl,
                       int verbose) {
-    // Initialize variables
-    // ******************
-
     // Number of points in the cloud
     size_t N = original_points.size();
+    if (N == 0) return;
 
     // Dimension of the features
     size_t fdim = original_features.size() / N;
     size_t ldim = original_classes.size() / N;
 
-    // Limits of the cloud
-    PointXYZ minCorner = min_point(original_points);
-    PointXYZ maxCorner = max_point(original_points);
-    PointXYZ originCorner =
-            PointXYZ::floor(minCorner * (1 / sampleDl)) * sampleDl;
-
-    // Dimensions of the grid
-    size_t sampleNX =
-            (size_t)floor((maxCorner.x - originCorner.x) / sampleDl) + 1;
-    size_t sampleNY =
-            (size_t)floor((maxCorner.y - originCorner.y) / sampleDl) + 1;
-    // size_t sampleNZ = (size_t)floor((maxCorner.z - originCorner.z) /
-    // sampleDl) + 1;
-
-    // Check if features and classes need to be processed
-    bool use_feature = original_features.size() > 0;
-    bool use_classes = original_classes.size() > 0;
-
-    // Create the sampled map
-    // **********************
-
-    // Verbose parameters
-    int i = 0;
-    int nDisp = static_cast<int>(N / 100);
-
-    // Initialize variables
-    std::unordered_map<size_t, SampledData> data;
-
-    for (auto& p : original_points) {
-        size_t iX, iY, iZ, mapIdx;
-
-        // Position of point in sample map
-        iX = (size_t)std::floor((p.x - originCorner.x) / sampleDl);
-        iY = (size_t)std::floor((p.y - originCorner.y) / sampleDl);
-        iZ = (size_t)std::floor((p.z - originCorner.z) / sampleDl);
-        mapIdx = iX + sampleNX * iY + sampleNX * sampleNY * iZ;
-
-        // If not already created, create key
-        if (data.count(mapIdx) < 1)
-            data.emplace(mapIdx, SampledData(fdim, ldim));
-
-        // Fill the sample map
-        if (use_feature && use_classes)
-            data[mapIdx].update_all(p, original_features.begin() + i * fdim,
-                                    original_classes.begin() + i * ldim);
-        else if (use_feature)
-            data[mapIdx].update_features(p,
-                                         original_features.begin() + i * fdim);
-        else if (use_classes)
-            data[mapIdx].update_classes(p, original_classes.begin() + i * ldim);
-        else
-            data[mapIdx].update_points(p);
-
-        // Display
-        i++;
-        if (verbose > 1 && i % nDisp == 0)
-            std::cout << "\rSampled Map : " << std::setw(3) << i / nDisp << "%";
+    std::vector<PointXYZ> points;
+    std::vector<float> features;
+    std::vector<int> classes;
+    GridSubsamplingRange(original_points.data(), N, original_features.data(),
+                         fdim, original_classes.data(), ldim, sampleDl, points,
+                         features, classes);
+    if (verbose > 1) {
+        std::cout << "\rSampled Map : " << std::setw(3) << 100 << "%";
     }
 
-    // Divide for barycentre and transfer to a vector
-    subsampled_points.reserve(data.size());
-    if (use_feature) subsampled_features.reserve(data.size() * fdim);
-    if (use_classes) subsampled_classes.reserve(data.size() * ldim);
-    for (auto& v : data) {
-        subsampled_points.push_back(v.second.point * (1.0f / v.second.count));
-        if (use_feature) {
-            float count = (float)v.second.count;
-            transform(v.second.features.begin(), v.second.features.end(),
-                      v.second.features.begin(),
-                      [count](float f) { return f / count; });
-            subsampled_features.insert(subsampled_features.end(),
-                                       v.second.features.begin(),
-                                       v.second.features.end());
-        }
-        if (use_classes) {
-            for (int i = 0; i < static_cast<int>(ldim); i++)
-                subsampled_classes.push_back(
-                        max_element(v.second.labels[i].begin(),
-                                    v.second.labels[i].end(),
-                                    [](const std::pair<int, int>& a,
-                                       const std::pair<int, int>& b) {
-                                        return a.second < b.second;
-                                    })
-                                ->first);
-        }
+    // Append to the outputs, as callers may pass non-empty vectors.
+    if (subsampled_points.empty()) {
+        subsampled_points.swap(points);
+    } else {
+        subsampled_points.insert(subsampled_points.end(), points.begin(),
+                                 points.end());
+    }
+    if (subsampled_features.empty()) {
+        subsampled_features.swap(features);
+    } else {
+        subsampled_features.insert(subsampled_features.end(), features.begin(),
+                                   features.end());
+    }
+    if (subsampled_classes.empty()) {
+        subsampled_classes.swap(classes);
+    } else {
+        subsampled_classes.insert(subsampled_classes.end(), classes.begin(),
+                                  classes.end());
     }
-
-    return;
 }
 
 void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
@@ -146,98 +248,61 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
                             std::vector<int>& subsampled_batches,
                             float sampleDl,
                             int max_p) {
-    // Initialize variables
-    // ******************
-
-    int b = 0;
-    int sum_b = 0;
-
     // Number of points in the cloud
     size_t N = original_points.size();
+    size_t num_batches = original_batches.size();
 
     // Dimension of the features
-    size_t fdim = original_features.size() / N;
-    size_t ldim = original_classes.size() / N;
+    size_t fdim = N > 0 ? original_features.size() / N : 0;
+    size_t ldim = N > 0 ? original_classes.size() / N : 0;
 
     // Handle max_p = 0
     if (max_p < 1) max_p = static_cast<int>(N);
 
-    // Loop over batches
-    // *****************
-
-    for (b = 0; b < static_cast<int>(original_batches.size()); b++) {
-        // Extract batch points features and labels
-        std::vector<PointXYZ> b_o_points = std::vector<PointXYZ>(
-                original_points.begin() + sum_b,
-                original_points.begin() + sum_b + original_batches[b]);
-
-        std::vector<float> b_o_features;
-        if (original_features.size() > 0) {
-            b_o_features = std::vector<float>(
-                    original_features.begin() + sum_b * fdim,
-                    original_features.begin() +
-                            (sum_b + original_batches[b]) * fdim);
-        }
-
-        std::vector<int> b_o_classes;
-        if (original_classes.size() > 0) {
-            b_o_classes =
-                    std::vector<int>(original_classes.begin() + sum_b * ldim,
-                                     original_classes.begin() + sum_b +
-                                             original_batches[b] * ldim);
-        }
-
-        // Create result containers
-        std::vector<PointXYZ> b_s_points;
-        std::vector<float> b_s_features;
-        std::vector<int> b_s_classes;
-
-        // Compute subsampling on current batch
-        grid_subsampling(b_o_points, b_s_points, b_o_features, b_s_features,
-                         b_o_classes, b_s_classes, sampleDl, 0);
+    // Start of each batch in the input
+    std::vector<size_t> batch_starts(num_batches + 1, 0);
+    for (size_t b = 0; b < num_batches; ++b) {
+        batch_starts[b + 1] = batch_starts[b] + original_batches[b];
+    }
 
-        // Stack batches points features and labels
-        // ****************************************
+    // Subsample all batches in parallel. Large batches are parallelized
+    // internally as well.
+    std::vector<std::vector<PointXYZ>> b_s_points(num_batches);
+    std::vector<std::vector<float>> b_s_features(num_batches);
+    std::vector<std::vector<int>> b_s_classes(num_batches);
+    tbb::parallel_for(size_t(0), num_batches, [&](size_t b) {
+        const size_t start = batch_starts[b];
+        GridSubsamplingRange(
+                original_points.data() + start, original_batches[b],
+                fdim > 0 ? original_features.data() + start * fdim : nullptr,
+                fdim,
+                ldim > 0 ? original_classes.data() + start * ldim : nullptr,
+                ldim, sampleDl, b_s_points[b], b_s_features[b],
+                b_s_classes[b]);
 
         // If too many points remove some
-        if (static_cast<int>(b_s_points.size()) <= max_p) {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(), b_s_points.end());
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.end());
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.end());
-
-            subsampled_batches.push_back(static_cast<int>(b_s_points.size()));
-        } else {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(),
-                                     b_s_points.begin() + max_p);
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.begin() + max_p * fdim);
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.begin() + max_p * ldim);
-
-            subsampled_batches.push_back(max_p);
-        }
-
-        // Stack new batch lengths
-        sum_b += original_batches[b];
+        KeepEvenlySpacedCells(static_cast<size_t>(max_p), fdim, ldim,
+                              b_s_points[b], b_s_features[b], b_s_classes[b]);
+    });
+
+    // Stack batches points features and labels
+    size_t num_subsampled = 0;
+    for (const auto& points : b_s_points) num_subsampled += points.size();
+    subsampled_points.reserve(subsampled_points.size() + num_subsampled);
+    subsampled_features.reserve(subsampled_features.size() +
+                                num_subsampled * fdim);
+    subsampled_classes.reserve(subsampled_classes.size() +
+                               num_subsampled * ldim);
+    for (size_t b = 0; b < num_batches; ++b) {
+        subsampled_points.insert(subsampled_points.end(),
+                                 b_s_points[b].begin(), b_s_points[b].end());
+        subsampled_features.insert(subsampled_features.end(),
+                                   b_s_features[b].begin(),
+                                   b_s_features[b].end());
+        subsampled_classes.insert(subsampled_classes.end(),
+                                  b_s_classes[b].begin(), b_s_classes[b].end());
+        subsampled_batches.push_back(static_cast<int>(b_s_points[b].size()));
     }
-
-    return;
 }
 
 }  // namespace contrib
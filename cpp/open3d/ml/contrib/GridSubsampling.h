@@ -23,7 +23,6 @@
 // SOFTWARE.
 
 #include <cstdint>
-#include <set>
 
 #include "open3d/ml/contrib/Cloud.h"
 
@@ -31,77 +30,10 @@ namespace open3d {
 namespace ml {
 namespace contrib {
 
-class SampledData {
-public:
-    // Elements
-    // ********
-
-    int count;
-    PointXYZ point;
-    std::vector<float> features;
-    std::vector<std::unordered_map<int, int>> labels;
-
-    // Methods
-    // *******
-
-    // Constructor
-    SampledData() {
-        count = 0;
-        point = PointXYZ();
-    }
-
-    SampledData(const size_t fdim, const size_t ldim) {
-        count = 0;
-        point = PointXYZ();
-        features = std::vector<float>(fdim);
-        labels = std::vector<std::unordered_map<int, int>>(ldim);
-    }
-
-    // Method Update
-    void update_all(const PointXYZ p,
-                    std::vector<float>::iterator f_begin,
-                    std::vector<int>::iterator l_begin) {
-        count += 1;
-        point += p;
-        transform(features.begin(), features.end(), f_begin, features.begin(),
-                  std::plus<float>());
-        int i = 0;
-        for (std::vector<int>::iterator it = l_begin;
-             it != l_begin + labels.size(); ++it) {
-            labels[i][*it] += 1;
-            i++;
-        }
-        return;
-    }
-
-    void update_features(const PointXYZ p,
-                         std::vector<float>::iterator f_begin) {
-        count += 1;
-        point += p;
-        transform(features.begin(), features.end(), f_begin, features.begin(),
-                  std::plus<float>());
-        return;
-    }
-
-    void update_classes(const PointXYZ p, std::vector<int>::iterator l_begin) {
-        count += 1;
-        point += p;
-        int i = 0;
-        for (std::vector<int>::iterator it = l_begin;
-             it != l_begin + labels.size(); ++it) {
-            labels[i][*it] += 1;
-            i++;
-        }
-        return;
-    }
-
-    void update_points(const PointXYZ p) {
-        count += 1;
-        point += p;
-        return;
-    }
-};
-
+/// Subsamples a point cloud by replacing all points that fall into the same
+/// grid cell of size \p sampleDl with their barycenter. Features are averaged
+/// and each label channel takes the most frequent class of the cell (the
+/// smallest class wins ties). Subsampled points are ordered by grid cell.
 void grid_subsampling(std::vector<PointXYZ>& original_points,
                       std::vector<PointXYZ>& subsampled_points,
                       std::vector<float>& original_features,
@@ -111,6 +43,10 @@ void grid_subsampling(std::vector<PointXYZ>& original_points,
                       float sampleDl,
                       int verbose);
 
+/// Applies grid_subsampling to each batch of \p original_batches in parallel
+/// and keeps at most \p max_p subsampled points per batch (all points if
+/// \p max_p < 1), picked evenly over the cell order. Results are concatenated
+/// in batch order.
 void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
                             std::vector<PointXYZ>& subsampled_points,
                             std::vector<float>& original_features,
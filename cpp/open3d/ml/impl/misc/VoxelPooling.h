@@ -26,12 +26,18 @@
 
 #pragma once
 
-#include <tbb/task_group.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #include <Eigen/Core>
-#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
 
-#include "open3d/utility/Helper.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace ml {
@@ -276,6 +282,157 @@ Eigen::Vector3i ComputeVoxelIndex(
     return voxel_index;
 }
 
+/// Groups points by voxel.
+///
+/// On return, \p sorted_points holds the indices of all points sorted by
+/// their voxel index in lexicographic order. Points of the same voxel stay in
+/// input order, so that accumulating them gives the same result as a serial
+/// loop over the input. \p voxel_starts holds the start of each voxel in
+/// \p sorted_points followed by \p num_points.
+///
+/// \param num_points    The number of points.
+/// \param positions     Array with 3D point positions.
+/// \param voxel_size    The voxel size.
+/// \param voxel_indices    Output array with the voxel index of each point.
+/// \param sorted_points    Output array with the point indices sorted by
+///        voxel.
+/// \param voxel_starts    Output array with the start of each voxel.
+///
+template <class TReal>
+void GroupPointsByVoxel(size_t num_points,
+                        const TReal* const positions,
+                        TReal voxel_size,
+                        std::vector<Eigen::Vector3i>& voxel_indices,
+                        std::vector<size_t>& sorted_points,
+                        std::vector<size_t>& voxel_starts) {
+    typedef Eigen::Array<TReal, 3, 1> Vec3_t;
+    const TReal inv_voxel_size = 1 / voxel_size;
+
+    voxel_indices.resize(num_points);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              Eigen::Map<const Vec3_t> pos(positions + i * 3);
+                              voxel_indices[i] =
+                                      ComputeVoxelIndex(pos, inv_voxel_size);
+                          }
+                      });
+
+    Eigen::Array<int64_t, 3, 1> min_index(0, 0, 0), max_index(0, 0, 0);
+    if (num_points > 0) {
+        min_index = voxel_indices[0].cast<int64_t>().array();
+        max_index = min_index;
+        for (size_t i = 1; i < num_points; ++i) {
+            min_index = min_index.min(voxel_indices[i].cast<int64_t>().array());
+            max_index = max_index.max(voxel_indices[i].cast<int64_t>().array());
+        }
+    }
+
+    // Sort by a linear voxel key if the voxel grid spanned by the points fits
+    // into 63 bits, which is much faster than comparing the 3 coordinates.
+    // Dense grids with at most one cell per point use a counting sort.
+    const Eigen::Array<int64_t, 3, 1> extents = max_index - min_index + 1;
+    const double num_cells_f =
+            double(extents(0)) * double(extents(1)) * double(extents(2));
+    const bool use_linear_key =
+            num_cells_f < double(std::numeric_limits<int64_t>::max());
+    const int64_t num_cells = use_linear_key ? int64_t(num_cells_f) : 0;
+    auto LinearKey = [&](size_t i) {
+        const Eigen::Array<int64_t, 3, 1> v =
+                voxel_indices[i].cast<int64_t>().array() - min_index;
+        return (v(0) * extents(1) + v(1)) * extents(2) + v(2);
+    };
+
+    sorted_points.resize(num_points);
+    if (use_linear_key && num_cells <= int64_t(num_points)) {
+        // Each chunk of points counts its cells, so that the scatter below
+        // can be done per chunk while keeping the input order.
+        const int64_t num_chunks = std::max<int64_t>(
+                1, std::min<int64_t>(64, num_points / num_cells));
+        const size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
+        std::vector<size_t> offsets(num_chunks * num_cells, 0);
+        tbb::parallel_for(int64_t(0), num_chunks, [&](int64_t c) {
+            size_t* counts = offsets.data() + c * num_cells;
+            const size_t end = std::min(num_points, (c + 1) * chunk_size);
+            for (size_t i = c * chunk_size; i < end; ++i) {
+                ++counts[LinearKey(i)];
+            }
+        });
+        size_t offset = 0;
+        for (int64_t cell = 0; cell < num_cells; ++cell) {
+            for (int64_t c = 0; c < num_chunks; ++c) {
+                const size_t count = offsets[c * num_cells + cell];
+                offsets[c * num_cells + cell] = offset;
+                offset += count;
+            }
+        }
+        tbb::parallel_for(int64_t(0), num_chunks, [&](int64_t c) {
+            size_t* chunk_offsets = offsets.data() + c * num_cells;
+            const size_t end = std::min(num_points, (c + 1) * chunk_size);
+            for (size_t i = c * chunk_size; i < end; ++i) {
+                sorted_points[chunk_offsets[LinearKey(i)]++] = i;
+            }
+        });
+    } else {
+        std::vector<std::pair<int64_t, size_t>> key_point(num_points);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                          [&](const tbb::blocked_range<size_t>& r) {
+                              for (size_t i = r.begin(); i != r.end(); ++i) {
+                                  key_point[i].first =
+                                          use_linear_key ? LinearKey(i) : 0;
+                                  key_point[i].second = i;
+                              }
+                          });
+        if (use_linear_key) {
+            tbb::parallel_sort(key_point.begin(), key_point.end());
+        } else {
+            tbb::parallel_sort(
+                    key_point.begin(), key_point.end(),
+                    [&](const std::pair<int64_t, size_t>& a,
+                        const std::pair<int64_t, size_t>& b) {
+                        const Eigen::Vector3i& va = voxel_indices[a.second];
+                        const Eigen::Vector3i& vb = voxel_indices[b.second];
+                        return std::tie(va(0), va(1), va(2), a.second) <
+                               std::tie(vb(0), vb(1), vb(2), b.second);
+                    });
+        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                          [&](const tbb::blocked_range<size_t>& r) {
+                              for (size_t i = r.begin(); i != r.end(); ++i) {
+                                  sorted_points[i] = key_point[i].second;
+                              }
+                          });
+    }
+
+    // Number the voxels in sorted order and scatter their starts.
+    std::vector<size_t> voxel_ids(num_points);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              const bool is_start =
+                                      i == 0 ||
+                                      voxel_indices[sorted_points[i - 1]] !=
+                                              voxel_indices[sorted_points[i]];
+                              voxel_ids[i] = is_start ? 1 : 0;
+                          }
+                      });
+    utility::InclusivePrefixSum(voxel_ids.data(),
+                                voxel_ids.data() + num_points,
+                                voxel_ids.data());
+
+    const size_t num_voxels = num_points > 0 ? voxel_ids.back() : 0;
+    voxel_starts.resize(num_voxels + 1);
+    voxel_starts[num_voxels] = num_points;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_points),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              if (i == 0 || voxel_ids[i - 1] != voxel_ids[i]) {
+                                  voxel_starts[voxel_ids[i] - 1] = i;
+                              }
+                          }
+                      });
+}
+
 // implementation for VoxelPooling with template parameter for the accumulator.
 template <class TReal, class TFeat, class ACCUMULATOR, class OUTPUT_ALLOCATOR>
 void _VoxelPooling(size_t num_inp,
@@ -295,47 +452,52 @@ void _VoxelPooling(size_t num_inp,
     typedef Eigen::Array<TReal, 3, 1> Vec3_t;
     typedef Eigen::Array<TFeat, Eigen::Dynamic, 1> FeatureVec_t;
 
-    std::unordered_map<Eigen::Vector3i, ACCUMULATOR,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<size_t> sorted_points, voxel_starts;
+    GroupPointsByVoxel(num_inp, inp_positions, voxel_size, voxel_indices,
+                       sorted_points, voxel_starts);
 
-    Vec3_t voxel_center;
-    Eigen::Vector3i voxel_index;
-    TReal inv_voxel_size = 1 / voxel_size;
-    TReal half_voxel_size = 0.5 * voxel_size;
-    for (size_t i = 0; i < num_inp; ++i) {
-        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-        voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-        voxel_center << voxel_index(0) * voxel_size + half_voxel_size,
-                voxel_index(1) * voxel_size + half_voxel_size,
-                voxel_index(2) * voxel_size + half_voxel_size;
-
-        Eigen::Map<const FeatureVec_t> feat(inp_features + in_channels * i,
-                                            in_channels);
-        voxelindex_to_accpoint[voxel_index].AddPoint(
-                pos.matrix(), voxel_center.matrix(), feat);
-    }
-
-    const size_t num_out = voxelindex_to_accpoint.size();
+    const size_t num_out = voxel_starts.size() - 1;
 
     TReal* out_pos_ptr;
     TFeat* out_feat_ptr;
     output_allocator.AllocPooledPositions(&out_pos_ptr, num_out);
     output_allocator.AllocPooledFeatures(&out_feat_ptr, num_out, in_channels);
 
-    size_t i = 0;
-    for (const auto point : voxelindex_to_accpoint) {
-        Vec3_t pos = point.second.Position();
-        Eigen::Map<Vec3_t> out_pos(out_pos_ptr + i * 3);
-        out_pos = pos;
-
-        Eigen::Map<FeatureVec_t> out_feat(out_feat_ptr + i * in_channels,
-                                          in_channels);
-        out_feat = point.second.Features();
-        ++i;
-    }
+    // Each voxel is accumulated by one thread, in input order.
+    const TReal half_voxel_size = 0.5 * voxel_size;
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_out),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const Eigen::Vector3i& voxel_index =
+                            voxel_indices[sorted_points[voxel_starts[i]]];
+                    Vec3_t voxel_center;
+                    voxel_center
+                            << voxel_index(0) * voxel_size + half_voxel_size,
+                            voxel_index(1) * voxel_size + half_voxel_size,
+                            voxel_index(2) * voxel_size + half_voxel_size;
+
+                    ACCUMULATOR accumulator;
+                    for (size_t k = voxel_starts[i]; k < voxel_starts[i + 1];
+                         ++k) {
+                        const size_t point_i = sorted_points[k];
+                        Eigen::Map<const Vec3_t> pos(inp_positions +
+                                                     point_i * 3);
+                        Eigen::Map<const FeatureVec_t> feat(
+                                inp_features + in_channels * point_i,
+                                in_channels);
+                        accumulator.AddPoint(pos.matrix(),
+                                             voxel_center.matrix(), feat);
+                    }
+
+                    Eigen::Map<Vec3_t> out_pos(out_pos_ptr + i * 3);
+                    out_pos = accumulator.Position();
+                    Eigen::Map<FeatureVec_t> out_feat(
+                            out_feat_ptr + i * in_channels, in_channels);
+                    out_feat = accumulator.Features();
+                }
+            });
 }
 
 // implementation for VoxelPoolingBackprop with template parameter for the
@@ -358,102 +520,96 @@ void _VoxelPoolingBackprop(TFeat* features_backprop,
     typedef Eigen::Array<TReal, 3, 1> Vec3_t;
     typedef Eigen::Array<TFeat, Eigen::Dynamic, 1> FeatureVec_t;
 
-    Vec3_t voxel_size3(voxel_size, voxel_size, voxel_size);
-
-    // create the two hash maps in parallel
-    tbb::task_group task_group;
-
-    std::unordered_map<Eigen::Vector3i, ACCUMULATOR,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    task_group.run([&] {
-        Vec3_t voxel_center;
-        Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
-        TReal half_voxel_size = 0.5 * voxel_size;
-        for (size_t i = 0; i < num_inp; ++i) {
-            Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-            voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-            voxel_center << voxel_index(0) * voxel_size + half_voxel_size,
-                    voxel_index(1) * voxel_size + half_voxel_size,
-                    voxel_index(2) * voxel_size + half_voxel_size;
-
-            Eigen::Map<const FeatureVec_t> feat(inp_features + in_channels * i,
-                                                in_channels);
-            voxelindex_to_accpoint[voxel_index].AddPoint(
-                    pos.matrix(), voxel_center.matrix(), feat, i);
-        }
-    });
-
-    std::unordered_map<Eigen::Vector3i, size_t,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_gradindex;
-
-    task_group.run([&] {
-        Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
-        for (size_t i = 0; i < num_pooled; ++i) {
-            Eigen::Map<const Vec3_t> pos(pooled_positions + i * 3);
-
-            voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-            voxelindex_to_gradindex[voxel_index] = i;
-        }
-    });
-
-    task_group.wait();
-
-    if (FEAT_FN == AVERAGE) {
-        Eigen::Vector3i voxel_index;
-        TReal inv_voxel_size = 1 / voxel_size;
-        for (size_t i = 0; i < num_inp; ++i) {
-            Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-            voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-            Eigen::Map<FeatureVec_t> feat_bp(
-                    features_backprop + in_channels * i, in_channels);
-
-            size_t grad_idx = voxelindex_to_gradindex[voxel_index];
-            int count = voxelindex_to_accpoint[voxel_index].Count();
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            feat_bp = grad / count;
-        }
-    }
-
-    if (FEAT_FN == NEAREST_NEIGHBOR) {
-        for (const auto point : voxelindex_to_accpoint) {
-            size_t idx = point.second.Index()(0);
-            Eigen::Map<FeatureVec_t> feat_bp(
-                    features_backprop + in_channels * idx, in_channels);
-
-            size_t grad_idx = voxelindex_to_gradindex[point.first];
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            feat_bp = grad;
+    std::vector<Eigen::Vector3i> voxel_indices;
+    std::vector<size_t> sorted_points, voxel_starts;
+    GroupPointsByVoxel(num_inp, inp_positions, voxel_size, voxel_indices,
+                       sorted_points, voxel_starts);
+    const size_t num_voxels = voxel_starts.size() - 1;
+
+    // Pooled points sorted by voxel, for looking up the gradient of each
+    // voxel. If a voxel has several pooled points, the last one is used.
+    std::vector<Eigen::Vector3i> pooled_voxel_indices;
+    std::vector<size_t> pooled_sorted_points, pooled_voxel_starts;
+    GroupPointsByVoxel(num_pooled, pooled_positions, voxel_size,
+                       pooled_voxel_indices, pooled_sorted_points,
+                       pooled_voxel_starts);
+    auto GradIndex = [&](const Eigen::Vector3i& voxel_index) -> size_t {
+        auto it = std::upper_bound(
+                pooled_sorted_points.begin(), pooled_sorted_points.end(),
+                voxel_index, [&](const Eigen::Vector3i& v, size_t point_i) {
+                    const Eigen::Vector3i& w = pooled_voxel_indices[point_i];
+                    return std::tie(v(0), v(1), v(2)) <
+                           std::tie(w(0), w(1), w(2));
+                });
+        if (it == pooled_sorted_points.begin() ||
+            pooled_voxel_indices[*(it - 1)] != voxel_index) {
+            return 0;
         }
-    }
-
-    if (FEAT_FN == MAX) {
-        for (const auto point : voxelindex_to_accpoint) {
-            size_t grad_idx = voxelindex_to_gradindex[point.first];
-            Eigen::Map<const FeatureVec_t> grad(
-                    pooled_features_gradient + in_channels * grad_idx,
-                    in_channels);
-            for (int i = 0; i < in_channels; ++i) {
-                size_t idx = point.second.Index()(i);
-                Eigen::Map<FeatureVec_t> feat_bp(
-                        features_backprop + in_channels * idx, in_channels);
-                feat_bp(i) = grad(i);
-            }
-        }
-    }
+        return *(it - 1);
+    };
+
+    // Each voxel is handled by one thread. Voxels do not share points, so the
+    // threads write to disjoint rows of features_backprop.
+    const TReal half_voxel_size = 0.5 * voxel_size;
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_voxels),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const Eigen::Vector3i& voxel_index =
+                            voxel_indices[sorted_points[voxel_starts[i]]];
+                    Vec3_t voxel_center;
+                    voxel_center
+                            << voxel_index(0) * voxel_size + half_voxel_size,
+                            voxel_index(1) * voxel_size + half_voxel_size,
+                            voxel_index(2) * voxel_size + half_voxel_size;
+
+                    ACCUMULATOR accumulator;
+                    for (size_t k = voxel_starts[i]; k < voxel_starts[i + 1];
+                         ++k) {
+                        const size_t point_i = sorted_points[k];
+                        Eigen::Map<const Vec3_t> pos(inp_positions +
+                                                     point_i * 3);
+                        Eigen::Map<const FeatureVec_t> feat(
+                                inp_features + in_channels * point_i,
+                                in_channels);
+                        accumulator.AddPoint(pos.matrix(),
+                                             voxel_center.matrix(), feat,
+                                             point_i);
+                    }
+
+                    const size_t grad_idx = GradIndex(voxel_index);
+                    Eigen::Map<const FeatureVec_t> grad(
+                            pooled_features_gradient + in_channels * grad_idx,
+                            in_channels);
+
+                    if (FEAT_FN == AVERAGE) {
+                        const int count = accumulator.Count();
+                        for (size_t k = voxel_starts[i];
+                             k < voxel_starts[i + 1]; ++k) {
+                            Eigen::Map<FeatureVec_t> feat_bp(
+                                    features_backprop +
+                                            in_channels * sorted_points[k],
+                                    in_channels);
+                            feat_bp = grad / count;
+                        }
+                    }
+
+                    if (FEAT_FN == NEAREST_NEIGHBOR) {
+                        size_t idx = accumulator.Index()(0);
+                        Eigen::Map<FeatureVec_t> feat_bp(
+                                features_backprop + in_channels * idx,
+                                in_channels);
+                        feat_bp = grad;
+                    }
+
+                    if (FEAT_FN == MAX) {
+                        for (int c = 0; c < in_channels; ++c) {
+                            size_t idx = accumulator.Index()(c);
+                            features_backprop[in_channels * idx + c] = grad(c);
+                        }
+                    }
+                }
+            });
 }
 
 /// Pooling operation for point clouds. Aggregates points that are inside the
@@ -29,9 +29,9 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 
+#include <algorithm>
 #include <vector>
 
-#include "open3d/core/Atomic.h"
 #include "open3d/utility/MiniVec.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -123,6 +123,17 @@ void VoxelizeCPU(size_t num_points,
         return invalid_hash;
     };
 
+    if (num_points == 0) {
+        int32_t* out_voxel_coords = nullptr;
+        output_allocator.AllocVoxelCoords(&out_voxel_coords, 0, NDIM);
+        int64_t* out_voxel_row_splits = nullptr;
+        output_allocator.AllocVoxelPointRowSplits(&out_voxel_row_splits, 1);
+        out_voxel_row_splits[0] = 0;
+        int64_t* out_point_indices = nullptr;
+        output_allocator.AllocVoxelPointIndices(&out_point_indices, 0);
+        return;
+    }
+
     std::vector<std::pair<int64_t, int64_t>> hashes_indices(num_points);
     tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_points),
                       [&](const tbb::blocked_range<int64_t>& r) {
@@ -134,20 +145,49 @@ void VoxelizeCPU(size_t num_points,
                       });
     tbb::parallel_sort(hashes_indices);
 
-    uint64_t num_voxels = 1;
-    tbb::parallel_for(tbb::blocked_range<int64_t>(1, hashes_indices.size()),
+    // Number the voxels in sorted order. voxel_ids[i] is the id of the voxel
+    // of hashes_indices[i] plus one.
+    std::vector<int64_t> voxel_ids(num_points);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_points),
                       [&](const tbb::blocked_range<int64_t>& r) {
                           for (int64_t i = r.begin(); i != r.end(); ++i) {
-                              if (hashes_indices[i - 1].first !=
-                                  hashes_indices[i].first) {
-                                  core::AtomicFetchAddRelaxed(&num_voxels, 1);
-                              }
+                              const bool is_start =
+                                      i == 0 || hashes_indices[i - 1].first !=
+                                                        hashes_indices[i].first;
+                              voxel_ids[i] = is_start ? 1 : 0;
                           }
                       });
+    InclusivePrefixSum(voxel_ids.data(), voxel_ids.data() + num_points,
+                       voxel_ids.data());
+
+    int64_t num_voxels = voxel_ids.back();
     if (invalid_hash == hashes_indices.back().first) {
         --num_voxels;
     }
-    num_voxels = std::min(int64_t(num_voxels), max_voxels);
+    num_voxels = std::min(num_voxels, max_voxels);
+
+    // Start of each voxel in hashes_indices, with an end marker.
+    std::vector<int64_t> voxel_starts(num_voxels + 1, num_points);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_points),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              const int64_t voxel_i = voxel_ids[i] - 1;
+                              const bool is_start =
+                                      i == 0 ||
+                                      voxel_ids[i - 1] != voxel_ids[i];
+                              if (voxel_i < num_voxels && is_start) {
+                                  voxel_starts[voxel_i] = i;
+                              }
+                          }
+                      });
+    // The end of the last voxel is the start of the next one, which may be
+    // the invalid voxel or a voxel dropped by max_voxels.
+    if (num_voxels < voxel_ids.back()) {
+        voxel_starts[num_voxels] =
+                std::lower_bound(voxel_ids.begin(), voxel_ids.end(),
+                                 num_voxels + 1) -
+                voxel_ids.begin();
+    }
 
     int32_t* out_voxel_coords = nullptr;
     output_allocator.AllocVoxelCoords(&out_voxel_coords, num_voxels, NDIM);
@@ -155,39 +195,42 @@ void VoxelizeCPU(size_t num_points,
     output_allocator.AllocVoxelPointRowSplits(&out_voxel_row_splits,
                                               num_voxels + 1);
 
-    std::vector<int64_t> tmp_point_indices;
-    {
-        int64_t hash_i = 0;  // index into the vector hashes_indices
-        for (int64_t voxel_i = 0; voxel_i < num_voxels; ++voxel_i) {
-            // compute voxel coord and the prefix sum value
-            auto coord = CoordFn(
-                    Vec_t(points + hashes_indices[hash_i].second * NDIM));
-            for (int d = 0; d < NDIM; ++d) {
-                out_voxel_coords[voxel_i * NDIM + d] = coord[d];
-            }
-            out_voxel_row_splits[voxel_i] = tmp_point_indices.size();
-
-            // add up to max_points_per_voxel indices for this voxel
-            int64_t points_per_voxel = 0;
-            const int64_t current_hash = hashes_indices[hash_i].first;
-            for (; hash_i < hashes_indices.size(); ++hash_i) {
-                if (current_hash != hashes_indices[hash_i].first) {
-                    // new voxel starts -> break
-                    break;
-                }
-                if (points_per_voxel < max_points_per_voxel) {
-                    tmp_point_indices.push_back(hashes_indices[hash_i].second);
-                    ++points_per_voxel;
-                }
-            }
-        }
-        out_voxel_row_splits[num_voxels] = tmp_point_indices.size();
-    }
+    // Each voxel keeps up to max_points_per_voxel points.
+    out_voxel_row_splits[0] = 0;
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_voxels),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              out_voxel_row_splits[i + 1] = std::min(
+                                      voxel_starts[i + 1] - voxel_starts[i],
+                                      max_points_per_voxel);
+                          }
+                      });
+    InclusivePrefixSum(out_voxel_row_splits + 1,
+                       out_voxel_row_splits + num_voxels + 1,
+                       out_voxel_row_splits + 1);
+
     int64_t* out_point_indices = nullptr;
     output_allocator.AllocVoxelPointIndices(&out_point_indices,
-                                            tmp_point_indices.size());
-    memcpy(out_point_indices, tmp_point_indices.data(),
-           tmp_point_indices.size() * sizeof(int64_t));
+                                            out_voxel_row_splits[num_voxels]);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t voxel_i = r.begin(); voxel_i != r.end();
+                     ++voxel_i) {
+                    const int64_t hash_i = voxel_starts[voxel_i];
+                    auto coord = CoordFn(Vec_t(
+                            points + hashes_indices[hash_i].second * NDIM));
+                    for (int d = 0; d < NDIM; ++d) {
+                        out_voxel_coords[voxel_i * NDIM + d] = coord[d];
+                    }
+                    const int64_t begin = out_voxel_row_splits[voxel_i];
+                    const int64_t end = out_voxel_row_splits[voxel_i + 1];
+                    for (int64_t j = begin; j < end; ++j) {
+                        out_point_indices[j] =
+                                hashes_indices[hash_i + j - begin].second;
+                    }
+                }
+            });
 }
 
 }  // namespace impl
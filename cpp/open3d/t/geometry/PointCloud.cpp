@@ -27,8 +27,11 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 
 #include "open3d/core/EigenConverter.h"
@@ -36,6 +39,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
@@ -141,7 +145,7 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     core::TensorKey::Slice(length, combined_length, 1),
                     other_attr);
 
-            pcd.SetPointAttr(kv.first, combined_attr.Clone());
+            pcd.SetPointAttr(kv.first, combined_attr);
         } else {
             utility::LogError(
                     "The pointcloud is missing attribute {}. The pointcloud "
@@ -154,6 +158,19 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
     return pcd;
 }
 
+PointCloud &PointCloud::Extend(const PointCloud &other) {
+    if (!other.IsEmpty()) {
+        other.GetPoints().AssertDevice(GetDevice());
+    }
+    point_attr_.Extend(other.point_attr_);
+    return *this;
+}
+
+PointCloud &PointCloud::Reserve(int64_t num_points) {
+    point_attr_.Reserve(num_points);
+    return *this;
+}
+
 PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     kernel::transform::TransformPoints(transformation, GetPoints());
     if (HasPointNormals()) {
@@ -224,6 +241,98 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+PointCloud PointCloud::SelectByMask(const core::Tensor &boolean_mask,
+                                    bool invert) const {
+    const int64_t length = GetPoints().GetLength();
+    boolean_mask.AssertDtype(core::Bool);
+    boolean_mask.AssertShape({length});
+    boolean_mask.AssertDevice(device_);
+
+    const core::Tensor indices_mask =
+            invert ? boolean_mask.LogicalNot() : boolean_mask;
+    PointCloud pcd_select(device_);
+    for (auto &kv : point_attr_) {
+        if (kv.second.GetLength() == length) {
+            pcd_select.SetPointAttr(kv.first,
+                                    kv.second.IndexGet({indices_mask}));
+        }
+    }
+    return pcd_select;
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Illegal input parameters, number of "
+                "points and radius must be positive.");
+    }
+    const int64_t num_points = GetPoints().GetLength();
+    if (num_points == 0) {
+        return std::make_tuple(PointCloud(device_),
+                               core::Tensor({0}, core::Bool, device_));
+    }
+
+    core::nns::NearestNeighborSearch nns(GetPoints());
+    if (!nns.FixedRadiusIndex(search_radius)) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Building fixed radius index failed.");
+    }
+    core::Tensor row_splits;
+    std::tie(std::ignore, std::ignore, row_splits) =
+            nns.FixedRadiusSearch(GetPoints(), search_radius, false);
+    const core::Tensor num_neighbors =
+            row_splits.Slice(0, 1, num_points + 1) -
+            row_splits.Slice(0, 0, num_points);
+
+    const core::Tensor valid =
+            num_neighbors.Gt(static_cast<int64_t>(nb_points));
+    return std::make_tuple(SelectByMask(valid), valid);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Illegal input parameters, number "
+                "of neighbors and standard deviation ratio must be positive.");
+    }
+    const int64_t num_points = GetPoints().GetLength();
+    if (num_points == 0) {
+        return std::make_tuple(PointCloud(device_),
+                               core::Tensor({0}, core::Bool, device_));
+    }
+
+    core::nns::NearestNeighborSearch nns(GetPoints());
+    if (!nns.KnnIndex()) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Building KNN index failed.");
+    }
+    const int knn = static_cast<int>(
+            std::min(static_cast<int64_t>(nb_neighbors), num_points));
+    core::Tensor distance2;
+    std::tie(std::ignore, distance2) = nns.KnnSearch(GetPoints(), knn);
+
+    // Statistics are accumulated in double precision to match the legacy
+    // implementation for large clouds.
+    const core::Tensor avg_distances =
+            distance2.Sqrt().Mean({1}).To(core::Float64);
+    const core::Tensor positive = avg_distances.Gt(0.0);
+    const double cloud_mean =
+            avg_distances.Sum({0}).Item<double>() / num_points;
+    const core::Tensor deviation = avg_distances - cloud_mean;
+    const double sq_sum = (deviation * deviation * positive.To(core::Float64))
+                                  .Sum({0})
+                                  .Item<double>();
+    // Bessel's correction.
+    const double std_dev = std::sqrt(sq_sum / (num_points - 1));
+    const double distance_threshold = cloud_mean + std_ratio * std_dev;
+
+    const core::Tensor valid =
+            positive.LogicalAnd(avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(valid), valid);
+}
+
 static PointCloud CreatePointCloudWithNormals(
         const Image &depth_in, /* UInt16 or Float32 */
         const Image &color_in, /* Float32 */
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -250,7 +251,7 @@ public:
 
     /// Clear all data in the pointcloud.
     PointCloud &Clear() override {
-        point_attr_.clear();
+        point_attr_.Clear();
         return *this;
     }
 
@@ -279,6 +280,26 @@ public:
         return Append(other);
     }
 
+    /// Appends a pointcloud in place.
+    ///
+    /// Unlike Append(), memory is reserved with geometric growth, so that
+    /// accumulating many pointclouds copies each point an amortized constant
+    /// number of times. Attributes shared with other pointclouds, e.g. after a
+    /// shallow copy, are copied before they are modified. The requirements on
+    /// \p other are the same as for Append(). If this pointcloud is empty, it
+    /// becomes a shallow copy of \p other.
+    PointCloud &Extend(const PointCloud &other);
+
+    /// Reserves memory for \p num_points points in all point attributes.
+    PointCloud &Reserve(int64_t num_points);
+
+    /// Returns the number of points that can be held without reallocation.
+    int64_t GetCapacity() const {
+        return point_attr_.Contains("points")
+                       ? point_attr_.GetCapacity("points")
+                       : 0;
+    }
+
     /// \brief Transforms the points and normals (if exist)
     /// of the PointCloud.
     /// Extracts R, t from Transformation
@@ -321,6 +342,99 @@ public:
                                const core::HashmapBackend &backend =
                                        core::HashmapBackend::Default) const;
 
+    /// \brief Select points and all their attributes by a boolean mask.
+    ///
+    /// \param boolean_mask Boolean tensor of shape {N,} on the same device as
+    /// the point cloud.
+    /// \param invert If true, select the points where the mask is false.
+    /// \return Point cloud with the selected points.
+    PointCloud SelectByMask(const core::Tensor &boolean_mask,
+                            bool invert = false) const;
+
+    /// \brief Remove points that have less than \p nb_points neighbors in a
+    /// sphere of a given radius. The neighbor count includes the point
+    /// itself, as in the legacy geometry::PointCloud::RemoveRadiusOutliers.
+    ///
+    /// \param nb_points Number of points within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered point cloud and a boolean mask of shape
+    /// {N,} that is true for the points that are kept.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+    /// \brief Remove points that are further away from their \p nb_neighbors
+    /// neighbors in average. A point is kept if its average neighbor distance
+    /// is below mean + \p std_ratio * std of the average distances of all
+    /// points.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Tuple of the filtered point cloud and a boolean mask of shape
+    /// {N,} that is true for the points that are kept.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            size_t nb_neighbors, double std_ratio) const;
+
+    /// \brief Cluster the point cloud using the DBSCAN algorithm.
+    ///
+    /// Ester et al., "A Density-Based Algorithm for Discovering Clusters in
+    /// Large Spatial Databases with Noise", 1996. Core points are joined with
+    /// a parallel union-find over the fixed radius neighbor graph, and the
+    /// labels match the legacy ClusterDBSCAN.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \return Int32 tensor of shape {N} with the cluster label of each point,
+    /// and -1 for noise.
+    core::Tensor ClusterDBSCAN(double eps, size_t min_points) const;
+
+    /// \brief Segment a plane in the point cloud with batched RANSAC.
+    ///
+    /// Minimal samples of many hypotheses are fitted at once and scored
+    /// against all points in a single fused kernel, so the segmentation stays
+    /// on the device of the point cloud.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param num_iterations Number of hypotheses.
+    /// \param seed Sets the seed value used to draw the samples, set to -1 to
+    /// use a random seed value with each function call.
+    /// \return Tuple of the plane model ax + by + cz + d = 0 as a Float64
+    /// tensor of shape {4}, and a boolean inlier mask of shape {N}.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            double distance_threshold = 0.01,
+            int num_iterations = 100,
+            int seed = -1) const;
+
+    /// \brief Segment a sphere in the point cloud with batched RANSAC.
+    ///
+    /// \param distance_threshold Max distance a point can be from the sphere
+    /// surface, and still be considered an inlier.
+    /// \param num_iterations Number of hypotheses.
+    /// \param seed Sets the seed value used to draw the samples, set to -1 to
+    /// use a random seed value with each function call.
+    /// \return Tuple of the sphere model (cx, cy, cz, radius) as a Float64
+    /// tensor of shape {4}, and a boolean inlier mask of shape {N}.
+    std::tuple<core::Tensor, core::Tensor> SegmentSphere(
+            double distance_threshold = 0.01,
+            int num_iterations = 1000,
+            int seed = -1) const;
+
+    /// \brief Segment a cylinder in the point cloud with batched RANSAC.
+    /// Requires point normals.
+    ///
+    /// \param distance_threshold Max distance a point can be from the
+    /// cylinder surface, and still be considered an inlier.
+    /// \param num_iterations Number of hypotheses.
+    /// \param seed Sets the seed value used to draw the samples, set to -1 to
+    /// use a random seed value with each function call.
+    /// \return Tuple of the cylinder model (a point on the axis, the unit axis
+    /// direction and the radius) as a Float64 tensor of shape {7}, and a
+    /// boolean inlier mask of shape {N}.
+    std::tuple<core::Tensor, core::Tensor> SegmentCylinder(
+            double distance_threshold = 0.01,
+            int num_iterations = 1000,
+            int seed = -1) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps, size_t min_points) const {
+    if (eps <= 0) {
+        utility::LogError("[ClusterDBSCAN] eps must be positive, but got {}.",
+                          eps);
+    }
+    const int64_t num_points = GetPoints().GetLength();
+    if (num_points == 0) {
+        return core::Tensor({0}, core::Int32, device_);
+    }
+
+    utility::LogDebug("Precompute neighbors.");
+    core::nns::NearestNeighborSearch nns(GetPoints());
+    if (!nns.FixedRadiusIndex(eps)) {
+        utility::LogError(
+                "[ClusterDBSCAN] Building fixed radius index failed.");
+    }
+    core::Tensor neighbor_indices, row_splits;
+    std::tie(neighbor_indices, std::ignore, row_splits) =
+            nns.FixedRadiusSearch(GetPoints(), eps, false);
+
+    utility::LogDebug("Compute Clusters");
+    core::Tensor roots;
+    kernel::pointcloud::ClusterDBSCAN(neighbor_indices, row_splits, min_points,
+                                      roots);
+
+    // Each cluster is rooted at its smallest core point, which is where the
+    // sequential algorithm discovers it. Numbering the roots in index order
+    // thus reproduces the labels of the legacy implementation. Slot 0 of the
+    // lookup table maps noise (-1) to itself.
+    const core::Tensor root_indices =
+            roots.Eq(core::Tensor::Arange(0, num_points, 1, core::Int32,
+                                          device_))
+                    .NonZero()[0];
+    const int64_t num_clusters = root_indices.GetLength();
+    core::Tensor cluster_ids =
+            core::Tensor::Full({num_points + 1}, -1, core::Int32, device_);
+    cluster_ids.IndexSet({root_indices + 1},
+                         core::Tensor::Arange(0, num_clusters, 1, core::Int32,
+                                              device_));
+    utility::LogDebug("Done Compute Clusters: {:d}", num_clusters);
+    return cluster_ids.IndexGet({roots.To(core::Int64) + 1});
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
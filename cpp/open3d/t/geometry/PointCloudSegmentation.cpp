@@ -0,0 +1,339 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Eigenvalues>
+#include <functional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+using kernel::pointcloud::RANSACModelType;
+
+/// Fits a batch of models. Takes one {B, 3} tensor per sample position and
+/// returns the {B, M} models together with a {B} boolean validity mask.
+using FitModels = std::function<std::tuple<core::Tensor, core::Tensor>(
+        const std::vector<core::Tensor> &samples)>;
+
+/// Row-wise cross product of two {B, 3} tensors.
+core::Tensor Cross(const core::Tensor &a, const core::Tensor &b) {
+    const core::Tensor ax = a.Slice(1, 0, 1);
+    const core::Tensor ay = a.Slice(1, 1, 2);
+    const core::Tensor az = a.Slice(1, 2, 3);
+    const core::Tensor bx = b.Slice(1, 0, 1);
+    const core::Tensor by = b.Slice(1, 1, 2);
+    const core::Tensor bz = b.Slice(1, 2, 3);
+    core::Tensor c = core::Tensor::Empty(a.GetShape(), a.GetDtype(),
+                                         a.GetDevice());
+    c.Slice(1, 0, 1) = ay * bz - az * by;
+    c.Slice(1, 1, 2) = az * bx - ax * bz;
+    c.Slice(1, 2, 3) = ax * by - ay * bx;
+    return c;
+}
+
+/// Row-wise dot product of two {B, 3} tensors, of shape {B, 1}.
+core::Tensor Dot(const core::Tensor &a, const core::Tensor &b) {
+    return (a * b).Sum({1}, true);
+}
+
+/// Batched RANSAC. All \p num_iterations minimal samples are drawn at once,
+/// the models are fitted with tensor operations and scored in a single kernel
+/// launch that reduces the residuals of all points per hypothesis. As in the
+/// legacy geometry::PointCloud::SegmentPlane, the model with most inliers
+/// wins and ties are broken by the inlier RMSE.
+///
+/// \return The best model of shape {M} and the {N} boolean inlier mask. The
+/// model is empty if no valid model was found.
+std::tuple<core::Tensor, core::Tensor> RunRANSAC(const core::Tensor &points,
+                                                 RANSACModelType model_type,
+                                                 int sample_size,
+                                                 int num_iterations,
+                                                 double distance_threshold,
+                                                 int seed,
+                                                 const FitModels &fit_models) {
+    const int64_t num_points = points.GetLength();
+    const core::Device device = points.GetDevice();
+
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int64_t> dist(0, num_points - 1);
+    std::vector<core::Tensor> samples;
+    for (int i = 0; i < sample_size; ++i) {
+        std::vector<int64_t> indices(num_iterations);
+        for (int64_t &index : indices) {
+            index = dist(rng);
+        }
+        samples.push_back(
+                core::Tensor(indices, {num_iterations}, core::Int64, device));
+    }
+
+    core::Tensor models, valid;
+    std::tie(models, valid) = fit_models(samples);
+    core::Tensor inlier_counts, squared_errors;
+    kernel::pointcloud::ComputeRANSACScores(points, models, model_type,
+                                            distance_threshold, inlier_counts,
+                                            squared_errors);
+    const std::vector<int64_t> counts =
+            (inlier_counts * valid.To(core::Int64)).ToFlatVector<int64_t>();
+    const std::vector<double> errors = squared_errors.ToFlatVector<double>();
+
+    int64_t best_idx = -1;
+    int64_t best_inliers = 0;
+    double best_rmse = 0;
+    for (int64_t i = 0; i < num_iterations; ++i) {
+        if (counts[i] == 0) continue;
+        const double rmse = std::sqrt(errors[i] / counts[i]);
+        if (counts[i] > best_inliers ||
+            (counts[i] == best_inliers && rmse < best_rmse)) {
+            best_idx = i;
+            best_inliers = counts[i];
+            best_rmse = rmse;
+        }
+    }
+
+    if (best_idx < 0) {
+        return std::make_tuple(
+                core::Tensor(),
+                core::Tensor::Zeros({num_points}, core::Bool, device));
+    }
+    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
+                      best_inliers, double(best_inliers) / num_points,
+                      best_rmse);
+    const core::Tensor best_model = models[best_idx].Clone();
+    core::Tensor mask;
+    kernel::pointcloud::ComputeRANSACInliers(points, best_model, model_type,
+                                             distance_threshold, mask);
+    return std::make_tuple(best_model, mask);
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        double distance_threshold, int num_iterations, int seed) const {
+    const int64_t num_points = GetPoints().GetLength();
+    if (num_points < 3) {
+        utility::LogError("[SegmentPlane] There must be at least 3 points.");
+    }
+    if (distance_threshold <= 0 || num_iterations < 1) {
+        utility::LogError(
+                "[SegmentPlane] distance_threshold and num_iterations must be "
+                "positive.");
+    }
+
+    // Work relative to the centroid to limit cancellation in float32.
+    const core::Tensor centroid = GetPoints().Mean({0}, true);
+    const core::Tensor points = GetPoints() - centroid;
+
+    auto fit_models = [&](const std::vector<core::Tensor> &samples) {
+        const core::Tensor p0 = points.IndexGet({samples[0]});
+        const core::Tensor p1 = points.IndexGet({samples[1]});
+        const core::Tensor p2 = points.IndexGet({samples[2]});
+        const core::Tensor normals = Cross(p1 - p0, p2 - p0);
+        const core::Tensor norms = Dot(normals, normals).Sqrt();
+        const core::Tensor valid = norms.Gt(0).Reshape({norms.GetLength()});
+
+        core::Tensor models = core::Tensor::Empty(
+                {norms.GetLength(), 4}, points.GetDtype(), device_);
+        models.Slice(1, 0, 3) = normals / norms;
+        models.Slice(1, 3, 4) = Dot(models.Slice(1, 0, 3), p0).Neg();
+        return std::make_tuple(models, valid);
+    };
+
+    core::Tensor model, mask;
+    std::tie(model, mask) =
+            RunRANSAC(points, RANSACModelType::Plane, 3, num_iterations,
+                      distance_threshold, seed, fit_models);
+    if (model.NumElements() == 0) {
+        return std::make_tuple(
+                core::Tensor::Zeros({4}, core::Float64, device_), mask);
+    }
+
+    // Improve the plane with a least squares fit on the inliers, as in the
+    // legacy geometry::PointCloud::SegmentPlane. Only the 3x3 covariance is
+    // transferred to the host.
+    const core::Tensor inliers = points.IndexGet({mask});
+    const core::Tensor inlier_mean = inliers.Mean({0}, true);
+    const core::Tensor centered = inliers - inlier_mean;
+    const Eigen::Matrix3d covariance =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    centered.T().Matmul(centered));
+    const Eigen::Vector3d mean =
+            core::eigen_converter::TensorToEigenMatrixXd(inlier_mean +
+                                                         centroid)
+                    .transpose();
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    const Eigen::Vector3d ransac_normal =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    model.Slice(0, 0, 3).Reshape({1, 3}))
+                    .transpose();
+    if (normal.dot(ransac_normal) < 0) {
+        normal = -normal;
+    }
+    const std::vector<double> plane{normal(0), normal(1), normal(2),
+                                    -normal.dot(mean)};
+    return std::make_tuple(core::Tensor(plane, {4}, core::Float64, device_),
+                           mask);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentSphere(
+        double distance_threshold, int num_iterations, int seed) const {
+    const int64_t num_points = GetPoints().GetLength();
+    if (num_points < 4) {
+        utility::LogError("[SegmentSphere] There must be at least 4 points.");
+    }
+    if (distance_threshold <= 0 || num_iterations < 1) {
+        utility::LogError(
+                "[SegmentSphere] distance_threshold and num_iterations must "
+                "be positive.");
+    }
+
+    const core::Tensor centroid = GetPoints().Mean({0}, true);
+    const core::Tensor points = GetPoints() - centroid;
+
+    // The center c of the sphere through p0..p3 solves r_i . c = b_i with
+    // r_i = p_i - p0 and b_i = (|p_i|^2 - |p0|^2) / 2, which is solved in
+    // closed form with Cramer's rule.
+    auto fit_models = [&](const std::vector<core::Tensor> &samples) {
+        const core::Tensor p0 = points.IndexGet({samples[0]});
+        std::vector<core::Tensor> r, b;
+        for (int i = 1; i < 4; ++i) {
+            const core::Tensor pi = points.IndexGet({samples[i]});
+            r.push_back(pi - p0);
+            b.push_back(Dot(r.back(), pi + p0) * 0.5);
+        }
+        const core::Tensor r23 = Cross(r[1], r[2]);
+        const core::Tensor det = Dot(r[0], r23);
+        const core::Tensor scale = (Dot(r[0], r[0]) * Dot(r[1], r[1]) *
+                                    Dot(r[2], r[2]))
+                                           .Sqrt();
+        const int64_t num_models = det.GetLength();
+        const core::Tensor valid =
+                det.Abs().Gt(scale * 1e-6).Reshape({num_models});
+
+        const core::Tensor centers = (r23 * b[0] + Cross(r[2], r[0]) * b[1] +
+                                      Cross(r[0], r[1]) * b[2]) /
+                                     det;
+        core::Tensor models = core::Tensor::Empty(
+                {num_models, 4}, points.GetDtype(), device_);
+        models.Slice(1, 0, 3) = centers;
+        models.Slice(1, 3, 4) = Dot(p0 - centers, p0 - centers).Sqrt();
+        return std::make_tuple(models, valid);
+    };
+
+    core::Tensor model, mask;
+    std::tie(model, mask) =
+            RunRANSAC(points, RANSACModelType::Sphere, 4, num_iterations,
+                      distance_threshold, seed, fit_models);
+    if (model.NumElements() == 0) {
+        return std::make_tuple(
+                core::Tensor::Zeros({4}, core::Float64, device_), mask);
+    }
+    model.Slice(0, 0, 3) += centroid.Reshape({3});
+    return std::make_tuple(model.To(core::Float64), mask);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentCylinder(
+        double distance_threshold, int num_iterations, int seed) const {
+    const int64_t num_points = GetPoints().GetLength();
+    if (!HasPointNormals()) {
+        utility::LogError("[SegmentCylinder] Point normals are required.");
+    }
+    if (num_points < 2) {
+        utility::LogError("[SegmentCylinder] There must be at least 2 points.");
+    }
+    if (distance_threshold <= 0 || num_iterations < 1) {
+        utility::LogError(
+                "[SegmentCylinder] distance_threshold and num_iterations must "
+                "be positive.");
+    }
+
+    const core::Tensor centroid = GetPoints().Mean({0}, true);
+    const core::Tensor points = GetPoints() - centroid;
+    const core::Tensor normals = GetPointNormals().To(points.GetDtype());
+
+    // The axis is orthogonal to the normals n0, n1 of both samples. The point
+    // on the axis is the point of line p0 + t * n0 closest to line
+    // p1 + s * n1.
+    auto fit_models = [&](const std::vector<core::Tensor> &samples) {
+        const core::Tensor p0 = points.IndexGet({samples[0]});
+        const core::Tensor p1 = points.IndexGet({samples[1]});
+        const core::Tensor n0 = normals.IndexGet({samples[0]});
+        const core::Tensor n1 = normals.IndexGet({samples[1]});
+        const core::Tensor axes = Cross(n0, n1);
+        const core::Tensor axes_norm = Dot(axes, axes).Sqrt();
+        const int64_t num_models = axes.GetLength();
+        const core::Tensor valid = axes_norm.Gt(1e-6).Reshape({num_models});
+
+        const core::Tensor w = p0 - p1;
+        const core::Tensor a = Dot(n0, n0);
+        const core::Tensor b = Dot(n0, n1);
+        const core::Tensor c = Dot(n1, n1);
+        const core::Tensor d = Dot(n0, w);
+        const core::Tensor e = Dot(n1, w);
+        const core::Tensor t = (b * e - c * d) / (a * c - b * b);
+        const core::Tensor centers = p0 + n0 * t;
+
+        core::Tensor models = core::Tensor::Empty(
+                {num_models, 7}, points.GetDtype(), device_);
+        models.Slice(1, 0, 3) = centers;
+        models.Slice(1, 3, 6) = axes / axes_norm;
+        const core::Tensor v = p0 - centers;
+        const core::Tensor v_perp = v - models.Slice(1, 3, 6) *
+                                                Dot(v, models.Slice(1, 3, 6));
+        models.Slice(1, 6, 7) = Dot(v_perp, v_perp).Sqrt();
+        return std::make_tuple(models, valid);
+    };
+
+    core::Tensor model, mask;
+    std::tie(model, mask) =
+            RunRANSAC(points, RANSACModelType::Cylinder, 2, num_iterations,
+                      distance_threshold, seed, fit_models);
+    if (model.NumElements() == 0) {
+        return std::make_tuple(
+                core::Tensor::Zeros({7}, core::Float64, device_), mask);
+    }
+    model.Slice(0, 0, 3) += centroid.Reshape({3});
+    return std::make_tuple(model.To(core::Float64), mask);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
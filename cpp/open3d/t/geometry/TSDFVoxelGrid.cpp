@@ -26,9 +26,11 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -99,6 +101,7 @@ TSDFVoxelGrid::TSDFVoxelGrid(
                 "than half block size (i.e., block_resolution * voxel_size * "
                 "0.5)");
     }
+    core::ScopedMemoryTag memory_tag("TSDF/block_hashmap");
     block_hashmap_ = std::make_shared<core::Hashmap>(
             block_count_, core::Int32, core::UInt8, core::SizeVector{3},
             core::SizeVector{block_resolution_, block_resolution_,
@@ -122,6 +125,11 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &extrinsics,
                               float depth_scale,
                               float depth_max) {
+    OPEN3D_TRACE_SCOPE_DETAILED(
+            "pipelines", "TSDFIntegrate", device_.ToString(),
+            depth.GetRows() * depth.GetCols() * depth.GetDtype().ByteSize(),
+            depth.GetRows() * depth.GetCols());
+    core::ScopedMemoryTag memory_tag("TSDF/Integrate");
     if (depth.IsEmpty()) {
         utility::LogError(
                 "[TSDFVoxelGrid] input depth is empty for integration.");
@@ -216,6 +224,9 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
                        float depth_max,
                        float weight_threshold,
                        int ray_cast_mask) {
+    OPEN3D_TRACE_SCOPE_DETAILED("pipelines", "TSDFRayCast", device_.ToString(),
+                                -1, int64_t(width) * height);
+    core::ScopedMemoryTag memory_tag("TSDF/RayCast");
     // Extrinsic: world to camera -> pose: camera to world
     core::Tensor vertex_map, depth_map, color_map, normal_map;
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::VertexMap) {
@@ -267,6 +278,7 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
                                                float weight_threshold,
                                                int surface_mask) {
+    core::ScopedMemoryTag memory_tag("TSDF/ExtractSurfacePoints");
     // Extract active voxel blocks from the hashmap.
     if ((surface_mask & SurfaceMaskCode::VertexMap) == 0) {
         utility::LogError("VertexMap must be specified in Surface extraction.");
@@ -311,6 +323,7 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
 TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(int estimate_vertices,
                                                float weight_threshold,
                                                int surface_mask) {
+    core::ScopedMemoryTag memory_tag("TSDF/ExtractSurfaceMesh");
     // Extract active voxel blocks from the hashmap.
     if ((surface_mask & SurfaceMaskCode::VertexMap) == 0) {
         utility::LogError("VertexMap must be specified in Surface extraction.");
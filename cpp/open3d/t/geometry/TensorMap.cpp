@@ -28,6 +28,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -72,6 +73,129 @@ void TensorMap::AssertSizeSynchronized() const {
     }
 }
 
+void TensorMap::Reserve(int64_t capacity) {
+    for (auto& kv : *this) {
+        if (GetCapacity(kv.first) < capacity) {
+            Reallocate(kv.first, capacity);
+        }
+    }
+}
+
+int64_t TensorMap::GetCapacity(const std::string& key) const {
+    core::Tensor buffer = GetReservedBuffer(key);
+    return buffer.GetBlob() == nullptr ? at(key).GetLength()
+                                       : buffer.GetLength();
+}
+
+void TensorMap::Extend(const TensorMap& other) {
+    if (this->empty()) {
+        for (const auto& kv : other) {
+            (*this)[kv.first] = kv.second;
+        }
+        reserved_buffers_ = other.reserved_buffers_;
+        return;
+    }
+
+    // Check all tensors first, so that a failure leaves the map unchanged.
+    AssertExtendable(other);
+
+    for (auto& kv : *this) {
+        const core::Tensor& other_tensor = other.at(kv.first);
+        const int64_t length = kv.second.GetLength();
+        const int64_t new_length = length + other_tensor.GetLength();
+
+        // A buffer shared with another tensor may be a view that covers the
+        // elements to be written, so it must be copied first.
+        const bool exclusive = IsReservedBufferExclusive(kv.first);
+        core::Tensor buffer = GetReservedBuffer(kv.first);
+        if (!exclusive || buffer.GetLength() < new_length) {
+            const int64_t capacity =
+                    exclusive ? buffer.GetLength() : kv.second.GetLength();
+            Reallocate(kv.first, std::max(new_length, 2 * capacity));
+            buffer = reserved_buffers_.at(kv.first);
+        }
+        if (other_tensor.GetLength() > 0) {
+            buffer.Slice(0, length, new_length) = other_tensor;
+        }
+        kv.second = buffer.Slice(0, 0, new_length);
+    }
+}
+
+void TensorMap::AssertExtendable(const TensorMap& other) const {
+    for (const auto& kv : *this) {
+        if (!other.Contains(kv.first)) {
+            utility::LogError(
+                    "Cannot extend TensorMap: key \"{}\" is missing in the "
+                    "appended TensorMap.",
+                    kv.first);
+        }
+        const core::Tensor& tensor = kv.second;
+        const core::Tensor& other_tensor = other.at(kv.first);
+        other_tensor.AssertDtype(tensor.GetDtype());
+        other_tensor.AssertDevice(tensor.GetDevice());
+        const core::SizeVector shape = tensor.GetShape();
+        const core::SizeVector other_shape = other_tensor.GetShape();
+        if (shape.size() == 0 || shape.size() != other_shape.size() ||
+            !std::equal(shape.begin() + 1, shape.end(),
+                        other_shape.begin() + 1)) {
+            utility::LogError(
+                    "Cannot extend TensorMap: key \"{}\" has shape {}, which "
+                    "is not compatible with {}.",
+                    kv.first, other_shape, shape);
+        }
+    }
+}
+
+void TensorMap::Clear() {
+    clear();
+    reserved_buffers_.clear();
+}
+
+core::Tensor TensorMap::GetReservedBuffer(const std::string& key) const {
+    auto it = reserved_buffers_.find(key);
+    if (it == reserved_buffers_.end()) {
+        return core::Tensor();
+    }
+    const core::Tensor& buffer = it->second;
+    const core::Tensor& tensor = at(key);
+    const core::SizeVector shape = tensor.GetShape();
+    const core::SizeVector buffer_shape = buffer.GetShape();
+    if (tensor.GetBlob() != buffer.GetBlob() ||
+        tensor.GetDataPtr() != buffer.GetDataPtr() ||
+        !tensor.IsContiguous() || tensor.GetDtype() != buffer.GetDtype() ||
+        shape.size() != buffer_shape.size() ||
+        !std::equal(shape.begin() + 1, shape.end(), buffer_shape.begin() + 1) ||
+        shape[0] > buffer_shape[0]) {
+        return core::Tensor();
+    }
+    return buffer;
+}
+
+bool TensorMap::IsReservedBufferExclusive(const std::string& key) const {
+    if (GetReservedBuffer(key).GetBlob() == nullptr) {
+        return false;
+    }
+    // The blob is held by the tensor of key, by its reserved buffer and by the
+    // local pointer below. Any further holder is a tensor outside this map.
+    static constexpr long kExclusiveUseCount = 3;
+    const std::shared_ptr<core::Blob> blob =
+            reserved_buffers_.at(key).GetBlob();
+    return blob.use_count() == kExclusiveUseCount;
+}
+
+void TensorMap::Reallocate(const std::string& key, int64_t capacity) {
+    core::Tensor& tensor = at(key);
+    core::SizeVector shape = tensor.GetShape();
+    const int64_t length = shape[0];
+    shape[0] = capacity;
+    core::Tensor buffer(shape, tensor.GetDtype(), tensor.GetDevice());
+    if (length > 0) {
+        buffer.Slice(0, 0, length) = tensor;
+    }
+    tensor = buffer.Slice(0, 0, length);
+    reserved_buffers_[key] = buffer;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
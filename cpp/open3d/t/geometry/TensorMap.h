@@ -46,6 +46,12 @@ namespace geometry {
 ///
 /// Typically, tensors in the TensorMap should have the same length (the first
 /// dimension of shape) and device as the primary tensor.
+///
+/// Like TensorList, a TensorMap can reserve capacity along the first dimension
+/// with Reserve() and grow in amortized constant time with Extend(). The
+/// tensors in the map are then views into larger reserved buffers. Copies of a
+/// TensorMap share tensors and buffers; Extend() only writes into a buffer that
+/// is not shared, and reallocates it otherwise (copy-on-write).
 class TensorMap : public std::unordered_map<std::string, core::Tensor> {
 public:
     /// Create empty TensorMap and set primary key.
@@ -81,14 +87,16 @@ public:
     /// Copy constructor performs a "shallow" copy of the Tensors.
     TensorMap(const TensorMap& other)
         : std::unordered_map<std::string, core::Tensor>(other),
-          primary_key_(other.primary_key_) {
+          primary_key_(other.primary_key_),
+          reserved_buffers_(other.reserved_buffers_) {
         AssertPrimaryKeyInMapOrEmpty();
     }
 
     /// Move constructor performs a "shallow" copy of the Tensors.
     TensorMap(TensorMap&& other)
         : std::unordered_map<std::string, core::Tensor>(other),
-          primary_key_(other.primary_key_) {
+          primary_key_(other.primary_key_),
+          reserved_buffers_(other.reserved_buffers_) {
         AssertPrimaryKeyInMapOrEmpty();
     }
 
@@ -104,6 +112,7 @@ public:
         } else if (!Contains(key)) {
             utility::LogWarning("Key: {} is not present.", key);
         }
+        reserved_buffers_.erase(key);
         return this->erase(key);
     }
 
@@ -124,7 +133,42 @@ public:
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
 
+    /// Reserves memory for \p capacity elements along the first dimension of
+    /// every tensor. Values and lengths of the tensors are unchanged.
+    void Reserve(int64_t capacity);
+
+    /// Returns the number of elements the tensor of \p key can hold without
+    /// reallocation.
+    int64_t GetCapacity(const std::string& key) const;
+
+    /// Appends the tensors of \p other to the tensors with the same keys in
+    /// place. The reserved memory grows geometrically, so repeated calls
+    /// copy every element an amortized constant number of times.
+    ///
+    /// \p other must contain all keys of this map, with the same dtype,
+    /// device and element shape. Additional keys of \p other are ignored. If
+    /// this map is empty, it becomes a shallow copy of \p other.
+    void Extend(const TensorMap& other);
+
+    /// Asserts that Extend(\p other) would succeed.
+    void AssertExtendable(const TensorMap& other) const;
+
+    /// Removes all tensors and reserved memory. The primary key is kept.
+    void Clear();
+
 private:
+    /// Returns the reserved buffer of \p key, or an empty Tensor if there is
+    /// none or the tensor of \p key is no longer a view of it.
+    core::Tensor GetReservedBuffer(const std::string& key) const;
+
+    /// Returns true if the reserved buffer of \p key is referenced only by this
+    /// map, so that elements past the end of the tensor of \p key can be
+    /// written without affecting any other tensor.
+    bool IsReservedBufferExclusive(const std::string& key) const;
+
+    /// Moves the tensor of \p key to a new buffer of \p capacity elements.
+    void Reallocate(const std::string& key, int64_t capacity);
+
     /// Asserts that the map indeed contains the primary_key. This is typically
     /// called in constructors.
     void AssertPrimaryKeyInMapOrEmpty() const;
@@ -139,6 +183,10 @@ private:
 
     /// Primary key of the TensorMap.
     std::string primary_key_;
+
+    /// Buffers backing the tensors after Reserve() or Extend(). The tensor of
+    /// a key is a view of the first GetLength() elements of its buffer.
+    std::unordered_map<std::string, core::Tensor> reserved_buffers_;
 };
 
 }  // namespace geometry
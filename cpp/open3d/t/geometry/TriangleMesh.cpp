@@ -182,6 +182,30 @@ open3d::geometry::TriangleMesh TriangleMesh::ToLegacyTriangleMesh() const {
     return mesh_legacy;
 }
 
+TriangleMesh &TriangleMesh::Extend(const TriangleMesh &other) {
+    if (other.HasVertices()) {
+        other.GetVertices().AssertDevice(GetDevice());
+    }
+    const int64_t num_vertices = HasVertices() ? GetVertices().GetLength() : 0;
+    TensorMap other_triangle_attr = other.triangle_attr_;
+    if (num_vertices > 0 && other.HasTriangles()) {
+        other_triangle_attr["triangles"] = other.GetTriangles() + num_vertices;
+    }
+    vertex_attr_.AssertExtendable(other.vertex_attr_);
+    triangle_attr_.AssertExtendable(other_triangle_attr);
+
+    vertex_attr_.Extend(other.vertex_attr_);
+    triangle_attr_.Extend(other_triangle_attr);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Reserve(int64_t num_vertices,
+                                    int64_t num_triangles) {
+    vertex_attr_.Reserve(num_vertices);
+    triangle_attr_.Reserve(num_triangles);
+    return *this;
+}
+
 TriangleMesh TriangleMesh::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
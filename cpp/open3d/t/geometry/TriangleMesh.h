@@ -135,7 +135,7 @@ public:
     TriangleMesh To(const core::Device &device, bool copy = false) const;
 
     /// Returns copy of the triangle mesh on the same device.
-    TriangleMesh Clone() const { return To(GetDevice()); }
+    TriangleMesh Clone() const { return To(GetDevice(), /*copy=*/true); }
 
     /// Transfer the triangle mesh to CPU.
     ///
@@ -382,11 +382,27 @@ public:
 public:
     /// Clear all data in the trianglemesh.
     TriangleMesh &Clear() override {
-        vertex_attr_.clear();
-        triangle_attr_.clear();
+        vertex_attr_.Clear();
+        triangle_attr_.Clear();
         return *this;
     }
 
+    /// Appends a triangle mesh in place. The triangle indices of \p other
+    /// are offset by the current number of vertices.
+    ///
+    /// Memory is reserved with geometric growth, so that accumulating many
+    /// meshes copies each element an amortized constant number of times.
+    /// Attributes shared with other meshes, e.g. after a shallow copy, are
+    /// copied before they are modified. \p other must have all vertex and
+    /// triangle attributes of this mesh with the same dtype, device and
+    /// element shape. If this mesh is empty, it becomes a shallow copy of
+    /// \p other.
+    TriangleMesh &Extend(const TriangleMesh &other);
+
+    /// Reserves memory for \p num_vertices vertices and \p num_triangles
+    /// triangles in all vertex and triangle attributes.
+    TriangleMesh &Reserve(int64_t num_vertices, int64_t num_triangles);
+
     /// Returns !HasVertices(), triangles are ignored.
     bool IsEmpty() const override { return !HasVertices(); }
 
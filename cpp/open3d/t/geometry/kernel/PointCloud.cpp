@@ -102,6 +102,68 @@ void Project(
     }
 }
 
+void ComputeRANSACScores(const core::Tensor& points,
+                         const core::Tensor& models,
+                         RANSACModelType model_type,
+                         double distance_threshold,
+                         core::Tensor& inlier_counts,
+                         core::Tensor& squared_errors) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    models.AssertDtype(points.GetDtype());
+    models.AssertDevice(points.GetDevice());
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeRANSACScoresCPU(points.Contiguous(), models.Contiguous(),
+                               model_type, distance_threshold, inlier_counts,
+                               squared_errors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeRANSACScoresCUDA, points.Contiguous(),
+                  models.Contiguous(), model_type, distance_threshold,
+                  inlier_counts, squared_errors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeRANSACInliers(const core::Tensor& points,
+                          const core::Tensor& model,
+                          RANSACModelType model_type,
+                          double distance_threshold,
+                          core::Tensor& inlier_mask) {
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    model.AssertDtype(points.GetDtype());
+    model.AssertDevice(points.GetDevice());
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeRANSACInliersCPU(points.Contiguous(), model.Contiguous(),
+                                model_type, distance_threshold, inlier_mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeRANSACInliersCUDA, points.Contiguous(),
+                  model.Contiguous(), model_type, distance_threshold,
+                  inlier_mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ClusterDBSCAN(const core::Tensor& neighbor_indices,
+                   const core::Tensor& row_splits,
+                   size_t min_points,
+                   core::Tensor& labels) {
+    core::Device::DeviceType device_type =
+            neighbor_indices.GetDevice().GetType();
+    neighbor_indices.AssertDtype(core::Int64);
+    row_splits.AssertDtype(core::Int64);
+    row_splits.AssertDevice(neighbor_indices.GetDevice());
+    if (device_type == core::Device::DeviceType::CPU) {
+        ClusterDBSCANCPU(neighbor_indices.Contiguous(), row_splits.Contiguous(),
+                         min_points, labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClusterDBSCANCUDA, neighbor_indices.Contiguous(),
+                  row_splits.Contiguous(), min_points, labels);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
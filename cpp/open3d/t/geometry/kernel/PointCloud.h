@@ -36,6 +36,13 @@ namespace geometry {
 namespace kernel {
 namespace pointcloud {
 
+/// Geometric primitives supported by the RANSAC kernels. The model layouts
+/// are:
+/// - Plane: (a, b, c, d) of ax + by + cz + d = 0 with a unit normal.
+/// - Sphere: (cx, cy, cz, radius).
+/// - Cylinder: (a point on the axis, the unit axis direction, radius).
+enum class RANSACModelType { Plane, Sphere, Cylinder };
+
 void Unproject(const core::Tensor& depth,
                utility::optional<std::reference_wrapper<const core::Tensor>>
                        image_colors,
@@ -57,6 +64,37 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Scores a batch of {B, M} RANSAC models against {N, 3} points. For each
+/// model, \p inlier_counts (Int64, {B}) counts the points closer than
+/// \p distance_threshold and \p squared_errors (Float64, {B}) sums their
+/// squared distances.
+void ComputeRANSACScores(const core::Tensor& points,
+                         const core::Tensor& models,
+                         RANSACModelType model_type,
+                         double distance_threshold,
+                         core::Tensor& inlier_counts,
+                         core::Tensor& squared_errors);
+
+/// Computes the {N} boolean mask of the points closer than
+/// \p distance_threshold to a single {M} RANSAC model.
+void ComputeRANSACInliers(const core::Tensor& points,
+                          const core::Tensor& model,
+                          RANSACModelType model_type,
+                          double distance_threshold,
+                          core::Tensor& inlier_mask);
+
+/// Labels the DBSCAN clusters of a radius neighbor graph given as
+/// \p neighbor_indices (Int64) with CSR \p row_splits (Int64, {N + 1}). A point
+/// is a core point if it has at least \p min_points neighbors, itself
+/// included. Core points are joined with a lock-free union-find, so
+/// \p labels (Int32, {N}) holds the smallest core index of each cluster for
+/// its core points, the smallest such index among the core neighbors for
+/// border points, and -1 for noise.
+void ClusterDBSCAN(const core::Tensor& neighbor_indices,
+                   const core::Tensor& row_splits,
+                   size_t min_points,
+                   core::Tensor& labels);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -79,6 +117,24 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void ComputeRANSACScoresCPU(const core::Tensor& points,
+                            const core::Tensor& models,
+                            RANSACModelType model_type,
+                            double distance_threshold,
+                            core::Tensor& inlier_counts,
+                            core::Tensor& squared_errors);
+
+void ComputeRANSACInliersCPU(const core::Tensor& points,
+                             const core::Tensor& model,
+                             RANSACModelType model_type,
+                             double distance_threshold,
+                             core::Tensor& inlier_mask);
+
+void ClusterDBSCANCPU(const core::Tensor& neighbor_indices,
+                      const core::Tensor& row_splits,
+                      size_t min_points,
+                      core::Tensor& labels);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -101,6 +157,24 @@ void ProjectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max);
+
+void ComputeRANSACScoresCUDA(const core::Tensor& points,
+                             const core::Tensor& models,
+                             RANSACModelType model_type,
+                             double distance_threshold,
+                             core::Tensor& inlier_counts,
+                             core::Tensor& squared_errors);
+
+void ComputeRANSACInliersCUDA(const core::Tensor& points,
+                              const core::Tensor& model,
+                              RANSACModelType model_type,
+                              double distance_threshold,
+                              core::Tensor& inlier_mask);
+
+void ClusterDBSCANCUDA(const core::Tensor& neighbor_indices,
+                       const core::Tensor& row_splits,
+                       size_t min_points,
+                       core::Tensor& labels);
 #endif
 
 }  // namespace pointcloud
@@ -25,8 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <limits>
 #include <vector>
 
+#include "open3d/core/Atomic.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -135,7 +137,7 @@ void UnprojectCPU
 #endif
 
 #ifdef __CUDACC__
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
 #endif
     points = points.Slice(0, 0, total_pts_count);
     if (have_colors) {
@@ -144,6 +146,253 @@ void UnprojectCPU
     }
 }
 
+/// Signed distance of point \p p to a RANSAC model, see RANSACModelType.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t RANSACResidual(const scalar_t* p,
+                                                  const scalar_t* model,
+                                                  RANSACModelType model_type) {
+    if (model_type == RANSACModelType::Plane) {
+        return model[0] * p[0] + model[1] * p[1] + model[2] * p[2] + model[3];
+    }
+    const scalar_t dx = p[0] - model[0];
+    const scalar_t dy = p[1] - model[1];
+    const scalar_t dz = p[2] - model[2];
+    const scalar_t dist2 = dx * dx + dy * dy + dz * dz;
+    if (model_type == RANSACModelType::Sphere) {
+        return sqrt(dist2) - model[3];
+    }
+    // Cylinder: distance to the axis through model[0:3] along model[3:6].
+    const scalar_t along = dx * model[3] + dy * model[4] + dz * model[5];
+    const scalar_t radial2 = dist2 - along * along;
+    return sqrt(radial2 > 0 ? radial2 : 0) - model[6];
+}
+
+#if defined(__CUDACC__)
+void ComputeRANSACScoresCUDA
+#else
+void ComputeRANSACScoresCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& models,
+         RANSACModelType model_type,
+         double distance_threshold,
+         core::Tensor& inlier_counts,
+         core::Tensor& squared_errors) {
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    const int64_t num_models = models.GetLength();
+    const int64_t model_size = models.GetShape(1);
+
+    inlier_counts = core::Tensor::Zeros({num_models}, core::Int64, device);
+    squared_errors = core::Tensor::Zeros({num_models}, core::Float64, device);
+    int64_t* counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    double* errors_ptr = squared_errors.GetDataPtr<double>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+    // One workload scores one model on a block of points. Consecutive
+    // workloads share the block, so point reads are broadcast within a warp.
+    const int64_t block_size = 256;
+    const int64_t num_blocks = (num_points + block_size - 1) / block_size;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    // One workload scores one model on all points, without atomics.
+    const int64_t block_size = num_points;
+    const int64_t num_blocks = 1;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* models_ptr = models.GetDataPtr<scalar_t>();
+        const scalar_t threshold = static_cast<scalar_t>(distance_threshold);
+        launcher::ParallelFor(
+                num_blocks * num_models,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t model_idx = workload_idx % num_models;
+                    const int64_t begin =
+                            (workload_idx / num_models) * block_size;
+                    const int64_t end = begin + block_size < num_points
+                                                ? begin + block_size
+                                                : num_points;
+                    const scalar_t* model = models_ptr + model_idx * model_size;
+
+                    int64_t count = 0;
+                    double error = 0;
+                    for (int64_t i = begin; i < end; ++i) {
+                        const scalar_t r = RANSACResidual(points_ptr + 3 * i,
+                                                          model, model_type);
+                        if (r < threshold && r > -threshold) {
+                            ++count;
+                            error += r * r;
+                        }
+                    }
+#if defined(__CUDACC__)
+                    atomicAdd(reinterpret_cast<unsigned long long*>(
+                                      counts_ptr + model_idx),
+                              static_cast<unsigned long long>(count));
+                    atomicAdd(errors_ptr + model_idx, error);
+#else
+                    counts_ptr[model_idx] = count;
+                    errors_ptr[model_idx] = error;
+#endif
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeRANSACInliersCUDA
+#else
+void ComputeRANSACInliersCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& model,
+         RANSACModelType model_type,
+         double distance_threshold,
+         core::Tensor& inlier_mask) {
+    const int64_t num_points = points.GetLength();
+    inlier_mask = core::Tensor::Empty({num_points}, core::Bool,
+                                      points.GetDevice());
+    bool* mask_ptr = inlier_mask.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* model_ptr = model.GetDataPtr<scalar_t>();
+        const scalar_t threshold = static_cast<scalar_t>(distance_threshold);
+        launcher::ParallelFor(num_points, [=] OPEN3D_DEVICE(
+                                                  int64_t workload_idx) {
+            const scalar_t r = RANSACResidual(points_ptr + 3 * workload_idx,
+                                              model_ptr, model_type);
+            mask_ptr[workload_idx] = r < threshold && r > -threshold;
+        });
+    });
+}
+
+/// Root of \p idx in the union-find forest \p parents. Parents are read
+/// through a volatile pointer since other threads may be linking roots.
+OPEN3D_HOST_DEVICE inline int32_t UnionFindRoot(
+        const volatile int32_t* parents, int32_t idx) {
+    int32_t next = parents[idx];
+    while (next != idx) {
+        idx = next;
+        next = parents[idx];
+    }
+    return idx;
+}
+
+/// Joins the trees of \p a and \p b. The larger root is always linked below
+/// the smaller one, so roots only decrease and each tree ends up rooted at its
+/// smallest index.
+OPEN3D_DEVICE inline void UnionFindJoin(int32_t* parents,
+                                        int32_t a,
+                                        int32_t b) {
+    while (true) {
+        a = UnionFindRoot(parents, a);
+        b = UnionFindRoot(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            const int32_t tmp = a;
+            a = b;
+            b = tmp;
+        }
+#if defined(__CUDACC__)
+        const int32_t old = atomicCAS(parents + a, a, b);
+#else
+        const int32_t old = core::AtomicCompareExchange(parents + a, a, b);
+#endif
+        if (old == a) {
+            return;
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void ClusterDBSCANCUDA
+#else
+void ClusterDBSCANCPU
+#endif
+        (const core::Tensor& neighbor_indices,
+         const core::Tensor& row_splits,
+         size_t min_points,
+         core::Tensor& labels) {
+    const core::Device device = neighbor_indices.GetDevice();
+    const int64_t num_points = row_splits.GetLength() - 1;
+    if (num_points > std::numeric_limits<int32_t>::max()) {
+        utility::LogError("Too many points for Int32 labels: {}.", num_points);
+    }
+
+    labels = core::Tensor::Empty({num_points}, core::Int32, device);
+    core::Tensor parents =
+            core::Tensor::Empty({num_points}, core::Int32, device);
+    int32_t* labels_ptr = labels.GetDataPtr<int32_t>();
+    int32_t* parents_ptr = parents.GetDataPtr<int32_t>();
+    const int64_t* indices_ptr = neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t* splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t min_neighbors = static_cast<int64_t>(min_points);
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        parents_ptr[workload_idx] = static_cast<int32_t>(workload_idx);
+    });
+
+    // Join core points with their core neighbors. The radius graph is
+    // symmetric, so each edge is only visited from its larger endpoint.
+    launcher::ParallelFor(num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int64_t begin = splits_ptr[workload_idx];
+        const int64_t end = splits_ptr[workload_idx + 1];
+        if (end - begin < min_neighbors) {
+            return;
+        }
+        for (int64_t k = begin; k < end; ++k) {
+            const int64_t nb = indices_ptr[k];
+            if (nb < workload_idx &&
+                splits_ptr[nb + 1] - splits_ptr[nb] >= min_neighbors) {
+                UnionFindJoin(parents_ptr, static_cast<int32_t>(workload_idx),
+                              static_cast<int32_t>(nb));
+            }
+        }
+    });
+
+    // Point every node directly to its root. Roots are final at this point,
+    // so concurrent path compression only shortcuts the trees.
+    launcher::ParallelFor(num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        parents_ptr[workload_idx] = UnionFindRoot(
+                parents_ptr, static_cast<int32_t>(workload_idx));
+    });
+
+    // Border points join the cluster with the smallest root among their core
+    // neighbors, which is the first cluster reaching them in index order.
+    launcher::ParallelFor(num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int64_t begin = splits_ptr[workload_idx];
+        const int64_t end = splits_ptr[workload_idx + 1];
+        if (end - begin >= min_neighbors) {
+            labels_ptr[workload_idx] = parents_ptr[workload_idx];
+            return;
+        }
+        int32_t label = -1;
+        for (int64_t k = begin; k < end; ++k) {
+            const int64_t nb = indices_ptr[k];
+            if (splits_ptr[nb + 1] - splits_ptr[nb] >= min_neighbors &&
+                (label < 0 || parents_ptr[nb] < label)) {
+                label = parents_ptr[nb];
+            }
+        }
+        labels_ptr[workload_idx] = label;
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
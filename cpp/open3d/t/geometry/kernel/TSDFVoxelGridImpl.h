@@ -165,7 +165,7 @@ void IntegrateCPU
                 });
             });
 #if defined(__CUDACC__)
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
 #endif
 }
 
@@ -471,7 +471,7 @@ void ExtractSurfacePointsCPU
     valid_size = total_count;
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
 #endif
 }
 
@@ -1073,7 +1073,7 @@ void EstimateRangeCPU
 #endif
             });
 #if defined(__CUDACC__)
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
 #endif
 }
 
@@ -1497,7 +1497,7 @@ void RayCastCPU
             });
 
 #if defined(__CUDACC__)
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
 #endif
 }
 
@@ -0,0 +1,851 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/GeometryArchiveIO.h"
+
+#include <json/json.h>
+#include <liblzf/lzf.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/IJsonConvertible.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+// An archive starts with a magic string, followed by the attribute data and a
+// JSON index. It ends with a footer holding the offset and size of the index
+// and the magic string again. The index lists, for every tensor map of the
+// geometry, the number of rows, the chunk size, the file location of the
+// chunk bounding boxes and, for every attribute, its dtype, element shape and
+// the file location of every chunk. A chunk is LZF compressed if its stored
+// size is smaller than its raw size.
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kArchiveMagic[8] = {'O', '3', 'D', 'G', 'E', 'O', 'A', 'R'};
+constexpr int kArchiveVersion = 1;
+// Attributes start at multiples of this size, so that uncompressed
+// attributes can be used in place.
+constexpr int64_t kArchiveAlignment = 64;
+// Number of chunks compressed in parallel before they are written.
+constexpr int64_t kArchiveWriteBatchSize = 256;
+// Bits per axis of the Morton codes used to order points.
+constexpr int kMortonBits = 21;
+constexpr double kMortonMax = (1 << kMortonBits) - 1;
+
+struct ArchiveFooter {
+    uint64_t index_offset;
+    uint64_t index_size;
+    char magic[8];
+};
+
+core::Dtype DtypeFromString(const std::string &name) {
+    for (const core::Dtype &dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32, core::UInt64,
+          core::Bool}) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    return core::Undefined;
+}
+
+/// Number of bytes of a row, i.e. of an element along the first dimension.
+int64_t GetRowSize(const core::SizeVector &shape, const core::Dtype &dtype) {
+    int64_t row_size = dtype.ByteSize();
+    for (size_t i = 1; i < shape.size(); i++) {
+        row_size *= shape[i];
+    }
+    return row_size;
+}
+
+/// Returns the rows \p indices of \p values.
+core::Tensor GatherRows(const core::Tensor &values,
+                        const std::vector<int64_t> &indices) {
+    const core::Tensor src = values.Contiguous();
+    const int64_t row_size = GetRowSize(src.GetShape(), src.GetDtype());
+    core::SizeVector shape = src.GetShape();
+    shape[0] = static_cast<int64_t>(indices.size());
+    core::Tensor dst(shape, src.GetDtype());
+    const char *src_ptr = static_cast<const char *>(src.GetDataPtr());
+    char *dst_ptr = static_cast<char *>(dst.GetDataPtr());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < shape[0]; i++) {
+        std::memcpy(dst_ptr + i * row_size, src_ptr + indices[i] * row_size,
+                    row_size);
+    }
+    return dst;
+}
+
+template <typename scalar_t>
+void ComputeChunkBounds(const scalar_t *points,
+                        int64_t num_points,
+                        int64_t chunk_size,
+                        double *bounds) {
+    const int64_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; c++) {
+        double *box = bounds + c * 6;
+        for (int d = 0; d < 3; d++) {
+            box[d] = std::numeric_limits<double>::infinity();
+            box[d + 3] = -std::numeric_limits<double>::infinity();
+        }
+        const int64_t end = std::min(num_points, (c + 1) * chunk_size);
+        for (int64_t i = c * chunk_size; i < end; i++) {
+            const scalar_t *p = points + i * 3;
+            if (!std::isfinite(p[0]) || !std::isfinite(p[1]) ||
+                !std::isfinite(p[2])) {
+                continue;
+            }
+            for (int d = 0; d < 3; d++) {
+                box[d] = std::min(box[d], static_cast<double>(p[d]));
+                box[d + 3] = std::max(box[d + 3], static_cast<double>(p[d]));
+            }
+        }
+    }
+}
+
+/// Returns the {num_chunks, 6} bounding boxes (minimum, then maximum) of the
+/// finite points of every chunk. Chunks without finite points get empty boxes.
+core::Tensor GetChunkBounds(const core::Tensor &points, int64_t chunk_size) {
+    const int64_t num_points = points.GetLength();
+    const int64_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+    core::Tensor bounds({num_chunks, 6}, core::Float64);
+    const core::Tensor points_contiguous = points.Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        ComputeChunkBounds(points_contiguous.GetDataPtr<scalar_t>(),
+                           num_points, chunk_size,
+                           bounds.GetDataPtr<double>());
+    });
+    return bounds;
+}
+
+/// Spreads the lower kMortonBits bits of \p v to every third bit.
+uint64_t SpreadBits(uint64_t v) {
+    v &= (uint64_t(1) << kMortonBits) - 1;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+}
+
+/// Computes the Morton code of every point, paired with the point index.
+template <typename scalar_t>
+void ComputeMortonCodes(const scalar_t *points,
+                        int64_t num_points,
+                        const double *offset,
+                        const double *scale,
+                        std::pair<uint64_t, int64_t> *keys) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        uint64_t code = 0;
+        for (int d = 0; d < 3; d++) {
+            const double q = std::min(
+                    (points[i * 3 + d] - offset[d]) * scale[d], kMortonMax);
+            // Also false for NaN.
+            const uint64_t bits = q > 0 ? static_cast<uint64_t>(q) : 0;
+            code |= SpreadBits(bits) << d;
+        }
+        keys[i] = {code, i};
+    }
+}
+
+/// Returns the order of \p points along a Morton curve through their bounding
+/// box. Points with non-finite coordinates are placed at the box minimum.
+std::vector<int64_t> GetMortonOrder(const core::Tensor &points) {
+    const int64_t num_points = points.GetLength();
+    const core::Tensor bounds = GetChunkBounds(points, num_points);
+    const double *box = bounds.GetDataPtr<double>();
+    double scale[3], offset[3];
+    for (int d = 0; d < 3; d++) {
+        const double length = box[d + 3] - box[d];
+        offset[d] = std::isfinite(box[d]) ? box[d] : 0;
+        scale[d] = length > 0 && std::isfinite(length) ? kMortonMax / length
+                                                       : 0;
+    }
+    std::vector<std::pair<uint64_t, int64_t>> keys(num_points);
+    const core::Tensor points_contiguous = points.Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        ComputeMortonCodes(points_contiguous.GetDataPtr<scalar_t>(),
+                           num_points, offset, scale, keys.data());
+    });
+    tbb::parallel_sort(keys.begin(), keys.end());
+    std::vector<int64_t> order(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        order[i] = keys[i].second;
+    }
+    return order;
+}
+
+/// Writes tensor maps to an archive file. The index is written by Close().
+class ArchiveWriter {
+public:
+    ArchiveWriter(const std::string &geometry,
+                  const GeometryArchiveOption &option)
+        : option_(option) {
+        index_["version"] = kArchiveVersion;
+        index_["geometry"] = geometry;
+        index_["maps"] = Json::Value(Json::arrayValue);
+    }
+
+    ~ArchiveWriter() {
+        if (file_) {
+            fclose(file_);
+        }
+    }
+
+    bool Open(const std::string &filename) {
+        file_ = utility::filesystem::FOpen(filename, "wb");
+        return file_ && WriteBytes(kArchiveMagic, sizeof(kArchiveMagic));
+    }
+
+    /// Writes all attributes of \p tensor_map, which must be on the CPU.
+    /// \p chunk_bounds are the optional bounding boxes of the chunks.
+    bool WriteTensorMap(const std::string &name,
+                        const geometry::TensorMap &tensor_map,
+                        const core::Tensor &chunk_bounds) {
+        const std::string primary_key = tensor_map.GetPrimaryKey();
+        int64_t num_rows = 0;
+        if (tensor_map.Contains(primary_key)) {
+            num_rows = tensor_map.at(primary_key).GetLength();
+        } else if (!tensor_map.empty()) {
+            num_rows = tensor_map.begin()->second.GetLength();
+        }
+        Json::Value map;
+        map["name"] = name;
+        map["primary_key"] = primary_key;
+        map["num_rows"] = Json::Int64(num_rows);
+        map["chunk_size"] = Json::Int64(option_.chunk_size);
+        map["attributes"] = Json::Value(Json::arrayValue);
+        if (chunk_bounds.NumElements() > 0) {
+            const size_t size = chunk_bounds.NumElements() * sizeof(double);
+            map["bounds_offset"] = Json::Int64(offset_);
+            if (!WriteBytes(chunk_bounds.GetDataPtr(), size)) {
+                return false;
+            }
+        }
+        // Sort attributes by name, so that archives are reproducible.
+        std::map<std::string, core::Tensor> sorted(tensor_map.begin(),
+                                                   tensor_map.end());
+        for (const auto &it : sorted) {
+            if (it.second.NumDims() == 0 ||
+                it.second.GetLength() != num_rows) {
+                utility::LogWarning(
+                        "Write archive failed: attribute {} of {} has "
+                        "length {}, expected {}.",
+                        it.first, name,
+                        it.second.NumDims() == 0 ? 0 : it.second.GetLength(),
+                        num_rows);
+                return false;
+            }
+            Json::Value attribute;
+            attribute["name"] = it.first;
+            attribute["dtype"] = it.second.GetDtype().ToString();
+            attribute["shape"] = Json::Value(Json::arrayValue);
+            for (int64_t i = 1; i < it.second.NumDims(); i++) {
+                attribute["shape"].append(Json::Int64(it.second.GetShape(i)));
+            }
+            if (!WriteAttribute(it.second, attribute["chunks"])) {
+                return false;
+            }
+            map["attributes"].append(attribute);
+        }
+        index_["maps"].append(map);
+        return true;
+    }
+
+    /// Writes the index and the footer.
+    bool Close() {
+        const std::string index = utility::JsonToString(index_);
+        ArchiveFooter footer;
+        footer.index_offset = offset_;
+        footer.index_size = index.size();
+        std::memcpy(footer.magic, kArchiveMagic, sizeof(kArchiveMagic));
+        const bool success = WriteBytes(index.data(), index.size()) &&
+                             WriteBytes(&footer, sizeof(footer)) &&
+                             fclose(file_) == 0;
+        file_ = nullptr;
+        return success;
+    }
+
+private:
+    bool WriteBytes(const void *data, size_t size) {
+        if (size > 0 && fwrite(data, 1, size, file_) != size) {
+            return false;
+        }
+        offset_ += size;
+        return true;
+    }
+
+    bool WriteAttribute(const core::Tensor &tensor, Json::Value &chunks) {
+        const core::Tensor values = tensor.Contiguous();
+        const char *data = static_cast<const char *>(values.GetDataPtr());
+        const int64_t num_rows = values.GetLength();
+        const int64_t row_size = GetRowSize(values.GetShape(),
+                                            values.GetDtype());
+        const int64_t chunk_size = option_.chunk_size;
+        const int64_t num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+        // LZF handles at most 4GB at once.
+        const bool compressed =
+                option_.compressed &&
+                chunk_size * row_size <
+                        std::numeric_limits<unsigned int>::max();
+        chunks = Json::Value(Json::arrayValue);
+        const std::vector<char> padding(
+                (kArchiveAlignment - offset_ % kArchiveAlignment) %
+                        kArchiveAlignment,
+                0);
+        if (!WriteBytes(padding.data(), padding.size())) {
+            return false;
+        }
+        for (int64_t begin = 0; begin < num_chunks;
+             begin += kArchiveWriteBatchSize) {
+            const int64_t end =
+                    std::min(begin + kArchiveWriteBatchSize, num_chunks);
+            // Empty buffers mean that a chunk is stored uncompressed.
+            std::vector<std::vector<char>> buffers(end - begin);
+            if (compressed) {
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+                for (int64_t c = begin; c < end; c++) {
+                    const int64_t raw_size =
+                            (std::min(num_rows, (c + 1) * chunk_size) -
+                             c * chunk_size) *
+                            row_size;
+                    std::vector<char> &buffer = buffers[c - begin];
+                    buffer.resize(raw_size);
+                    // Only keep chunks that get smaller.
+                    const unsigned int size = lzf_compress(
+                            data + c * chunk_size * row_size,
+                            static_cast<unsigned int>(raw_size), buffer.data(),
+                            static_cast<unsigned int>(raw_size - 1));
+                    buffer.resize(raw_size > 1 ? size : 0);
+                }
+            }
+            for (int64_t c = begin; c < end; c++) {
+                const std::vector<char> &buffer = buffers[c - begin];
+                const int64_t raw_size =
+                        (std::min(num_rows, (c + 1) * chunk_size) -
+                         c * chunk_size) *
+                        row_size;
+                Json::Value chunk(Json::arrayValue);
+                chunk.append(Json::Int64(offset_));
+                bool success;
+                if (buffer.empty()) {
+                    chunk.append(Json::Int64(raw_size));
+                    success = WriteBytes(data + c * chunk_size * row_size,
+                                         raw_size);
+                } else {
+                    chunk.append(Json::Int64(buffer.size()));
+                    success = WriteBytes(buffer.data(), buffer.size());
+                }
+                if (!success) {
+                    return false;
+                }
+                chunks.append(chunk);
+            }
+        }
+        return true;
+    }
+
+    GeometryArchiveOption option_;
+    FILE *file_ = nullptr;
+    int64_t offset_ = 0;
+    Json::Value index_;
+};
+
+/// Reads tensor maps from a memory-mapped archive file.
+class ArchiveReader {
+public:
+    bool Open(const std::string &filename) {
+        // Tensors are read on demand as views of the mapping.
+        file_ = std::make_shared<utility::filesystem::MappedFile>();
+        if (!file_->Open(filename, true,
+                         utility::filesystem::MappedFile::AccessPattern::
+                                 Normal)) {
+            return false;
+        }
+        blob_ = core::Tensor::FromMappedFile(
+                        file_, 0, {static_cast<int64_t>(file_->GetSize())},
+                        core::UInt8)
+                        .GetBlob();
+        const size_t size = file_->GetSize();
+        ArchiveFooter footer;
+        if (size < sizeof(kArchiveMagic) + sizeof(footer)) {
+            return false;
+        }
+        std::memcpy(&footer, file_->GetData() + size - sizeof(footer),
+                    sizeof(footer));
+        if (std::memcmp(file_->GetData(), kArchiveMagic,
+                        sizeof(kArchiveMagic)) != 0 ||
+            std::memcmp(footer.magic, kArchiveMagic, sizeof(kArchiveMagic)) !=
+                    0 ||
+            footer.index_offset > size - sizeof(footer) ||
+            footer.index_size > size - sizeof(footer) - footer.index_offset) {
+            return false;
+        }
+        index_ = utility::StringToJson(
+                std::string(file_->GetData() + footer.index_offset,
+                            footer.index_size));
+        return index_["version"].asInt() == kArchiveVersion;
+    }
+
+    std::string GetGeometry() const { return index_["geometry"].asString(); }
+
+    /// Returns the index entry of the tensor map \p name, or null.
+    const Json::Value *GetMap(const std::string &name) const {
+        for (const Json::Value &map : index_["maps"]) {
+            if (map["name"].asString() == name) {
+                return &map;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Returns the ids of the chunks of \p map whose bounding boxes intersect
+    /// the box [\p min_bound, \p max_bound].
+    bool GetChunksInBox(const Json::Value &map,
+                        const double *min_bound,
+                        const double *max_bound,
+                        std::vector<int64_t> &chunk_ids) const {
+        if (!map.isMember("bounds_offset")) {
+            return false;
+        }
+        const int64_t num_chunks = GetNumChunks(map);
+        const int64_t offset = map["bounds_offset"].asInt64();
+        if (!InFile(offset, num_chunks * 6 * sizeof(double))) {
+            return false;
+        }
+        std::vector<double> bounds(num_chunks * 6);
+        std::memcpy(bounds.data(), file_->GetData() + offset,
+                    bounds.size() * sizeof(double));
+        chunk_ids.clear();
+        for (int64_t c = 0; c < num_chunks; c++) {
+            const double *box = bounds.data() + c * 6;
+            bool intersects = true;
+            for (int d = 0; d < 3; d++) {
+                intersects = intersects && box[d] <= max_bound[d] &&
+                             box[d + 3] >= min_bound[d];
+            }
+            if (intersects) {
+                chunk_ids.push_back(c);
+            }
+        }
+        return true;
+    }
+
+    /// Reads the chunks \p chunk_ids, or all chunks if null, of every
+    /// attribute of \p map.
+    bool ReadTensorMap(const Json::Value &map,
+                       const std::vector<int64_t> *chunk_ids,
+                       geometry::TensorMap &tensor_map) const {
+        tensor_map = geometry::TensorMap(map["primary_key"].asString());
+        const int64_t num_rows = map["num_rows"].asInt64();
+        const int64_t chunk_size = map["chunk_size"].asInt64();
+        if (num_rows < 0 || chunk_size <= 0) {
+            return false;
+        }
+        const int64_t num_chunks = GetNumChunks(map);
+        std::vector<int64_t> all_chunk_ids;
+        if (!chunk_ids) {
+            for (int64_t c = 0; c < num_chunks; c++) {
+                all_chunk_ids.push_back(c);
+            }
+            chunk_ids = &all_chunk_ids;
+        }
+        // First output row of every selected chunk.
+        std::vector<int64_t> out_rows(chunk_ids->size() + 1, 0);
+        for (size_t i = 0; i < chunk_ids->size(); i++) {
+            const int64_t c = (*chunk_ids)[i];
+            out_rows[i + 1] = out_rows[i] +
+                              std::min(num_rows, (c + 1) * chunk_size) -
+                              c * chunk_size;
+        }
+        for (const Json::Value &attribute : map["attributes"]) {
+            const core::Dtype dtype =
+                    DtypeFromString(attribute["dtype"].asString());
+            const Json::Value &chunks = attribute["chunks"];
+            if (dtype == core::Undefined ||
+                static_cast<int64_t>(chunks.size()) != num_chunks) {
+                return false;
+            }
+            core::SizeVector shape{out_rows.back()};
+            for (const Json::Value &dim : attribute["shape"]) {
+                if (dim.asInt64() < 0) {
+                    return false;
+                }
+                shape.push_back(dim.asInt64());
+            }
+            core::Tensor values;
+            if (!ReadAttribute(chunks, *chunk_ids, out_rows, num_rows, shape,
+                               dtype, values)) {
+                return false;
+            }
+            tensor_map[attribute["name"].asString()] = values;
+        }
+        return true;
+    }
+
+private:
+    static int64_t GetNumChunks(const Json::Value &map) {
+        const int64_t chunk_size = std::max<int64_t>(
+                1, map["chunk_size"].asInt64());
+        return (map["num_rows"].asInt64() + chunk_size - 1) / chunk_size;
+    }
+
+    bool InFile(int64_t offset, int64_t size) const {
+        const int64_t file_size = static_cast<int64_t>(file_->GetSize());
+        return offset >= 0 && size >= 0 && offset <= file_size &&
+               size <= file_size - offset;
+    }
+
+    bool ReadAttribute(const Json::Value &chunks,
+                       const std::vector<int64_t> &chunk_ids,
+                       const std::vector<int64_t> &out_rows,
+                       int64_t num_rows,
+                       const core::SizeVector &shape,
+                       const core::Dtype &dtype,
+                       core::Tensor &values) const {
+        const int64_t row_size = GetRowSize(shape, dtype);
+        const int64_t num_selected = static_cast<int64_t>(chunk_ids.size());
+        std::vector<int64_t> offsets(num_selected), sizes(num_selected);
+        bool is_contiguous = true;
+        for (int64_t i = 0; i < num_selected; i++) {
+            const int64_t c = chunk_ids[i];
+            const Json::Value &chunk = chunks[Json::ArrayIndex(c)];
+            offsets[i] = chunk[0].asInt64();
+            sizes[i] = chunk[1].asInt64();
+            const int64_t raw_size = (out_rows[i + 1] - out_rows[i]) * row_size;
+            if (!InFile(offsets[i], sizes[i]) || sizes[i] > raw_size) {
+                return false;
+            }
+            is_contiguous = is_contiguous && sizes[i] == raw_size &&
+                            offsets[i] == offsets[0] + out_rows[i] * row_size;
+        }
+        const char *data = file_->GetData();
+        // Uncompressed attributes read as a whole are used in place.
+        if (num_selected > 0 && out_rows.back() == num_rows && is_contiguous &&
+            offsets[0] % dtype.ByteSize() == 0) {
+            values = core::Tensor(shape,
+                                  core::shape_util::DefaultStrides(shape),
+                                  const_cast<char *>(data + offsets[0]),
+                                  dtype, blob_);
+            return true;
+        }
+        values = core::Tensor(shape, dtype);
+        char *dst = static_cast<char *>(values.GetDataPtr());
+        std::atomic<bool> success(true);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_selected; i++) {
+            const int64_t raw_size = (out_rows[i + 1] - out_rows[i]) * row_size;
+            char *chunk_dst = dst + out_rows[i] * row_size;
+            if (sizes[i] == raw_size) {
+                std::memcpy(chunk_dst, data + offsets[i], raw_size);
+            } else if (lzf_decompress(data + offsets[i],
+                                      static_cast<unsigned int>(sizes[i]),
+                                      chunk_dst,
+                                      static_cast<unsigned int>(raw_size)) !=
+                       raw_size) {
+                success = false;
+            }
+        }
+        return success;
+    }
+
+    std::shared_ptr<utility::filesystem::MappedFile> file_;
+    std::shared_ptr<core::Blob> blob_;
+    Json::Value index_;
+};
+
+template <typename scalar_t>
+void ComputeInsideBox(const scalar_t *points,
+                      int64_t num_points,
+                      const double *min_bound,
+                      const double *max_bound,
+                      uint8_t *inside) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        bool is_inside = true;
+        for (int d = 0; d < 3; d++) {
+            is_inside = is_inside && points[i * 3 + d] >= min_bound[d] &&
+                        points[i * 3 + d] <= max_bound[d];
+        }
+        inside[i] = is_inside;
+    }
+}
+
+/// Returns a copy of \p tensor_map with all attributes on the CPU.
+geometry::TensorMap ToCPU(const geometry::TensorMap &tensor_map) {
+    geometry::TensorMap cpu_tensor_map(tensor_map.GetPrimaryKey());
+    for (const auto &it : tensor_map) {
+        cpu_tensor_map[it.first] = it.second.To(core::Device("CPU:0"));
+    }
+    return cpu_tensor_map;
+}
+
+}  // namespace
+
+bool WritePointCloudToArchive(const std::string &filename,
+                              const geometry::PointCloud &pointcloud,
+                              const GeometryArchiveOption &option) {
+    if (option.chunk_size <= 0) {
+        utility::LogWarning("Write archive failed: chunk_size must be > 0.");
+        return false;
+    }
+    try {
+        geometry::TensorMap point_attr = ToCPU(pointcloud.GetPointAttr());
+        core::Tensor chunk_bounds;
+        if (pointcloud.HasPoints()) {
+            const core::Tensor &points = point_attr.at("points");
+            const core::Dtype dtype = points.GetDtype();
+            if (points.NumDims() == 2 && points.GetShape(1) == 3 &&
+                (dtype == core::Float32 || dtype == core::Float64)) {
+                if (option.spatial_chunks && points.GetLength() > 0) {
+                    const std::vector<int64_t> order = GetMortonOrder(points);
+                    for (auto &it : point_attr) {
+                        if (it.second.NumDims() > 0 &&
+                            it.second.GetLength() == points.GetLength()) {
+                            it.second = GatherRows(it.second, order);
+                        }
+                    }
+                }
+                chunk_bounds = GetChunkBounds(point_attr.at("points"),
+                                              option.chunk_size);
+            }
+        }
+
+        ArchiveWriter writer("PointCloud", option);
+        if (!writer.Open(filename)) {
+            utility::LogWarning("Write archive failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!writer.WriteTensorMap("point", point_attr, chunk_bounds) ||
+            !writer.Close()) {
+            utility::LogWarning("Write archive failed: unable to write {}.",
+                                filename);
+            return false;
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write archive failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+static bool ReadPointCloudFromArchive(const std::string &filename,
+                                      geometry::PointCloud &pointcloud,
+                                      const double *min_bound,
+                                      const double *max_bound) {
+    try {
+        pointcloud = geometry::PointCloud(core::Device("CPU:0"));
+        ArchiveReader reader;
+        if (!reader.Open(filename)) {
+            utility::LogWarning("Read archive failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const Json::Value *map = reader.GetMap("point");
+        if (reader.GetGeometry() != "PointCloud" || !map) {
+            utility::LogWarning("Read archive failed: {} is not a point cloud.",
+                                filename);
+            return false;
+        }
+        std::vector<int64_t> chunk_ids;
+        if (min_bound &&
+            !reader.GetChunksInBox(*map, min_bound, max_bound, chunk_ids)) {
+            utility::LogWarning(
+                    "Read archive failed: {} has no chunk bounding boxes.",
+                    filename);
+            return false;
+        }
+        geometry::TensorMap point_attr("points");
+        if (!reader.ReadTensorMap(*map, min_bound ? &chunk_ids : nullptr,
+                                  point_attr)) {
+            utility::LogWarning("Read archive failed: unable to read {}.",
+                                filename);
+            return false;
+        }
+
+        // Chunks may extend beyond the box.
+        if (min_bound && point_attr.Contains("points")) {
+            const core::Tensor &points = point_attr.at("points");
+            const int64_t num_points = points.GetLength();
+            std::vector<uint8_t> inside(num_points);
+            DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+                ComputeInsideBox(points.GetDataPtr<scalar_t>(), num_points,
+                                 min_bound, max_bound, inside.data());
+            });
+            std::vector<int64_t> indices;
+            for (int64_t i = 0; i < num_points; i++) {
+                if (inside[i]) {
+                    indices.push_back(i);
+                }
+            }
+            if (static_cast<int64_t>(indices.size()) != num_points) {
+                for (auto &it : point_attr) {
+                    it.second = GatherRows(it.second, indices);
+                }
+            }
+        }
+        for (const auto &it : point_attr) {
+            pointcloud.SetPointAttr(it.first, it.second);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read archive failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+bool ReadPointCloudFromArchive(const std::string &filename,
+                               geometry::PointCloud &pointcloud) {
+    return ReadPointCloudFromArchive(filename, pointcloud, nullptr, nullptr);
+}
+
+bool ReadPointCloudFromArchive(const std::string &filename,
+                               geometry::PointCloud &pointcloud,
+                               const core::Tensor &min_bound,
+                               const core::Tensor &max_bound) {
+    min_bound.AssertShape({3});
+    max_bound.AssertShape({3});
+    const core::Tensor min_bound_cpu =
+            min_bound.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const core::Tensor max_bound_cpu =
+            max_bound.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    return ReadPointCloudFromArchive(filename, pointcloud,
+                                     min_bound_cpu.GetDataPtr<double>(),
+                                     max_bound_cpu.GetDataPtr<double>());
+}
+
+bool WriteTriangleMeshToArchive(const std::string &filename,
+                                const geometry::TriangleMesh &mesh,
+                                const GeometryArchiveOption &option) {
+    if (option.chunk_size <= 0) {
+        utility::LogWarning("Write archive failed: chunk_size must be > 0.");
+        return false;
+    }
+    try {
+        const geometry::TensorMap vertex_attr = ToCPU(mesh.GetVertexAttr());
+        const geometry::TensorMap triangle_attr =
+                ToCPU(mesh.GetTriangleAttr());
+
+        ArchiveWriter writer("TriangleMesh", option);
+        if (!writer.Open(filename)) {
+            utility::LogWarning("Write archive failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!writer.WriteTensorMap("vertex", vertex_attr, core::Tensor()) ||
+            !writer.WriteTensorMap("triangle", triangle_attr,
+                                   core::Tensor()) ||
+            !writer.Close()) {
+            utility::LogWarning("Write archive failed: unable to write {}.",
+                                filename);
+            return false;
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write archive failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+bool ReadTriangleMeshFromArchive(const std::string &filename,
+                                 geometry::TriangleMesh &mesh) {
+    try {
+        mesh = geometry::TriangleMesh(core::Device("CPU:0"));
+        ArchiveReader reader;
+        if (!reader.Open(filename)) {
+            utility::LogWarning("Read archive failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const Json::Value *vertex_map = reader.GetMap("vertex");
+        const Json::Value *triangle_map = reader.GetMap("triangle");
+        if (reader.GetGeometry() != "TriangleMesh" || !vertex_map ||
+            !triangle_map) {
+            utility::LogWarning(
+                    "Read archive failed: {} is not a triangle mesh.",
+                    filename);
+            return false;
+        }
+        geometry::TensorMap vertex_attr("vertices");
+        geometry::TensorMap triangle_attr("triangles");
+        if (!reader.ReadTensorMap(*vertex_map, nullptr, vertex_attr) ||
+            !reader.ReadTensorMap(*triangle_map, nullptr, triangle_attr)) {
+            utility::LogWarning("Read archive failed: unable to read {}.",
+                                filename);
+            return false;
+        }
+        for (const auto &it : vertex_attr) {
+            mesh.SetVertexAttr(it.first, it.second);
+        }
+        for (const auto &it : triangle_attr) {
+            mesh.SetTriangleAttr(it.first, it.second);
+        }
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read archive failed with exception: {}",
+                            e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Options for writing a geometry archive.
+///
+/// A geometry archive stores every attribute of a tensor geometry with its
+/// dtype and shape. Attributes are split into chunks of rows that are
+/// compressed and decompressed in parallel, and that can be read on their own.
+struct GeometryArchiveOption {
+    /// Number of rows per chunk.
+    int64_t chunk_size = 65536;
+    /// Compress the chunks with LZF. Chunks that do not get smaller are stored
+    /// uncompressed.
+    bool compressed = true;
+    /// Sort points along a Morton curve before splitting them into chunks, so
+    /// that every chunk covers a small region. This changes the order of the
+    /// points. Only used for point clouds.
+    bool spatial_chunks = true;
+};
+
+/// \brief Writes all point attributes of \p pointcloud to a geometry archive.
+///
+/// The bounding box of the points of every chunk is stored, so that
+/// sub-regions can be read with ReadPointCloudFromArchive.
+/// \return true if the archive was written successfully.
+bool WritePointCloudToArchive(const std::string &filename,
+                              const geometry::PointCloud &pointcloud,
+                              const GeometryArchiveOption &option = {});
+
+/// \brief Reads a point cloud from a geometry archive.
+///
+/// Uncompressed attributes are mapped into memory copy-on-write instead of
+/// being copied. The point cloud is on the CPU.
+/// \return true if the archive was read successfully.
+bool ReadPointCloudFromArchive(const std::string &filename,
+                               geometry::PointCloud &pointcloud);
+
+/// \brief Reads the points of a geometry archive inside an axis aligned box.
+///
+/// Only the chunks whose bounding boxes intersect the box are decompressed.
+///
+/// \param min_bound Minimum corner of the box, a {3} tensor.
+/// \param max_bound Maximum corner of the box, a {3} tensor.
+/// \return true if the archive was read successfully.
+bool ReadPointCloudFromArchive(const std::string &filename,
+                               geometry::PointCloud &pointcloud,
+                               const core::Tensor &min_bound,
+                               const core::Tensor &max_bound);
+
+/// \brief Writes all vertex and triangle attributes of \p mesh to a geometry
+/// archive. The order of the vertices and triangles is kept.
+/// \return true if the archive was written successfully.
+bool WriteTriangleMeshToArchive(const std::string &filename,
+                                const geometry::TriangleMesh &mesh,
+                                const GeometryArchiveOption &option = {});
+
+/// \brief Reads a triangle mesh from a geometry archive. The mesh is on the
+/// CPU.
+/// \return true if the archive was read successfully.
+bool ReadTriangleMeshFromArchive(const std::string &filename,
+                                 geometry::TriangleMesh &mesh);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,11 +26,14 @@
 
 #include "open3d/t/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "open3d/io/ImageIO.h"
+#include "open3d/t/io/file_format/ImageBuffer.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -61,6 +64,23 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
     return image;
 }
 
+std::unique_ptr<utility::Prefetcher<geometry::Image>> PrefetchImages(
+        const std::vector<std::string> &filenames,
+        const core::Device &device,
+        int num_workers,
+        int64_t queue_size) {
+    auto loader = [filenames, device](int64_t i) {
+        geometry::Image image;
+        if (!ReadImage(filenames[i], image)) {
+            utility::LogError("Failed to read image {}.", filenames[i]);
+        }
+        return image.To(device);
+    };
+    return std::make_unique<utility::Prefetcher<geometry::Image>>(
+            static_cast<int64_t>(filenames.size()), loader, num_workers,
+            queue_size);
+}
+
 bool ReadImage(const std::string &filename, geometry::Image &image) {
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -79,6 +99,127 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
     return map_itr->second(filename, image);
 }
 
+static bool ReadImageToBuffer(const std::string &filename,
+                              int downscale,
+                              const ImageBufferCallback &get_buffer) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext == "jpg" || filename_ext == "jpeg") {
+        return ReadJPGToBuffer(filename, downscale, get_buffer);
+    }
+    if (filename_ext == "png") {
+        if (downscale != 1) {
+            utility::LogWarning(
+                    "Read PNG failed: downscale is only supported for JPG "
+                    "images.");
+            return false;
+        }
+        return ReadPNGToBuffer(filename, get_buffer);
+    }
+    utility::LogWarning(
+            "Read geometry::Image failed: file extension {} unknown",
+            filename_ext);
+    return false;
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images,
+                int downscale) {
+    if (filenames.empty()) {
+        utility::LogWarning("Read images failed: no file names given.");
+        return false;
+    }
+    const int64_t num_images = static_cast<int64_t>(filenames.size());
+    const core::Device device = images.GetBlob() != nullptr
+                                        ? images.GetDevice()
+                                        : core::Device("CPU:0");
+
+    // The first image sets the shape of the batch.
+    core::SizeVector image_shape;
+    core::Dtype dtype = core::Undefined;
+    core::Tensor host_images;
+    bool success = ReadImageToBuffer(
+            filenames[0], downscale,
+            [&](int64_t rows, int64_t cols, int64_t channels,
+                core::Dtype image_dtype) {
+                image_shape = {rows, cols, channels};
+                dtype = image_dtype;
+                core::SizeVector shape{num_images, rows, cols, channels};
+                if (device.GetType() == core::Device::DeviceType::CPU &&
+                    images.GetShape() == shape &&
+                    images.GetDtype() == dtype && images.IsContiguous()) {
+                    host_images = images;
+                } else {
+                    host_images = core::Tensor(shape, dtype);
+                }
+                return host_images.GetDataPtr();
+            });
+    if (!success) {
+        return false;
+    }
+
+    const int64_t image_byte_size =
+            image_shape.NumElements() * dtype.ByteSize();
+    uint8_t *host_ptr = static_cast<uint8_t *>(host_images.GetDataPtr());
+    std::vector<uint8_t> image_success(num_images, 1);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 1; i < num_images; ++i) {
+        image_success[i] = ReadImageToBuffer(
+                filenames[i], downscale,
+                [&, i](int64_t rows, int64_t cols, int64_t channels,
+                       core::Dtype image_dtype) -> void * {
+                    if (core::SizeVector{rows, cols, channels} != image_shape ||
+                        image_dtype != dtype) {
+                        utility::LogWarning(
+                                "Read images failed: {} has shape {} and "
+                                "dtype {}, expected shape {} and dtype {}.",
+                                filenames[i],
+                                core::SizeVector{rows, cols, channels}
+                                        .ToString(),
+                                image_dtype.ToString(), image_shape.ToString(),
+                                dtype.ToString());
+                        return nullptr;
+                    }
+                    return host_ptr + i * image_byte_size;
+                });
+    }
+    if (std::find(image_success.begin(), image_success.end(), 0) !=
+        image_success.end()) {
+        return false;
+    }
+
+    if (!host_images.IsSame(images)) {
+        if (images.GetShape() == host_images.GetShape() &&
+            images.GetDtype() == dtype) {
+            images.CopyFrom(host_images);
+        } else {
+            images = host_images.To(device);
+        }
+    }
+    return true;
+}
+
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<geometry::Image> &images,
+                 int quality /* = kOpen3DImageIODefaultQuality*/) {
+    if (filenames.size() != images.size()) {
+        utility::LogWarning(
+                "Write images failed: got {} file names for {} images.",
+                filenames.size(), images.size());
+        return false;
+    }
+    const int64_t num_images = static_cast<int64_t>(images.size());
+    std::vector<uint8_t> image_success(num_images, 1);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_images; ++i) {
+        image_success[i] = WriteImage(filenames[i], images[i], quality);
+    }
+    return std::find(image_success.begin(), image_success.end(), 0) ==
+           image_success.end();
+}
+
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
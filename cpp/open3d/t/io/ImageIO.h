@@ -26,10 +26,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/t/geometry/Image.h"
+#include "open3d/utility/Prefetcher.h"
 
 namespace open3d {
 namespace t {
@@ -48,6 +51,18 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// Reads a list of images in background threads and returns them in order
+/// through the returned Prefetcher. Images are decoded on the CPU by
+/// \p num_workers workers and moved to \p device before they are handed out.
+/// At most \p queue_size images are held ahead of the consumer. If a file
+/// fails to read, the worker throws and Prefetcher::Next() rethrows the
+/// exception when that image is requested.
+std::unique_ptr<utility::Prefetcher<geometry::Image>> PrefetchImages(
+        const std::vector<std::string> &filenames,
+        const core::Device &device = core::Device("CPU:0"),
+        int num_workers = 2,
+        int64_t queue_size = 4);
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
@@ -74,6 +89,32 @@ bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = kOpen3DImageIODefaultQuality);
 
+/// Reads a batch of images into one {N, rows, cols, channels} tensor, decoding
+/// the files in parallel directly into the tensor memory. All images must have
+/// the same size, number of channels and dtype as the first one.
+///
+/// \param filenames Full paths to the images. Supported file formats are png,
+/// jpg/jpeg.
+/// \param images Output tensor. It is reused if it already has the batch
+/// shape and dtype, so that a caller decoding a stream of frames can reuse the
+/// same buffer. Otherwise it is reallocated on its device, or on CPU if it is
+/// undefined. Non-CPU tensors are filled through a host staging buffer.
+/// \param downscale Decode JPG images at 1/downscale of their size. Must be 1,
+/// 2, 4 or 8. libjpeg scales in the DCT domain, which is much faster than
+/// decoding at full size and resizing. PNG images only support 1.
+/// \return true if all images are read, false otherwise. The content of
+/// \p images is unspecified on failure.
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images,
+                int downscale = 1);
+
+/// Writes images to files, encoding them in parallel. See WriteImage for the
+/// supported formats and \p quality.
+/// \return true if all images are written, false otherwise.
+bool WriteImages(const std::vector<std::string> &filenames,
+                 const std::vector<geometry::Image> &images,
+                 int quality = kOpen3DImageIODefaultQuality);
+
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
 
 bool WriteImageToPNG(const std::string &filename,
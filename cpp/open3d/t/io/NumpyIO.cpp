@@ -207,7 +207,7 @@ static std::tuple<char, int64_t, core::SizeVector, bool> ParseNumpyHeader(
 
     std::string str_shape = header.substr(loc1 + 1, loc2 - loc1 - 1);
     while (std::regex_search(str_shape, sm, num_regex)) {
-        shape.push_back(std::stoi(sm[0].str()));
+        shape.push_back(std::stoll(sm[0].str()));
         str_shape = sm.suffix().str();
     }
 
@@ -272,18 +272,20 @@ public:
         return reinterpret_cast<const T*>(blob_->GetDataPtr());
     }
 
-    core::Dtype GetDtype() const {
-        if (type_ == 'f' && word_size_ == 4) return core::Float32;
-        if (type_ == 'f' && word_size_ == 8) return core::Float64;
-        if (type_ == 'i' && word_size_ == 1) return core::Int8;
-        if (type_ == 'i' && word_size_ == 2) return core::Int16;
-        if (type_ == 'i' && word_size_ == 4) return core::Int32;
-        if (type_ == 'i' && word_size_ == 8) return core::Int64;
-        if (type_ == 'u' && word_size_ == 1) return core::UInt8;
-        if (type_ == 'u' && word_size_ == 2) return core::UInt16;
-        if (type_ == 'u' && word_size_ == 4) return core::UInt32;
-        if (type_ == 'u' && word_size_ == 8) return core::UInt64;
-        if (type_ == 'b') return core::Bool;
+    core::Dtype GetDtype() const { return GetDtype(type_, word_size_); }
+
+    static core::Dtype GetDtype(char type, int64_t word_size) {
+        if (type == 'f' && word_size == 4) return core::Float32;
+        if (type == 'f' && word_size == 8) return core::Float64;
+        if (type == 'i' && word_size == 1) return core::Int8;
+        if (type == 'i' && word_size == 2) return core::Int16;
+        if (type == 'i' && word_size == 4) return core::Int32;
+        if (type == 'i' && word_size == 8) return core::Int64;
+        if (type == 'u' && word_size == 1) return core::UInt8;
+        if (type == 'u' && word_size == 2) return core::UInt16;
+        if (type == 'u' && word_size == 4) return core::UInt32;
+        if (type == 'u' && word_size == 8) return core::UInt64;
+        if (type == 'b') return core::Bool;
 
         return core::Undefined;
     }
@@ -295,16 +297,7 @@ public:
     int64_t NumBytes() const { return num_elements_ * word_size_; }
 
     core::Tensor ToTensor() const {
-        if (fortran_order_) {
-            utility::LogError("Cannot load Numpy array with fortran_order.");
-        }
-        core::Dtype dtype = GetDtype();
-        if (dtype.GetDtypeCode() == core::Dtype::DtypeCode::Undefined) {
-            utility::LogError(
-                    "Cannot load Numpy array with Numpy dtype={} and "
-                    "word_size={}.",
-                    type_, word_size_);
-        }
+        core::Dtype dtype = GetLoadableDtype(type_, word_size_, fortran_order_);
         // t.blob_ is the same as blob_, no need for memory copy.
         core::Tensor t(shape_, core::shape_util::DefaultStrides(shape_),
                        const_cast<void*>(GetDataPtr<void>()), dtype, blob_);
@@ -331,6 +324,29 @@ public:
         return arr;
     }
 
+    /// Creates a tensor backed by a memory mapping of the file's data.
+    static core::Tensor MapFromFile(const std::string& filename,
+                                    bool copy_on_write) {
+        // Closes the file even if the header fails to parse.
+        std::unique_ptr<FILE, decltype(&fclose)> fp(
+                fopen(filename.c_str(), "rb"), &fclose);
+        if (!fp) {
+            utility::LogError("Load: Unable to open file {}.", filename);
+        }
+        core::SizeVector shape;
+        int64_t word_size;
+        bool fortran_order;
+        char type;
+        std::tie(type, word_size, shape, fortran_order) =
+                ParseNumpyHeader(fp.get());
+        // The data follows the header directly.
+        int64_t data_offset = static_cast<int64_t>(ftell(fp.get()));
+        fp.reset();
+        core::Dtype dtype = GetLoadableDtype(type, word_size, fortran_order);
+        return core::Tensor::FromMappedFile(filename, data_offset, shape,
+                                            dtype, copy_on_write);
+    }
+
     void Save(std::string filename) const {
         FILE* fp = fopen(filename.c_str(), "wb");
         if (!fp) {
@@ -347,6 +363,22 @@ public:
     }
 
 private:
+    static core::Dtype GetLoadableDtype(char type,
+                                        int64_t word_size,
+                                        bool fortran_order) {
+        if (fortran_order) {
+            utility::LogError("Cannot load Numpy array with fortran_order.");
+        }
+        core::Dtype dtype = GetDtype(type, word_size);
+        if (dtype.GetDtypeCode() == core::Dtype::DtypeCode::Undefined) {
+            utility::LogError(
+                    "Cannot load Numpy array with Numpy dtype={} and "
+                    "word_size={}.",
+                    type, word_size);
+        }
+        return dtype;
+    }
+
     std::shared_ptr<core::Blob> blob_ = nullptr;
     core::SizeVector shape_;
     char type_;
@@ -355,8 +387,15 @@ private:
     int64_t num_elements_;
 };
 
-core::Tensor ReadNpy(const std::string& filename) {
-    return NumpyArray::CreateFromFile(filename).ToTensor();
+core::Tensor ReadNpy(const std::string& filename, NpyMapMode map_mode) {
+    switch (map_mode) {
+        case NpyMapMode::ReadOnly:
+            return NumpyArray::MapFromFile(filename, /*copy_on_write=*/false);
+        case NpyMapMode::CopyOnWrite:
+            return NumpyArray::MapFromFile(filename, /*copy_on_write=*/true);
+        default:
+            return NumpyArray::CreateFromFile(filename).ToTensor();
+    }
 }
 
 void WriteNpy(const std::string& filename, const core::Tensor& tensor) {
@@ -34,10 +34,26 @@ namespace open3d {
 namespace t {
 namespace io {
 
+/// Memory mapping modes of ReadNpy(), similar to numpy.load's mmap_mode.
+enum class NpyMapMode {
+    /// Read the whole array into memory.
+    NoMap,
+    /// Map the file read-only. Writing to the tensor is invalid.
+    ReadOnly,
+    /// Map the file copy-on-write. Writes are kept in memory and are never
+    /// stored back to the file.
+    CopyOnWrite,
+};
+
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param filename File name to read from.
-core::Tensor ReadNpy(const std::string& filename);
+/// \param map_mode With NpyMapMode::ReadOnly or NpyMapMode::CopyOnWrite, the
+/// tensor is backed by a memory mapping of the file instead of being read, see
+/// core::Tensor::FromMappedFile(). This allows working with arrays larger than
+/// the available memory.
+core::Tensor ReadNpy(const std::string& filename,
+                     NpyMapMode map_mode = NpyMapMode::NoMap);
 
 /// Save a tensor to a Numpy .npy file.
 ///
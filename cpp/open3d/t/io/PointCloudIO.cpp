@@ -45,8 +45,12 @@ static const std::unordered_map<
                            geometry::PointCloud &,
                            const open3d::io::ReadPointCloudOption &)>>
         file_extension_to_pointcloud_read_function{
+                {"xyz", ReadPointCloudFromXYZ},
+                {"xyzn", ReadPointCloudFromXYZN},
+                {"xyzrgb", ReadPointCloudFromXYZRGB},
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
         };
 
@@ -58,6 +62,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
         };
 
@@ -70,6 +75,24 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
     return pointcloud;
 }
 
+std::unique_ptr<utility::Prefetcher<geometry::PointCloud>> PrefetchPointClouds(
+        const std::vector<std::string> &filenames,
+        const core::Device &device,
+        const ReadPointCloudOption &params,
+        int num_workers,
+        int64_t queue_size) {
+    auto loader = [filenames, device, params](int64_t i) {
+        geometry::PointCloud pointcloud;
+        if (!ReadPointCloud(filenames[i], pointcloud, params)) {
+            utility::LogError("Failed to read point cloud {}.", filenames[i]);
+        }
+        return pointcloud.To(device);
+    };
+    return std::make_unique<utility::Prefetcher<geometry::PointCloud>>(
+            static_cast<int64_t>(filenames.size()), loader, num_workers,
+            queue_size);
+}
+
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
@@ -91,13 +114,38 @@ bool ReadPointCloud(const std::string &filename,
                 legacy_pointcloud, core::Float64);
     } else {
         success = map_itr->second(filename, pointcloud, params);
+        if (!success) {
+            return false;
+        }
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
                           (int)pointcloud.GetPoints().GetLength());
-        if (params.remove_nan_points || params.remove_infinite_points) {
-            utility::LogError(
-                    "remove_nan_points and remove_infinite_points options are "
-                    "unimplemented.");
-            return false;
+        if (pointcloud.HasPoints() &&
+            (params.remove_nan_points || params.remove_infinite_points)) {
+            const core::Tensor &points = pointcloud.GetPoints();
+            core::Tensor invalid =
+                    core::Tensor::Zeros({points.GetLength()}, core::Bool);
+            int64_t num_nan = 0, num_inf = 0;
+            if (params.remove_nan_points) {
+                const core::Tensor has_nan =
+                        points.IsNan().To(core::Int64).Sum({1}).Gt(0);
+                num_nan = has_nan.To(core::Int64).Sum({0}).Item<int64_t>();
+                invalid = invalid.LogicalOr(has_nan);
+            }
+            if (params.remove_infinite_points) {
+                // Points with both NaN and Inf values are counted as NaN.
+                core::Tensor has_inf =
+                        points.IsInf().To(core::Int64).Sum({1}).Gt(0);
+                has_inf = has_inf.LogicalAnd(invalid.LogicalNot());
+                num_inf = has_inf.To(core::Int64).Sum({0}).Item<int64_t>();
+                invalid = invalid.LogicalOr(has_inf);
+            }
+            if (num_nan + num_inf > 0) {
+                pointcloud = pointcloud.SelectByMask(invalid.LogicalNot());
+                utility::LogDebug(
+                        "[ReadPointCloud] {:d} nan points and {:d} infinite "
+                        "points have been removed.",
+                        num_nan, num_inf);
+            }
         }
     }
     return success;
@@ -26,10 +26,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Prefetcher.h"
 
 namespace open3d {
 namespace t {
@@ -61,6 +64,32 @@ bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params = {});
 
+/// Reads a list of point clouds in background threads and returns them in
+/// order through the returned Prefetcher. Each point cloud is read on the CPU
+/// by one of \p num_workers workers and moved to \p device before it is
+/// handed out, so that file decoding and host-to-device copies overlap with
+/// the consumer. At most \p queue_size point clouds are held ahead of the
+/// consumer. If a file fails to read, the worker throws and Prefetcher::Next()
+/// rethrows the exception when that point cloud is requested.
+std::unique_ptr<utility::Prefetcher<geometry::PointCloud>> PrefetchPointClouds(
+        const std::vector<std::string> &filenames,
+        const core::Device &device = core::Device("CPU:0"),
+        const ReadPointCloudOption &params = {},
+        int num_workers = 2,
+        int64_t queue_size = 4);
+
+bool ReadPointCloudFromXYZ(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromXYZN(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromXYZRGB(const std::string &filename,
+                              geometry::PointCloud &pointcloud,
+                              const ReadPointCloudOption &params);
+
 bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params);
@@ -77,6 +106,17 @@ bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// Reads a PCD file. binary_compressed data written by WritePointCloudToPCD
+/// is decompressed in parallel. Files written by other tools, e.g. PCL, hold
+/// a single LZF stream that can only be decompressed serially.
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
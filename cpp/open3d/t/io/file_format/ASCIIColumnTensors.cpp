@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/file_format/ASCIIColumnTensors.h"
+
+#include "open3d/core/Dtype.h"
+#include "open3d/io/ASCIIReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+std::vector<core::Tensor> ReadASCIIColumnTensors(
+        const utility::filesystem::MappedFile &file,
+        size_t offset,
+        const std::vector<int> &column_sizes,
+        int64_t max_lines,
+        utility::CountingProgressReporter &reporter,
+        int64_t *num_lines) {
+    std::vector<core::Tensor> columns;
+    const int64_t num_rows = open3d::io::ReadASCIIColumns(
+            file, offset, column_sizes, max_lines, reporter,
+            [&](int64_t max_rows) {
+                std::vector<double *> buffers;
+                for (const int size : column_sizes) {
+                    columns.emplace_back(core::SizeVector{max_rows, size},
+                                         core::Float64);
+                    buffers.push_back(columns.back().GetDataPtr<double>());
+                }
+                return buffers;
+            },
+            num_lines);
+    // Skipped lines leave unused rows at the end.
+    for (core::Tensor &column : columns) {
+        column = column.Slice(0, 0, num_rows);
+    }
+    return columns;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
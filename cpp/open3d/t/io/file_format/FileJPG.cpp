@@ -30,7 +30,11 @@
 #include <jpeglib.h>  // Include after cstddef to define size_t
 // clang-format on
 
+#include <algorithm>
+#include <functional>
+
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/file_format/ImageBuffer.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -38,12 +42,19 @@ namespace open3d {
 namespace t {
 namespace io {
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+bool ReadJPGToBuffer(const std::string &filename,
+                     int downscale,
+                     const ImageBufferCallback &get_buffer) {
     struct jpeg_decompress_struct cinfo;
     struct jpeg_error_mgr jerr;
     FILE *file_in;
-    JSAMPARRAY buffer;
 
+    if (downscale != 1 && downscale != 2 && downscale != 4 && downscale != 8) {
+        utility::LogWarning(
+                "Read JPG failed: downscale must be 1, 2, 4 or 8, but got {}.",
+                downscale);
+        return false;
+    }
     if ((file_in = utility::filesystem::FOpen(filename, "rb")) == NULL) {
         utility::LogWarning("Read JPG failed: unable to open file: {}",
                             filename);
@@ -77,21 +88,30 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
             fclose(file_in);
             return false;
     }
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = downscale;
     jpeg_start_decompress(&cinfo);
-    image.Clear();
-    image.Reset(cinfo.output_height, cinfo.output_width, num_of_channels,
-                core::UInt8, image.GetDevice());
 
-    int row_stride = cinfo.output_width * cinfo.output_components;
-    buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
-                                        row_stride, 1);
-    uint8_t *pdata = static_cast<uint8_t *>(image.GetDataPtr());
+    uint8_t *pdata = static_cast<uint8_t *>(
+            get_buffer(cinfo.output_height, cinfo.output_width,
+                       num_of_channels, core::UInt8));
+    if (pdata == nullptr) {
+        jpeg_abort_decompress(&cinfo);
+        jpeg_destroy_decompress(&cinfo);
+        fclose(file_in);
+        return false;
+    }
 
+    // Decode straight into the output, a few rows at a time.
+    int64_t row_stride = cinfo.output_width * cinfo.output_components;
+    JSAMPROW rows[8];
     while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);
-        core::MemoryManager::MemcpyFromHost(pdata, image.GetDevice(), buffer[0],
-                                            row_stride * 1);
-        pdata += row_stride;
+        JDIMENSION num_rows = std::min<JDIMENSION>(
+                8, cinfo.output_height - cinfo.output_scanline);
+        for (JDIMENSION r = 0; r < num_rows; ++r) {
+            rows[r] = pdata + (cinfo.output_scanline + r) * row_stride;
+        }
+        jpeg_read_scanlines(&cinfo, rows, num_rows);
     }
     jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
@@ -99,6 +119,22 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+    core::Device device = image.GetDevice();
+    geometry::Image host_image;
+    bool success = ReadJPGToBuffer(
+            filename, 1,
+            [&host_image](int64_t rows, int64_t cols, int64_t channels,
+                          core::Dtype dtype) {
+                host_image.Reset(rows, cols, channels, dtype);
+                return host_image.GetDataPtr();
+            });
+    if (success) {
+        image = host_image.To(device);
+    }
+    return success;
+}
+
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
                      int quality /* = kOpen3DImageIODefaultQuality*/) {
@@ -0,0 +1,1152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/ASCIIColumnTensors.h"
+#include "open3d/t/io/file_format/ColorConversion.h"
+#include "open3d/t/io/file_format/CopyStrided.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace t {
+namespace io {
+
+template <int64_t kSize>
+static void CopyStridedKernel(const char *src,
+                              int64_t src_stride,
+                              char *dst,
+                              int64_t dst_stride,
+                              int64_t size,
+                              int64_t num_points) {
+    // A constant size lets the compiler replace memcpy with plain moves.
+    const int64_t copy_size = kSize > 0 ? kSize : size;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        std::memcpy(dst + i * dst_stride, src + i * src_stride, copy_size);
+    }
+}
+
+void CopyStrided(const char *src,
+                 int64_t src_stride,
+                 char *dst,
+                 int64_t dst_stride,
+                 int64_t size,
+                 int64_t num_points) {
+    if (src_stride == size && dst_stride == size) {
+        std::memcpy(dst, src, size * num_points);
+        return;
+    }
+    switch (size) {
+        case 1:
+            CopyStridedKernel<1>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+        case 2:
+            CopyStridedKernel<2>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+        case 3:
+            CopyStridedKernel<3>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+        case 4:
+            CopyStridedKernel<4>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+        case 8:
+            CopyStridedKernel<8>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+        case 12:
+            CopyStridedKernel<12>(src, src_stride, dst, dst_stride, size,
+                                  num_points);
+            break;
+        case 24:
+            CopyStridedKernel<24>(src, src_stride, dst, dst_stride, size,
+                                  num_points);
+            break;
+        default:
+            CopyStridedKernel<0>(src, src_stride, dst, dst_stride, size,
+                                 num_points);
+            break;
+    }
+}
+
+namespace {
+
+enum PCDDataType {
+    PCD_DATA_ASCII = 0,
+    PCD_DATA_BINARY = 1,
+    PCD_DATA_BINARY_COMPRESSED = 2
+};
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset;
+    int offset;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int64_t width;
+    int64_t height;
+    int64_t points;
+    PCDDataType datatype;
+    // helper variables
+    int elementnum;
+    int pointsize;
+    size_t data_offset;
+    // Chunk layout of binary_compressed data written by this module: the
+    // uncompressed size of a chunk and the compressed size of every chunk.
+    int64_t lzf_chunk_size;
+    std::vector<int64_t> lzf_chunk_sizes;
+};
+
+// PCD readers skip comment lines, so the chunk layout of the LZF stream is
+// stored as a comment. Other readers decompress the chunks as one stream.
+constexpr const char *kLZFChunksComment = "LZF_CHUNKS";
+constexpr int64_t kLZFMinChunkSize = 256 * 1024;
+constexpr int64_t kLZFMaxNumChunks = 64;
+constexpr int64_t kPCDWriteBlockSize = 4 * 1024 * 1024;
+
+core::Dtype GetFieldDtype(const PCLPointField &field) {
+    if (field.type == 'F') {
+        if (field.size == 4) return core::Float32;
+        if (field.size == 8) return core::Float64;
+    } else if (field.type == 'I') {
+        if (field.size == 1) return core::Int8;
+        if (field.size == 2) return core::Int16;
+        if (field.size == 4) return core::Int32;
+        if (field.size == 8) return core::Int64;
+    } else if (field.type == 'U') {
+        if (field.size == 1) return core::UInt8;
+        if (field.size == 2) return core::UInt16;
+        if (field.size == 4) return core::UInt32;
+        if (field.size == 8) return core::UInt64;
+    }
+    return core::Undefined;
+}
+
+bool GetFieldType(core::Dtype dtype, char &type) {
+    if (dtype == core::Float32 || dtype == core::Float64) {
+        type = 'F';
+    } else if (dtype == core::Int8 || dtype == core::Int16 ||
+               dtype == core::Int32 || dtype == core::Int64) {
+        type = 'I';
+    } else if (dtype == core::UInt8 || dtype == core::UInt16 ||
+               dtype == core::UInt32 || dtype == core::UInt64) {
+        type = 'U';
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool CheckHeader(PCDHeader &header) {
+    if (header.points < 0 || header.pointsize <= 0) {
+        utility::LogWarning("[CheckHeader] PCD has no data.");
+        return false;
+    }
+    if (header.fields.size() == 0) {
+        utility::LogWarning("[CheckHeader] PCD has no fields.");
+        return false;
+    }
+    bool has_x = false;
+    bool has_y = false;
+    bool has_z = false;
+    for (const auto &field : header.fields) {
+        if (field.count < 1 || field.size < 1) {
+            utility::LogWarning("[CheckHeader] Field {} has no data.",
+                                field.name);
+            return false;
+        }
+        if (field.name == "x") {
+            has_x = true;
+        } else if (field.name == "y") {
+            has_y = true;
+        } else if (field.name == "z") {
+            has_z = true;
+        }
+    }
+    if (!(has_x && has_y && has_z)) {
+        utility::LogWarning(
+                "[CheckHeader] Fields for point data are not complete.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadPCDHeader(const utility::filesystem::MappedFile &file,
+                   PCDHeader &header) {
+    header.width = 0;
+    header.height = 0;
+    header.points = -1;
+    header.datatype = PCD_DATA_ASCII;
+    header.elementnum = 0;
+    header.pointsize = 0;
+    header.data_offset = file.GetSize();
+    header.lzf_chunk_size = 0;
+    size_t specified_channel_count = 0;
+    bool has_data = false;
+
+    const char *data = file.GetData();
+    size_t line_begin = 0;
+    while (line_begin < file.GetSize() && !has_data) {
+        const void *newline = std::memchr(data + line_begin, '\n',
+                                          file.GetSize() - line_begin);
+        const size_t line_end =
+                newline ? static_cast<const char *>(newline) - data
+                        : file.GetSize();
+        std::string line(data + line_begin, line_end - line_begin);
+        line_begin = std::min(line_end + 1, file.GetSize());
+        if (line == "") {
+            continue;
+        }
+        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
+        std::stringstream sstream(line);
+        sstream.imbue(std::locale::classic());
+        std::string line_type;
+        sstream >> line_type;
+        if (line_type.substr(0, 1) == "#") {
+            if (st.size() >= 3 && st[0] == "#" &&
+                st[1] == kLZFChunksComment) {
+                header.lzf_chunk_size = std::stoll(st[2]);
+                header.lzf_chunk_sizes.clear();
+                for (size_t i = 3; i < st.size(); i++) {
+                    header.lzf_chunk_sizes.push_back(std::stoll(st[i]));
+                }
+            }
+        } else if (line_type.substr(0, 7) == "VERSION") {
+            if (st.size() >= 2) {
+                header.version = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "FIELDS" ||
+                   line_type.substr(0, 7) == "COLUMNS") {
+            specified_channel_count = st.size() - 1;
+            if (specified_channel_count == 0) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            header.fields.resize(specified_channel_count);
+            int count_offset = 0, offset = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, count_offset += 1, offset += 4) {
+                header.fields[i].name = st[i + 1];
+                header.fields[i].size = 4;
+                header.fields[i].type = 'F';
+                header.fields[i].count = 1;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "SIZE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int offset = 0, col_type = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 i++, offset += col_type) {
+                sstream >> col_type;
+                header.fields[i].size = col_type;
+                header.fields[i].offset = offset;
+            }
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "TYPE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                header.fields[i].type = st[i + 1].c_str()[0];
+            }
+        } else if (line_type.substr(0, 5) == "COUNT") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int count_offset = 0, offset = 0, col_count = 0;
+            for (size_t i = 0; i < specified_channel_count; i++) {
+                sstream >> col_count;
+                header.fields[i].count = col_count;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+                count_offset += col_count;
+                offset += col_count * header.fields[i].size;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            sstream >> header.width;
+        } else if (line_type.substr(0, 6) == "HEIGHT") {
+            sstream >> header.height;
+        } else if (line_type.substr(0, 6) == "POINTS") {
+            sstream >> header.points;
+        } else if (line_type.substr(0, 4) == "DATA") {
+            header.datatype = PCD_DATA_ASCII;
+            if (st.size() >= 2) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.datatype = PCD_DATA_BINARY_COMPRESSED;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.datatype = PCD_DATA_BINARY;
+                }
+            }
+            header.data_offset = line_begin;
+            has_data = true;
+        }
+    }
+    if (!has_data) {
+        utility::LogWarning("[ReadPCDHeader] PCD has no DATA line.");
+        return false;
+    }
+    if (header.points < 0) {
+        header.points = header.width * header.height;
+    }
+    return CheckHeader(header);
+}
+
+/// Location of the values of a field. \p ptr points to the values of the
+/// first point, \p stride is the number of bytes between points and \p blob
+/// owns the memory.
+struct PCDFieldData {
+    std::shared_ptr<core::Blob> blob;
+    const char *ptr;
+    int64_t stride;
+};
+
+/// Returns the values of \p field_ids as one {num_points, count} tensor, where
+/// count is the total count of the fields. All fields must have the same type.
+///
+/// Fields stored next to each other at aligned offsets are returned as a view
+/// of their blob, which is strided if the points hold other fields as well.
+/// Others are copied.
+core::Tensor GetAttributeTensor(const PCDHeader &header,
+                                const std::vector<PCDFieldData> &field_data,
+                                const std::vector<size_t> &field_ids) {
+    const int64_t num_points = header.points;
+    const PCLPointField &first = header.fields[field_ids[0]];
+    const PCDFieldData &first_data = field_data[field_ids[0]];
+    const core::Dtype dtype = GetFieldDtype(first);
+    int64_t count = 0;
+    bool is_adjacent = true;
+    for (const size_t id : field_ids) {
+        is_adjacent = is_adjacent && field_data[id].blob == first_data.blob &&
+                      field_data[id].stride == first_data.stride &&
+                      field_data[id].ptr == first_data.ptr + count * first.size;
+        count += header.fields[id].count;
+    }
+    const int64_t row_size = count * first.size;
+    if (is_adjacent && first_data.stride % first.size == 0 &&
+        reinterpret_cast<uintptr_t>(first_data.ptr) % first.size == 0) {
+        return core::Tensor({num_points, count},
+                            {first_data.stride / first.size, 1},
+                            const_cast<char *>(first_data.ptr), dtype,
+                            first_data.blob);
+    }
+    core::Tensor tensor({num_points, count}, dtype);
+    char *dst = static_cast<char *>(tensor.GetDataPtr());
+    if (is_adjacent) {
+        CopyStrided(first_data.ptr, first_data.stride, dst, row_size, row_size,
+                    num_points);
+        return tensor;
+    }
+    int64_t offset = 0;
+    for (const size_t id : field_ids) {
+        const int64_t size = header.fields[id].size * header.fields[id].count;
+        CopyStrided(field_data[id].ptr, field_data[id].stride, dst + offset,
+                    row_size, size, num_points);
+        offset += size;
+    }
+    return tensor;
+}
+
+/// Unpacks a 4 byte rgb or rgba field into {num_points, 3} UInt8 colors. The
+/// bytes of the packed color are in BGRA order.
+core::Tensor UnpackColors(const PCDFieldData &data, int64_t num_points) {
+    core::Tensor colors({num_points, 3}, core::UInt8);
+    uint8_t *dst = colors.GetDataPtr<uint8_t>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        const char *bgra = data.ptr + i * data.stride;
+        dst[i * 3 + 0] = static_cast<uint8_t>(bgra[2]);
+        dst[i * 3 + 1] = static_cast<uint8_t>(bgra[1]);
+        dst[i * 3 + 2] = static_cast<uint8_t>(bgra[0]);
+    }
+    return colors;
+}
+
+/// Packs {num_points, 3} colors into {num_points, 1} UInt32 values holding
+/// the BGRA bytes of the PCD rgb field.
+core::Tensor PackColors(const core::Tensor &colors) {
+    const core::Tensor colors_uint8 =
+            ConvertColorTensorToUint8(colors).Contiguous();
+    const int64_t num_points = colors_uint8.GetLength();
+    core::Tensor packed({num_points, 1}, core::UInt32);
+    const uint8_t *src = colors_uint8.GetDataPtr<uint8_t>();
+    uint8_t *dst = static_cast<uint8_t *>(packed.GetDataPtr());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; i++) {
+        dst[i * 4 + 0] = src[i * 3 + 2];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 0];
+        dst[i * 4 + 3] = 0;
+    }
+    return packed;
+}
+
+/// Decompresses LZF data. Chunks written by WritePointCloudToPCD are
+/// decompressed in parallel. Other writers, e.g. PCL, compress all fields as
+/// one LZF stream whose back-references may cross field boundaries, so
+/// that stream is decompressed serially.
+bool DecompressLZF(const char *src,
+                   int64_t src_size,
+                   char *dst,
+                   int64_t dst_size,
+                   const PCDHeader &header) {
+    const int64_t num_chunks =
+            static_cast<int64_t>(header.lzf_chunk_sizes.size());
+    int64_t total_chunk_size = 0;
+    for (const int64_t chunk_size : header.lzf_chunk_sizes) {
+        total_chunk_size += chunk_size;
+    }
+    if (header.lzf_chunk_size <= 0 || total_chunk_size != src_size ||
+        num_chunks != (dst_size + header.lzf_chunk_size - 1) /
+                              header.lzf_chunk_size) {
+        return lzf_decompress(src, static_cast<unsigned int>(src_size), dst,
+                              static_cast<unsigned int>(dst_size)) ==
+               dst_size;
+    }
+    std::vector<int64_t> src_offsets(num_chunks + 1, 0);
+    for (int64_t i = 0; i < num_chunks; i++) {
+        src_offsets[i + 1] = src_offsets[i] + header.lzf_chunk_sizes[i];
+    }
+    int64_t num_failed = 0;
+#pragma omp parallel for schedule(static, 1) reduction(+ : num_failed) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_chunks; i++) {
+        const int64_t dst_offset = i * header.lzf_chunk_size;
+        const int64_t dst_chunk_size =
+                std::min(header.lzf_chunk_size, dst_size - dst_offset);
+        const unsigned int decompressed_size = lzf_decompress(
+                src + src_offsets[i],
+                static_cast<unsigned int>(header.lzf_chunk_sizes[i]),
+                dst + dst_offset, static_cast<unsigned int>(dst_chunk_size));
+        if (static_cast<int64_t>(decompressed_size) != dst_chunk_size) {
+            num_failed++;
+        }
+    }
+    return num_failed == 0;
+}
+
+/// Locates the data of every field. Binary data is used in place, compressed
+/// data is decompressed and ASCII data is parsed first.
+bool ReadPCDFieldData(const std::shared_ptr<core::Blob> &file_blob,
+                      const utility::filesystem::MappedFile &file,
+                      const PCDHeader &header,
+                      utility::CountingProgressReporter &reporter,
+                      std::vector<PCDFieldData> &field_data) {
+    const int64_t num_points = header.points;
+    const char *data = file.GetData() + header.data_offset;
+    const int64_t data_size =
+            static_cast<int64_t>(file.GetSize() - header.data_offset);
+    const int64_t num_bytes = num_points * header.pointsize;
+    field_data.clear();
+
+    if (header.datatype == PCD_DATA_ASCII) {
+        std::vector<int> column_sizes;
+        for (const auto &field : header.fields) {
+            column_sizes.push_back(field.count);
+        }
+        int64_t num_lines = 0;
+        const std::vector<core::Tensor> columns =
+                ReadASCIIColumnTensors(file, header.data_offset, column_sizes,
+                                       num_points, reporter, &num_lines);
+        const int64_t num_rows = columns[0].GetLength();
+        if (num_lines < num_points || num_rows < num_lines) {
+            utility::LogWarning(
+                    "[ReadPCDData] Expected {} points with {} values, but "
+                    "read {} valid lines out of {}.",
+                    num_points, header.elementnum, num_rows, num_lines);
+            return false;
+        }
+        for (size_t i = 0; i < header.fields.size(); i++) {
+            const core::Dtype dtype = GetFieldDtype(header.fields[i]);
+            const core::Tensor values = columns[i].To(
+                    dtype == core::Undefined ? core::Float64 : dtype);
+            field_data.push_back(
+                    {values.GetBlob(),
+                     static_cast<const char *>(values.GetDataPtr()),
+                     values.GetStride(0) * values.GetDtype().ByteSize()});
+        }
+    } else if (header.datatype == PCD_DATA_BINARY) {
+        if (data_size < num_bytes) {
+            utility::LogWarning(
+                    "[ReadPCDData] Expected {} bytes of data, but the file "
+                    "only has {}.",
+                    num_bytes, data_size);
+            return false;
+        }
+        for (const auto &field : header.fields) {
+            field_data.push_back(
+                    {file_blob, data + field.offset, header.pointsize});
+        }
+    } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
+        std::uint32_t compressed_size = 0;
+        std::uint32_t uncompressed_size = 0;
+        if (data_size < 8) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        std::memcpy(&compressed_size, data, sizeof(compressed_size));
+        std::memcpy(&uncompressed_size, data + 4, sizeof(uncompressed_size));
+        utility::LogDebug(
+                "PCD data with {:d} compressed size, and {:d} uncompressed "
+                "size.",
+                compressed_size, uncompressed_size);
+        if (data_size - 8 < compressed_size) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        if (uncompressed_size != num_bytes) {
+            utility::LogWarning(
+                    "[ReadPCDData] Expected {} bytes of uncompressed data, "
+                    "but the file has {}.",
+                    num_bytes, uncompressed_size);
+            return false;
+        }
+        // Fields are stored one after another, each as a contiguous array.
+        core::Tensor buffer({num_bytes}, core::UInt8);
+        char *buffer_ptr = static_cast<char *>(buffer.GetDataPtr());
+        if (num_bytes > 0 && !DecompressLZF(data + 8, compressed_size,
+                                            buffer_ptr, num_bytes, header)) {
+            utility::LogWarning("[ReadPCDData] Uncompression failed.");
+            return false;
+        }
+        for (const auto &field : header.fields) {
+            field_data.push_back({buffer.GetBlob(),
+                                  buffer_ptr + field.offset * num_points,
+                                  field.size * field.count});
+        }
+    }
+    return true;
+}
+
+struct PCDWriteField {
+    PCLPointField field;
+    // Contiguous {num_points, num_columns} attribute. The field holds
+    // field.count columns starting at column.
+    core::Tensor values;
+    int64_t column;
+
+    const char *GetData() const {
+        return static_cast<const char *>(values.GetDataPtr()) +
+               column * field.size;
+    }
+    int64_t GetStride() const { return values.GetShape(1) * field.size; }
+};
+
+bool AddWriteField(const std::string &name,
+                   const core::Tensor &values,
+                   int64_t column,
+                   int64_t count,
+                   std::vector<PCDWriteField> &write_fields) {
+    char type;
+    if (!GetFieldType(values.GetDtype(), type)) {
+        return false;
+    }
+    PCDWriteField write_field;
+    write_field.field.name = name;
+    write_field.field.type = type;
+    write_field.field.size = static_cast<int>(values.GetDtype().ByteSize());
+    write_field.field.count = static_cast<int>(count);
+    write_field.values = values;
+    write_field.column = column;
+    write_fields.push_back(write_field);
+    return true;
+}
+
+bool GenerateWriteFields(const geometry::PointCloud &pointcloud,
+                         std::vector<PCDWriteField> &write_fields) {
+    const core::Tensor points = pointcloud.GetPoints().Contiguous();
+    const int64_t num_points = points.GetLength();
+    if (points.NumDims() != 2 || points.GetShape(1) != 3) {
+        utility::LogWarning("Points must have shape {{N, 3}}.");
+        return false;
+    }
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.second.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Attribute {} has {} values, but there are {} points.",
+                    it.first, it.second.GetLength(), num_points);
+            return false;
+        }
+    }
+    write_fields.clear();
+    if (!AddWriteField("x", points, 0, 1, write_fields) ||
+        !AddWriteField("y", points, 1, 1, write_fields) ||
+        !AddWriteField("z", points, 2, 1, write_fields)) {
+        utility::LogWarning("Unsupported dtype {} for points.",
+                            points.GetDtype().ToString());
+        return false;
+    }
+    if (pointcloud.HasPointNormals()) {
+        const core::Tensor normals = pointcloud.GetPointNormals().Contiguous();
+        if (!AddWriteField("normal_x", normals, 0, 1, write_fields) ||
+            !AddWriteField("normal_y", normals, 1, 1, write_fields) ||
+            !AddWriteField("normal_z", normals, 2, 1, write_fields)) {
+            utility::LogWarning("Unsupported dtype {} for normals.",
+                                normals.GetDtype().ToString());
+            return false;
+        }
+    }
+    if (pointcloud.HasPointColors()) {
+        AddWriteField("rgb", PackColors(pointcloud.GetPointColors()), 0, 1,
+                      write_fields);
+        // The packed color is stored as a float.
+        write_fields.back().field.type = 'F';
+    }
+    // Other attributes are written in alphabetical order.
+    const std::map<std::string, core::Tensor> attributes(
+            pointcloud.GetPointAttr().begin(),
+            pointcloud.GetPointAttr().end());
+    for (const auto &it : attributes) {
+        const std::string &name = it.first;
+        if (name == "points" || name == "normals" || name == "colors") {
+            continue;
+        }
+        if (name.find_first_of(" \t\r\n") != std::string::npos) {
+            utility::LogWarning("Skipping attribute \"{}\" with white space.",
+                                name);
+            continue;
+        }
+        const int64_t count =
+                num_points == 0 ? 1 : it.second.NumElements() / num_points;
+        core::Tensor values =
+                it.second.Reshape({num_points, count}).Contiguous();
+        if (values.GetDtype() == core::Bool) {
+            values = values.To(core::UInt8);
+        }
+        if (count == 0 ||
+            !AddWriteField(name == "intensities" ? "intensity" : name, values,
+                           0, count, write_fields)) {
+            utility::LogWarning("Skipping attribute {} with dtype {}.", name,
+                                values.GetDtype().ToString());
+        }
+    }
+    return true;
+}
+
+void GenerateHeader(std::vector<PCDWriteField> &write_fields,
+                    int64_t num_points,
+                    PCDDataType datatype,
+                    PCDHeader &header) {
+    header.version = "0.7";
+    header.width = num_points;
+    header.height = 1;
+    header.points = num_points;
+    header.datatype = datatype;
+    header.fields.clear();
+    int count_offset = 0, offset = 0, max_size = 1;
+    auto add_field = [&](PCLPointField field) {
+        field.count_offset = count_offset;
+        field.offset = offset;
+        count_offset += field.count;
+        offset += field.size * field.count;
+        header.fields.push_back(field);
+    };
+    auto add_padding = [&](int alignment) {
+        // Padding fields are named "_", as in PCL.
+        if (datatype != PCD_DATA_ASCII && offset % alignment != 0) {
+            add_field({"_", 1, 'U', alignment - offset % alignment, 0, 0});
+        }
+    };
+    for (auto &write_field : write_fields) {
+        add_padding(write_field.field.size);
+        max_size = std::max(max_size, write_field.field.size);
+        add_field(write_field.field);
+        write_field.field = header.fields.back();
+    }
+    add_padding(max_size);
+    header.elementnum = count_offset;
+    header.pointsize = offset;
+    header.lzf_chunk_size = 0;
+    header.lzf_chunk_sizes.clear();
+}
+
+bool WritePCDHeader(FILE *file, const PCDHeader &header) {
+    std::string header_tail = fmt::format("VERSION {}\nFIELDS", header.version);
+    for (const auto &field : header.fields) {
+        header_tail += " " + field.name;
+    }
+    header_tail += "\nSIZE";
+    for (const auto &field : header.fields) {
+        header_tail += fmt::format(" {}", field.size);
+    }
+    header_tail += "\nTYPE";
+    for (const auto &field : header.fields) {
+        header_tail += fmt::format(" {}", field.type);
+    }
+    header_tail += "\nCOUNT";
+    for (const auto &field : header.fields) {
+        header_tail += fmt::format(" {}", field.count);
+    }
+    header_tail += fmt::format(
+            "\nWIDTH {}\nHEIGHT {}\nVIEWPOINT 0 0 0 1 0 0 0\nPOINTS {}\n",
+            header.width, header.height, header.points);
+    if (!header.lzf_chunk_sizes.empty()) {
+        header_tail += fmt::format("# {} {}", kLZFChunksComment,
+                                   header.lzf_chunk_size);
+        for (const int64_t chunk_size : header.lzf_chunk_sizes) {
+            header_tail += fmt::format(" {}", chunk_size);
+        }
+        header_tail += "\n";
+    }
+    switch (header.datatype) {
+        case PCD_DATA_BINARY:
+            header_tail += "DATA binary\n";
+            break;
+        case PCD_DATA_BINARY_COMPRESSED:
+            header_tail += "DATA binary_compressed\n";
+            break;
+        case PCD_DATA_ASCII:
+        default:
+            header_tail += "DATA ascii\n";
+            break;
+    }
+
+    std::string header_str = fmt::format(
+            "# .PCD v{} - Point Cloud Data file format", header.version);
+    if (header.datatype == PCD_DATA_BINARY) {
+        // The comment is padded so that the data starts at a multiple of 8
+        // bytes, which lets the reader return aligned views of the mapped
+        // file.
+        const size_t header_size = header_str.size() + 1 + header_tail.size();
+        header_str += std::string((8 - header_size % 8) % 8, ' ');
+    }
+    header_str += "\n" + header_tail;
+    return fwrite(header_str.data(), 1, header_str.size(), file) ==
+           header_str.size();
+}
+
+void WriteASCIIValue(FILE *file, const char *ptr, const PCLPointField &field) {
+    if (field.type == 'F' && field.size == 4) {
+        float value;
+        std::memcpy(&value, ptr, sizeof(value));
+        fprintf(file, "%.9g", value);
+    } else if (field.type == 'F') {
+        double value;
+        std::memcpy(&value, ptr, sizeof(value));
+        fprintf(file, "%.17g", value);
+    } else if (field.type == 'I') {
+        std::int64_t value = 0;
+        if (field.size == 1) {
+            value = *reinterpret_cast<const std::int8_t *>(ptr);
+        } else if (field.size == 2) {
+            std::int16_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            value = v;
+        } else if (field.size == 4) {
+            std::int32_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            value = v;
+        } else {
+            std::memcpy(&value, ptr, sizeof(value));
+        }
+        fprintf(file, "%lld", static_cast<long long>(value));
+    } else {
+        std::uint64_t value = 0;
+        if (field.size == 1) {
+            value = *reinterpret_cast<const std::uint8_t *>(ptr);
+        } else if (field.size == 2) {
+            std::uint16_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            value = v;
+        } else if (field.size == 4) {
+            std::uint32_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            value = v;
+        } else {
+            std::memcpy(&value, ptr, sizeof(value));
+        }
+        fprintf(file, "%llu", static_cast<unsigned long long>(value));
+    }
+}
+
+/// Packs the fields of points [begin, end) into \p dst. Binary data stores one
+/// point after another, compressed data stores one field after another.
+void PackPCDFields(const PCDHeader &header,
+                   const std::vector<PCDWriteField> &write_fields,
+                   int64_t begin,
+                   int64_t end,
+                   char *dst) {
+    const int64_t num_points = end - begin;
+    const bool compressed = header.datatype == PCD_DATA_BINARY_COMPRESSED;
+    for (size_t i = 0; i < write_fields.size();) {
+        const PCDWriteField &write_field = write_fields[i];
+        const PCLPointField &field = write_field.field;
+        int64_t size = field.size * field.count;
+        // Copy neighboring columns of an attribute at once, e.g. x, y and z.
+        size_t next = i + 1;
+        while (!compressed && next < write_fields.size() &&
+               write_fields[next].values.GetDataPtr() ==
+                       write_field.values.GetDataPtr() &&
+               write_fields[next].GetData() == write_field.GetData() + size &&
+               write_fields[next].field.offset == field.offset + size) {
+            size += write_fields[next].field.size *
+                    write_fields[next].field.count;
+            next++;
+        }
+        const char *src =
+                write_field.GetData() + begin * write_field.GetStride();
+        if (compressed) {
+            CopyStrided(src, write_field.GetStride(),
+                        dst + field.offset * num_points, size, size,
+                        num_points);
+        } else {
+            CopyStrided(src, write_field.GetStride(), dst + field.offset,
+                        header.pointsize, size, num_points);
+        }
+        i = next;
+    }
+}
+
+bool WritePCDData(FILE *file,
+                  PCDHeader &header,
+                  const std::vector<PCDWriteField> &write_fields,
+                  utility::CountingProgressReporter &reporter) {
+    const int64_t num_points = header.points;
+    if (header.datatype == PCD_DATA_ASCII) {
+        for (int64_t i = 0; i < num_points; i++) {
+            for (size_t j = 0; j < write_fields.size(); j++) {
+                const PCLPointField &field = write_fields[j].field;
+                const char *ptr = write_fields[j].GetData() +
+                                  i * write_fields[j].GetStride();
+                for (int c = 0; c < field.count; c++) {
+                    if (j > 0 || c > 0) {
+                        fprintf(file, " ");
+                    }
+                    WriteASCIIValue(file, ptr + c * field.size, field);
+                }
+            }
+            fprintf(file, "\n");
+            if (i % 1000 == 0) {
+                reporter.Update(i);
+            }
+        }
+        return true;
+    }
+
+    const int64_t num_bytes = num_points * header.pointsize;
+    if (header.datatype == PCD_DATA_BINARY) {
+        // Pack blocks of points into a small buffer that stays in cache.
+        const int64_t block_size = std::max<int64_t>(
+                1, kPCDWriteBlockSize / header.pointsize);
+        std::vector<char> buffer(block_size * header.pointsize, 0);
+        for (int64_t begin = 0; begin < num_points; begin += block_size) {
+            const int64_t end = std::min(begin + block_size, num_points);
+            PackPCDFields(header, write_fields, begin, end, buffer.data());
+            const size_t size = (end - begin) * header.pointsize;
+            if (fwrite(buffer.data(), 1, size, file) != size) {
+                utility::LogWarning("[WritePCDData] Failed to write data.");
+                return false;
+            }
+            reporter.Update(end);
+        }
+        return true;
+    }
+
+    std::vector<char> buffer(num_bytes, 0);
+    char *buffer_ptr = buffer.data();
+    PackPCDFields(header, write_fields, 0, num_points, buffer_ptr);
+    reporter.Update(num_points / 2);
+
+    // LZF back references are relative to the output position, so chunks
+    // compressed independently concatenate into one valid LZF stream.
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min(kLZFMaxNumChunks, num_bytes / kLZFMinChunkSize));
+    const int64_t chunk_size =
+            std::max<int64_t>(1, (num_bytes + num_chunks - 1) / num_chunks);
+    std::vector<std::vector<char>> chunks(num_chunks);
+    header.lzf_chunk_size = chunk_size;
+    header.lzf_chunk_sizes.assign(num_chunks, 0);
+    int64_t num_failed = 0;
+    if (num_bytes > 0) {
+#pragma omp parallel for schedule(static, 1) reduction(+ : num_failed) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_chunks; i++) {
+            const int64_t offset = i * chunk_size;
+            const int64_t size = std::min(chunk_size, num_bytes - offset);
+            // Incompressible data grows by less than 4%.
+            chunks[i].resize(size + size / 16 + 64);
+            const unsigned int compressed_size = lzf_compress(
+                    buffer_ptr + offset, static_cast<unsigned int>(size),
+                    chunks[i].data(),
+                    static_cast<unsigned int>(chunks[i].size()));
+            header.lzf_chunk_sizes[i] = compressed_size;
+            if (compressed_size == 0) {
+                num_failed++;
+            }
+        }
+    }
+    if (num_failed > 0) {
+        utility::LogWarning("[WritePCDData] Failed to compress data.");
+        return false;
+    }
+    std::uint32_t size_compressed = 0;
+    for (const int64_t size : header.lzf_chunk_sizes) {
+        size_compressed += static_cast<std::uint32_t>(size);
+    }
+    const std::uint32_t buffer_size_in_bytes =
+            static_cast<std::uint32_t>(num_bytes);
+    utility::LogDebug(
+            "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
+            buffer_size_in_bytes, size_compressed);
+    if (num_bytes == 0) {
+        header.lzf_chunk_sizes.clear();
+    }
+    if (!WritePCDHeader(file, header)) {
+        return false;
+    }
+    fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+    fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+    for (int64_t i = 0; i < num_chunks && num_bytes > 0; i++) {
+        if (fwrite(chunks[i].data(), 1, header.lzf_chunk_sizes[i], file) !=
+            static_cast<size_t>(header.lzf_chunk_sizes[i])) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    try {
+        // Pointcloud is empty if the file is not read successfully.
+        pointcloud.Clear();
+
+        // Binary fields are returned as views of the mapping.
+        auto file = std::make_shared<utility::filesystem::MappedFile>();
+        if (!file->Open(filename, true,
+                        utility::filesystem::MappedFile::AccessPattern::
+                                Normal)) {
+            utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const std::shared_ptr<core::Blob> file_blob =
+                core::Tensor::FromMappedFile(
+                        file, 0, {static_cast<int64_t>(file->GetSize())},
+                        core::UInt8)
+                        .GetBlob();
+
+        PCDHeader header;
+        if (!ReadPCDHeader(*file, header)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            return false;
+        }
+        utility::LogDebug(
+                "PCD header indicates {:d} fields, {:d} bytes per point, and "
+                "{:d} points in total.",
+                (int)header.fields.size(), header.pointsize, header.points);
+        for (const auto &field : header.fields) {
+            utility::LogDebug("{}, {}, {:d}, {:d}, {:d}", field.name.c_str(),
+                              field.type, field.size, field.count,
+                              field.offset);
+        }
+        utility::LogDebug("Compression method is {:d}.", (int)header.datatype);
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(file->GetSize());
+
+        std::vector<PCDFieldData> field_data;
+        if (!ReadPCDFieldData(file_blob, *file, header, reporter,
+                              field_data)) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            return false;
+        }
+
+        // Group the fields into attributes.
+        std::vector<size_t> point_ids(3), normal_ids(3);
+        int num_points = 0, num_normals = 0;
+        for (size_t i = 0; i < header.fields.size(); i++) {
+            const PCLPointField &field = header.fields[i];
+            if (field.name == "_") {
+                continue;
+            } else if (GetFieldDtype(field) == core::Undefined) {
+                utility::LogWarning(
+                        "Read PCD: skipping field {} with type {} and size "
+                        "{}.",
+                        field.name, field.type, field.size);
+            } else if (field.count == 1 &&
+                       (field.name == "x" || field.name == "y" ||
+                        field.name == "z")) {
+                point_ids[field.name[0] - 'x'] = i;
+                num_points++;
+            } else if (field.count == 1 && (field.name == "normal_x" ||
+                                            field.name == "normal_y" ||
+                                            field.name == "normal_z")) {
+                normal_ids[field.name[7] - 'x'] = i;
+                num_normals++;
+            } else if (field.name == "rgb" || field.name == "rgba") {
+                if (field.size == 4 && field.count == 1) {
+                    pointcloud.SetPointColors(
+                            UnpackColors(field_data[i], header.points));
+                } else {
+                    utility::LogWarning(
+                            "Read PCD: skipping color field {} with size {}.",
+                            field.name, field.size);
+                }
+            } else {
+                pointcloud.SetPointAttr(
+                        field.name == "intensity" ? "intensities" : field.name,
+                        GetAttributeTensor(header, field_data, {i}));
+            }
+        }
+        // Fields of different types are converted to Float64.
+        auto merge_fields = [&](const std::vector<size_t> &field_ids) {
+            const core::Dtype dtype =
+                    GetFieldDtype(header.fields[field_ids[0]]);
+            bool same_dtype = true;
+            for (const size_t id : field_ids) {
+                same_dtype = same_dtype &&
+                             GetFieldDtype(header.fields[id]) == dtype;
+            }
+            if (same_dtype) {
+                return GetAttributeTensor(header, field_data, field_ids);
+            }
+            core::Tensor merged({header.points, 3}, core::Float64);
+            for (int64_t i = 0; i < 3; i++) {
+                merged.Slice(1, i, i + 1) =
+                        GetAttributeTensor(header, field_data, {field_ids[i]});
+            }
+            return merged;
+        };
+        if (num_points != 3) {
+            utility::LogWarning("Read PCD failed: unsupported point fields.");
+            return false;
+        }
+        pointcloud.SetPoints(merge_fields(point_ids));
+        if (num_normals == 3) {
+            pointcloud.SetPointNormals(merge_fields(normal_ids));
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PCD failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    try {
+        if (!pointcloud.HasPoints()) {
+            utility::LogWarning("Write PCD failed: point cloud has no points.");
+            return false;
+        }
+        std::vector<PCDWriteField> write_fields;
+        if (!GenerateWriteFields(pointcloud, write_fields)) {
+            utility::LogWarning("Write PCD failed: unable to generate header.");
+            return false;
+        }
+        const int64_t num_points = pointcloud.GetPoints().GetLength();
+        PCDDataType datatype = PCD_DATA_ASCII;
+        if (!bool(params.write_ascii)) {
+            datatype = bool(params.compressed) ? PCD_DATA_BINARY_COMPRESSED
+                                               : PCD_DATA_BINARY;
+        }
+        PCDHeader header;
+        GenerateHeader(write_fields, num_points, datatype, header);
+
+        FILE *file = utility::filesystem::FOpen(filename.c_str(), "wb");
+        if (file == NULL) {
+            utility::LogWarning("Write PCD failed: unable to open file.");
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+        // The compressed data header holds the chunk layout, it is written
+        // after compression.
+        if (datatype != PCD_DATA_BINARY_COMPRESSED &&
+            !WritePCDHeader(file, header)) {
+            utility::LogWarning("Write PCD failed: unable to write header.");
+            fclose(file);
+            return false;
+        }
+        if (!WritePCDData(file, header, write_fields, reporter)) {
+            utility::LogWarning("Write PCD failed: unable to write data.");
+            fclose(file);
+            return false;
+        }
+        fclose(file);
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write PCD failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,11 +26,18 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+#include "open3d/core/Blob.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/CopyStrided.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -39,6 +46,9 @@ namespace open3d {
 namespace t {
 namespace io {
 
+// Number of bytes of vertex data packed per fwrite by the binary writer.
+static constexpr int64_t kPLYWriteBlockSize = 4 * 1024 * 1024;
+
 struct PLYReaderState {
     struct AttrState {
         std::string name_;
@@ -171,9 +181,301 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+/// A scalar property of the vertex element of a binary PLY file.
+struct PLYBinaryProperty {
+    std::string name_;
+    e_ply_type type_;
+    // Byte offset of the property in a vertex.
+    int64_t offset_;
+};
+
+/// Layout of the vertex element of a binary little-endian PLY file.
+struct PLYBinaryLayout {
+    std::vector<PLYBinaryProperty> properties_;
+    int64_t num_vertices_ = 0;
+    // Bytes per vertex.
+    int64_t stride_ = 0;
+    // File offset of the first vertex.
+    size_t data_offset_ = 0;
+};
+
+static bool GetPlyTypeFromString(const std::string &name,
+                                 e_ply_type &type,
+                                 int64_t &size) {
+    static const std::unordered_map<std::string,
+                                    std::pair<e_ply_type, int64_t>>
+            name_to_type{
+                    {"int8", {PLY_INT8, 1}},
+                    {"uint8", {PLY_UINT8, 1}},
+                    {"int16", {PLY_INT16, 2}},
+                    {"uint16", {PLY_UINT16, 2}},
+                    {"int32", {PLY_INT32, 4}},
+                    {"uint32", {PLY_UIN32, 4}},
+                    {"float32", {PLY_FLOAT32, 4}},
+                    {"float64", {PLY_FLOAT64, 8}},
+                    {"char", {PLY_CHAR, 1}},
+                    {"uchar", {PLY_UCHAR, 1}},
+                    {"short", {PLY_SHORT, 2}},
+                    {"ushort", {PLY_USHORT, 2}},
+                    {"int", {PLY_INT, 4}},
+                    {"uint", {PLY_UINT, 4}},
+                    {"float", {PLY_FLOAT, 4}},
+                    {"double", {PLY_DOUBLE, 8}},
+            };
+    auto it = name_to_type.find(name);
+    if (it == name_to_type.end()) {
+        return false;
+    }
+    type = it->second.first;
+    size = it->second.second;
+    return true;
+}
+
+/// Parses the header of \p file. Returns false unless the file is binary
+/// little-endian, and the vertex element and all elements before it have
+/// fixed-size rows, i.e. no list properties.
+static bool ReadBinaryPLYLayout(const utility::filesystem::MappedFile &file,
+                                PLYBinaryLayout &layout) {
+    const char *data = file.GetData();
+    const size_t file_size = file.GetSize();
+    size_t pos = 0;
+    bool is_first_line = true;
+    bool is_binary_little_endian = false;
+    bool found_vertex = false;
+    // State of the element being parsed.
+    std::string element_name;
+    int64_t element_count = 0;
+    int64_t element_stride = 0;
+    bool element_has_list = false;
+    // Bytes of the elements stored before the vertex element.
+    int64_t skip_size = 0;
+
+    auto finish_element = [&]() {
+        if (element_name.empty() || found_vertex) {
+            return true;
+        }
+        if (element_has_list) {
+            return false;
+        }
+        if (element_name == "vertex") {
+            layout.num_vertices_ = element_count;
+            layout.stride_ = element_stride;
+            found_vertex = true;
+            return true;
+        }
+        if (element_stride > 0 &&
+            element_count > static_cast<int64_t>(file_size) / element_stride) {
+            return false;
+        }
+        skip_size += element_count * element_stride;
+        return true;
+    };
+
+    while (pos < file_size) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + pos, '\n', file_size - pos));
+        if (!line_end) {
+            return false;
+        }
+        std::istringstream line(std::string(data + pos, line_end));
+        pos = line_end - data + 1;
+        std::string keyword;
+        line >> keyword;
+        if (is_first_line) {
+            if (keyword != "ply") {
+                return false;
+            }
+            is_first_line = false;
+        } else if (keyword == "format") {
+            std::string format;
+            line >> format;
+            is_binary_little_endian = format == "binary_little_endian";
+        } else if (keyword == "element") {
+            if (!finish_element()) {
+                return false;
+            }
+            line >> element_name >> element_count;
+            if (line.fail() || element_count < 0) {
+                return false;
+            }
+            element_stride = 0;
+            element_has_list = false;
+        } else if (keyword == "property") {
+            std::string type_name, name;
+            line >> type_name >> name;
+            if (line.fail() || element_name.empty()) {
+                return false;
+            }
+            if (type_name == "list") {
+                element_has_list = true;
+                continue;
+            }
+            e_ply_type type;
+            int64_t size;
+            if (!GetPlyTypeFromString(type_name, type, size)) {
+                return false;
+            }
+            if (element_name == "vertex" && !found_vertex) {
+                layout.properties_.push_back({name, type, element_stride});
+            }
+            element_stride += size;
+        } else if (keyword == "end_header") {
+            if (!finish_element()) {
+                return false;
+            }
+            layout.data_offset_ = pos + skip_size;
+            break;
+        }
+    }
+    if (!is_binary_little_endian || !found_vertex ||
+        layout.data_offset_ == 0 || layout.data_offset_ > file_size) {
+        return false;
+    }
+    return layout.stride_ == 0 ||
+           layout.num_vertices_ <=
+                   static_cast<int64_t>(file_size - layout.data_offset_) /
+                           layout.stride_;
+}
+
+/// Returns the vertex properties \p ids as one {num_vertices, ids.size()}
+/// tensor. All properties must have the same type. Properties stored next to
+/// each other at aligned offsets are returned as a view of \p blob, which is
+/// strided if the vertex holds other properties as well. Others are copied.
+static core::Tensor GetVertexColumns(const std::shared_ptr<core::Blob> &blob,
+                                     const char *vertices,
+                                     const PLYBinaryLayout &layout,
+                                     const std::vector<size_t> &ids) {
+    const core::Dtype dtype = GetDtype(layout.properties_[ids[0]].type_);
+    const int64_t size = dtype.ByteSize();
+    const int64_t num_columns = static_cast<int64_t>(ids.size());
+    const int64_t num_vertices = layout.num_vertices_;
+    const int64_t first_offset = layout.properties_[ids[0]].offset_;
+    bool is_adjacent = true;
+    for (int64_t i = 0; i < num_columns; i++) {
+        is_adjacent = is_adjacent && layout.properties_[ids[i]].offset_ ==
+                                             first_offset + i * size;
+    }
+    const char *src = vertices + first_offset;
+    const int64_t row_size = num_columns * size;
+    if (is_adjacent && layout.stride_ % size == 0 &&
+        reinterpret_cast<uintptr_t>(src) % size == 0) {
+        return core::Tensor({num_vertices, num_columns},
+                            {layout.stride_ / size, 1}, const_cast<char *>(src),
+                            dtype, blob);
+    }
+    core::Tensor tensor({num_vertices, num_columns}, dtype);
+    char *dst = static_cast<char *>(tensor.GetDataPtr());
+    if (is_adjacent) {
+        CopyStrided(src, layout.stride_, dst, row_size, row_size,
+                    num_vertices);
+        return tensor;
+    }
+    for (int64_t i = 0; i < num_columns; i++) {
+        CopyStrided(vertices + layout.properties_[ids[i]].offset_,
+                    layout.stride_, dst + i * size, row_size, size,
+                    num_vertices);
+    }
+    return tensor;
+}
+
+/// Reads the vertices of a binary little-endian PLY file with fixed-size
+/// vertex rows straight from a memory mapping of the file. Returns false if
+/// the file has to be read with rply instead.
+static bool ReadPointCloudFromBinaryPLY(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    // Vertex properties are returned as views of the mapping.
+    auto file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!file->Open(filename, true,
+                    utility::filesystem::MappedFile::AccessPattern::Normal)) {
+        return false;
+    }
+    PLYBinaryLayout layout;
+    if (!ReadBinaryPLYLayout(*file, layout)) {
+        return false;
+    }
+
+    std::unordered_map<std::string, size_t> name_to_id;
+    for (size_t i = 0; i < layout.properties_.size(); i++) {
+        if (GetDtype(layout.properties_[i].type_) != core::Undefined) {
+            name_to_id[layout.properties_[i].name_] = i;
+        }
+    }
+    // Returns the ids of the properties of a base attribute.
+    auto find_base_attribute = [&](const std::vector<std::string> &names,
+                                   std::vector<size_t> &ids) {
+        ids.clear();
+        for (const std::string &name : names) {
+            if (name_to_id.count(name) == 0) {
+                return false;
+            }
+            ids.push_back(name_to_id.at(name));
+        }
+        return true;
+    };
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            base_attributes{{"points", {"x", "y", "z"}},
+                            {"normals", {"nx", "ny", "nz"}},
+                            {"colors", {"red", "green", "blue"}}};
+    std::vector<size_t> ids;
+    for (const auto &base_attribute : base_attributes) {
+        // rply reports mixed datatypes.
+        if (find_base_attribute(base_attribute.second, ids) &&
+            (layout.properties_[ids[0]].type_ !=
+                     layout.properties_[ids[1]].type_ ||
+             layout.properties_[ids[0]].type_ !=
+                     layout.properties_[ids[2]].type_)) {
+            return false;
+        }
+    }
+    for (const PLYBinaryProperty &property : layout.properties_) {
+        if (GetDtype(property.type_) == core::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, GetDtypeString(property.type_));
+        }
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(layout.num_vertices_);
+
+    const std::shared_ptr<core::Blob> file_blob =
+            core::Tensor::FromMappedFile(
+                    file, 0, {static_cast<int64_t>(file->GetSize())},
+                    core::UInt8)
+                    .GetBlob();
+    const char *vertices = file->GetData() + layout.data_offset_;
+
+    pointcloud.Clear();
+    for (const auto &base_attribute : base_attributes) {
+        if (find_base_attribute(base_attribute.second, ids)) {
+            pointcloud.SetPointAttr(
+                    base_attribute.first,
+                    GetVertexColumns(file_blob, vertices, layout, ids));
+            for (const std::string &name : base_attribute.second) {
+                name_to_id.erase(name);
+            }
+        }
+    }
+    for (const auto &it : name_to_id) {
+        pointcloud.SetPointAttr(
+                it.first,
+                GetVertexColumns(file_blob, vertices, layout, {it.second}));
+    }
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Binary files with fixed-size vertices skip the per value callbacks.
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -334,6 +636,101 @@ static const T *GetValue(core::Tensor t_attr, int pos) {
     return t_attr.GetDataPtr<T>();
 }
 
+/// A column of a point attribute written as a vertex property.
+struct PLYWriteProperty {
+    std::string name_;
+    // Contiguous {num_points, num_columns} values.
+    core::Tensor values_;
+    int64_t column_;
+};
+
+static void AddWriteProperties(const std::vector<std::string> &names,
+                               const core::Tensor &attribute,
+                               std::vector<PLYWriteProperty> &properties) {
+    core::Tensor values = attribute.Reshape({attribute.GetLength(), -1});
+    // Like ply_write, other dtypes are stored as double.
+    if (GetDtype(GetPlyType(values.GetDtype())) != values.GetDtype()) {
+        values = values.To(core::Float64);
+    }
+    values = values.Contiguous();
+    for (size_t i = 0; i < names.size(); i++) {
+        properties.push_back({names[i], values, static_cast<int64_t>(i)});
+    }
+}
+
+/// Writes a binary little-endian PLY file. The vertices are packed in blocks
+/// and written with one fwrite per block.
+static bool WriteBinaryPLY(const std::string &filename,
+                           const std::vector<PLYWriteProperty> &properties,
+                           int64_t num_points,
+                           utility::CountingProgressReporter &reporter) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (!file) {
+        utility::LogWarning("Write PLY failed: unable to open file: {}.",
+                            filename);
+        return false;
+    }
+    std::string header_tail = fmt::format("element vertex {}\n", num_points);
+    std::vector<int64_t> offsets;
+    int64_t row_size = 0;
+    for (const PLYWriteProperty &property : properties) {
+        header_tail += fmt::format(
+                "property {} {}\n",
+                GetDtypeString(GetPlyType(property.values_.GetDtype())),
+                property.name_);
+        offsets.push_back(row_size);
+        row_size += property.values_.GetDtype().ByteSize();
+    }
+    header_tail += "end_header\n";
+    // The comment is padded so that the vertices start at a multiple of 8
+    // bytes, which lets the reader return aligned views of the mapped file.
+    std::string header =
+            "ply\nformat binary_little_endian 1.0\ncomment Created by Open3D";
+    const size_t header_size = header.size() + 1 + header_tail.size();
+    header += std::string((8 - header_size % 8) % 8, ' ') + "\n" + header_tail;
+    if (fwrite(header.data(), 1, header.size(), file) != header.size()) {
+        utility::LogWarning("Write PLY failed: unable to write header.");
+        fclose(file);
+        return false;
+    }
+
+    const int64_t block_size =
+            std::max<int64_t>(1, kPLYWriteBlockSize / row_size);
+    std::vector<char> buffer(block_size * row_size);
+    for (int64_t begin = 0; begin < num_points; begin += block_size) {
+        const int64_t end = std::min(begin + block_size, num_points);
+        for (size_t i = 0; i < properties.size();) {
+            const core::Tensor &values = properties[i].values_;
+            const int64_t size = values.GetDtype().ByteSize();
+            const int64_t stride = values.GetStride(0) * size;
+            // Copy neighboring columns of an attribute at once, e.g. x, y and
+            // z.
+            size_t next = i + 1;
+            while (next < properties.size() &&
+                   properties[next].values_.IsSame(values) &&
+                   properties[next].column_ ==
+                           properties[i].column_ +
+                                   static_cast<int64_t>(next - i)) {
+                next++;
+            }
+            const char *src = static_cast<const char *>(values.GetDataPtr()) +
+                              begin * stride + properties[i].column_ * size;
+            CopyStrided(src, stride, buffer.data() + offsets[i], row_size,
+                        (next - i) * size, end - begin);
+            i = next;
+        }
+        const size_t num_bytes = (end - begin) * row_size;
+        if (fwrite(buffer.data(), 1, num_bytes, file) != num_bytes) {
+            utility::LogWarning("Write PLY failed: unable to write data.");
+            fclose(file);
+            return false;
+        }
+        reporter.Update(end);
+    }
+    fclose(file);
+    return true;
+}
+
 bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const open3d::io::WritePointCloudOption &params) {
@@ -358,10 +755,34 @@ bool WritePointCloudToPLY(const std::string &filename,
         }
     }
 
-    p_ply ply_file =
-            ply_create(filename.c_str(),
-                       bool(params.write_ascii) ? PLY_ASCII : PLY_LITTLE_ENDIAN,
-                       NULL, 0, NULL);
+    if (!bool(params.write_ascii)) {
+        std::vector<PLYWriteProperty> properties;
+        AddWriteProperties({"x", "y", "z"}, pointcloud.GetPoints(),
+                           properties);
+        if (pointcloud.HasPointNormals()) {
+            AddWriteProperties({"nx", "ny", "nz"},
+                               pointcloud.GetPointNormals(), properties);
+        }
+        if (pointcloud.HasPointColors()) {
+            AddWriteProperties({"red", "green", "blue"},
+                               pointcloud.GetPointColors(), properties);
+        }
+        for (auto const &it : t_map) {
+            if (it.first != "points" && it.first != "colors" &&
+                it.first != "normals") {
+                AddWriteProperties({it.first}, it.second, properties);
+            }
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+        if (!WriteBinaryPLY(filename, properties, num_points, reporter)) {
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    }
+
+    p_ply ply_file = ply_create(filename.c_str(), PLY_ASCII, NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Write PLY failed: unable to open file: {}.",
                             filename);
@@ -26,7 +26,10 @@
 
 #include <png.h>
 
+#include <functional>
+
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/file_format/ImageBuffer.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -54,7 +57,8 @@ static void SetPNGImageFromImage(const geometry::Image &image,
     }
 }
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+bool ReadPNGToBuffer(const std::string &filename,
+                     const ImageBufferCallback &get_buffer) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
     pngimage.version = PNG_IMAGE_VERSION;
@@ -68,18 +72,18 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     if (pngimage.format & PNG_FORMAT_FLAG_COLORMAP) {
         pngimage.format &= ~PNG_FORMAT_FLAG_COLORMAP;
     }
-    if (pngimage.format & PNG_FORMAT_FLAG_LINEAR) {
-        image.Reset(pngimage.height, pngimage.width,
-                    PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format), core::UInt16,
-                    image.GetDevice());
-    } else {
-        image.Reset(pngimage.height, pngimage.width,
-                    PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format), core::UInt8,
-                    image.GetDevice());
+    core::Dtype dtype = (pngimage.format & PNG_FORMAT_FLAG_LINEAR)
+                                ? core::UInt16
+                                : core::UInt8;
+    void *buffer = get_buffer(pngimage.height, pngimage.width,
+                              PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
+                              dtype);
+    if (buffer == nullptr) {
+        png_image_free(&pngimage);
+        return false;
     }
 
-    if (png_image_finish_read(&pngimage, NULL, image.GetDataPtr(), 0, NULL) ==
-        0) {
+    if (png_image_finish_read(&pngimage, NULL, buffer, 0, NULL) == 0) {
         utility::LogWarning("Read PNG failed: unable to read file: {}",
                             filename);
         utility::LogWarning("PNG error: {}", pngimage.message);
@@ -88,6 +92,21 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+    core::Device device = image.GetDevice();
+    geometry::Image host_image;
+    bool success = ReadPNGToBuffer(
+            filename, [&host_image](int64_t rows, int64_t cols,
+                                    int64_t channels, core::Dtype dtype) {
+                host_image.Reset(rows, cols, channels, dtype);
+                return host_image.GetDataPtr();
+            });
+    if (success) {
+        image = host_image.To(device);
+    }
+    return success;
+}
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality) {
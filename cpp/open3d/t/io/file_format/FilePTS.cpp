@@ -24,10 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <vector>
 
+#include "open3d/io/ASCIIReader.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/ASCIIColumnTensors.h"
+#include "open3d/t/io/file_format/ColorConversion.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
@@ -45,24 +51,23 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         pointcloud.Clear();
 
         // Get num_points.
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "rb")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-
-        int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            const char *format;
-            if (std::is_same<int64_t, long>::value) {
-                format = "%ld";
-            } else {
-                format = "%lld";
-            }
-            sscanf(line_buffer, format, &num_points);
+        const char *data = file.GetData();
+        const char *data_end = data + file.GetSize();
+        const char *line = data;
+        const char *line_end = data_end;
+        if (file.GetSize() > 0) {
+            const void *newline = std::memchr(data, '\n', file.GetSize());
+            line_end = newline ? static_cast<const char *>(newline) : data_end;
         }
+        double num_points_value = 0;
+        open3d::io::ParseASCIIDouble(line, line_end, num_points_value);
+        const int64_t num_points = static_cast<int64_t>(num_points_value);
         if (num_points < 0) {
             utility::LogWarning(
                     "Read PTS failed: number of points must be >= 0.");
@@ -72,117 +77,51 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             return true;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_points);
+        reporter.SetTotal(file.GetSize());
 
         // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
-        size_t num_fields = 0;
+        const size_t start_pos = std::min(
+                static_cast<size_t>(line_end - data) + 1, file.GetSize());
 
-        if ((line_buffer = file.ReadLine())) {
-            num_fields = utility::SplitString(line_buffer, " ").size();
-
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-            } else {
-                utility::LogWarning("Read PTS failed: unknown pts format: {}",
-                                    line_buffer);
-                return false;
-            }
+        // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+        const int num_fields =
+                open3d::io::CountASCIIFields(data + start_pos, data_end);
+        if (num_fields != 7 && num_fields != 6 && num_fields != 4 &&
+            num_fields != 3) {
+            utility::LogWarning(
+                    "Read PTS failed: unknown pts format with {} fields.",
+                    num_fields);
+            return false;
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        const bool has_intensities = num_fields == 7 || num_fields == 4;
+        const bool has_colors = num_fields == 7 || num_fields == 6;
+        std::vector<int> column_sizes{3};
+        if (has_intensities) {
+            column_sizes.push_back(1);
+        }
+        if (has_colors) {
+            column_sizes.push_back(3);
+        }
+        int64_t num_lines = 0;
+        const std::vector<core::Tensor> columns =
+                ReadASCIIColumnTensors(file, start_pos, column_sizes,
+                                       num_points, reporter, &num_lines);
+        const int64_t num_rows = columns[0].GetLength();
+        if (num_lines < num_points || num_rows < num_lines) {
+            utility::LogWarning(
+                    "Read PTS failed: expected {} points with {} fields, but "
+                    "read {} valid lines out of {}.",
+                    num_points, num_fields, num_rows, num_lines);
+            return false;
+        }
 
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
-                return false;
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+        pointcloud.SetPoints(columns[0]);
+        if (has_intensities) {
+            pointcloud.SetPointAttr("intensities", columns[1]);
+        }
+        if (has_colors) {
+            pointcloud.SetPointColors(columns.back().To(core::UInt8));
         }
 
         reporter.Finish();
@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "open3d/core/Dtype.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Returns a host buffer for a decoded image of the given size. Called by the
+/// readers below once the file header has been read.
+using ImageBufferCallback = std::function<void *(
+        int64_t rows, int64_t cols, int64_t channels, core::Dtype dtype)>;
+
+/// Decodes a JPG file into the host buffer returned by \p get_buffer. With
+/// \p downscale set to 2, 4 or 8, libjpeg scales the image down while
+/// computing the inverse DCT, which skips most of the decoding work.
+bool ReadJPGToBuffer(const std::string &filename,
+                     int downscale,
+                     const ImageBufferCallback &get_buffer);
+
+/// Decodes a PNG file into the host buffer returned by \p get_buffer.
+bool ReadPNGToBuffer(const std::string &filename,
+                     const ImageBufferCallback &get_buffer);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
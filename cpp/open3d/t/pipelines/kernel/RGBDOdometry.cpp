@@ -35,12 +35,25 @@ namespace pipelines {
 namespace kernel {
 namespace odometry {
 
+/// Zero the {29} Float32 reduction buffer on \p device, allocating it only if
+/// the existing one cannot be reused.
+static void PrepareReductionBuffer(core::Tensor &A_reduction,
+                                   const core::Device &device) {
+    if (A_reduction.GetShape() != core::SizeVector{29} ||
+        A_reduction.GetDtype() != core::Float32 ||
+        A_reduction.GetDevice() != device || !A_reduction.IsContiguous()) {
+        A_reduction = core::Tensor::Empty({29}, core::Float32, device);
+    }
+    A_reduction.Fill(0);
+}
+
 void ComputeOdometryResultPointToPlane(
         const core::Tensor &source_vertex_map,
         const core::Tensor &target_vertex_map,
         const core::Tensor &target_normal_map,
         const core::Tensor &intrinsics,
         const core::Tensor &init_source_to_target,
+        core::Tensor &A_reduction,
         core::Tensor &delta,
         float &inlier_residual,
         int &inlier_count,
@@ -53,16 +66,17 @@ void ComputeOdometryResultPointToPlane(
     core::Tensor trans_d =
             init_source_to_target.To(host, core::Float64).Contiguous();
 
+    PrepareReductionBuffer(A_reduction, device);
     if (device.GetType() == core::Device::DeviceType::CPU) {
         ComputeOdometryResultPointToPlaneCPU(
                 source_vertex_map, target_vertex_map, target_normal_map,
-                intrinsics_d, trans_d, delta, inlier_residual, inlier_count,
-                depth_outlier_trunc, depth_huber_delta);
+                intrinsics_d, trans_d, A_reduction, delta, inlier_residual,
+                inlier_count, depth_outlier_trunc, depth_huber_delta);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
         CUDA_CALL(ComputeOdometryResultPointToPlaneCUDA, source_vertex_map,
                   target_vertex_map, target_normal_map, intrinsics_d, trans_d,
-                  delta, inlier_residual, inlier_count, depth_outlier_trunc,
-                  depth_huber_delta);
+                  A_reduction, delta, inlier_residual, inlier_count,
+                  depth_outlier_trunc, depth_huber_delta);
     } else {
         utility::LogError("Unimplemented device.");
     }
@@ -76,6 +90,7 @@ void ComputeOdometryResultIntensity(const core::Tensor &source_depth,
                                     const core::Tensor &source_vertex_map,
                                     const core::Tensor &intrinsics,
                                     const core::Tensor &init_source_to_target,
+                                    core::Tensor &A_reduction,
                                     core::Tensor &delta,
                                     float &inlier_residual,
                                     int &inlier_count,
@@ -87,18 +102,19 @@ void ComputeOdometryResultIntensity(const core::Tensor &source_depth,
             init_source_to_target.To(host, core::Float64).Contiguous();
 
     core::Device device = source_vertex_map.GetDevice();
+    PrepareReductionBuffer(A_reduction, device);
     if (device.GetType() == core::Device::DeviceType::CPU) {
         ComputeOdometryResultIntensityCPU(
                 source_depth, target_depth, source_intensity, target_intensity,
                 target_intensity_dx, target_intensity_dy, source_vertex_map,
-                intrinsics_d, trans_d, delta, inlier_residual, inlier_count,
-                depth_outlier_trunc, intensity_huber_delta);
+                intrinsics_d, trans_d, A_reduction, delta, inlier_residual,
+                inlier_count, depth_outlier_trunc, intensity_huber_delta);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
         CUDA_CALL(ComputeOdometryResultIntensityCUDA, source_depth,
                   target_depth, source_intensity, target_intensity,
                   target_intensity_dx, target_intensity_dy, source_vertex_map,
-                  intrinsics_d, trans_d, delta, inlier_residual, inlier_count,
-                  depth_outlier_trunc, intensity_huber_delta);
+                  intrinsics_d, trans_d, A_reduction, delta, inlier_residual,
+                  inlier_count, depth_outlier_trunc, intensity_huber_delta);
     } else {
         utility::LogError("Unimplemented device.");
     }
@@ -115,6 +131,7 @@ void ComputeOdometryResultHybrid(const core::Tensor &source_depth,
                                  const core::Tensor &source_vertex_map,
                                  const core::Tensor &intrinsics,
                                  const core::Tensor &init_source_to_target,
+                                 core::Tensor &A_reduction,
                                  core::Tensor &delta,
                                  float &inlier_residual,
                                  int &inlier_count,
@@ -127,18 +144,19 @@ void ComputeOdometryResultHybrid(const core::Tensor &source_depth,
             init_source_to_target.To(host, core::Float64).Contiguous();
 
     core::Device device = source_vertex_map.GetDevice();
+    PrepareReductionBuffer(A_reduction, device);
     if (device.GetType() == core::Device::DeviceType::CPU) {
         ComputeOdometryResultHybridCPU(
                 source_depth, target_depth, source_intensity, target_intensity,
                 target_depth_dx, target_depth_dy, target_intensity_dx,
                 target_intensity_dy, source_vertex_map, intrinsics_d, trans_d,
-                delta, inlier_residual, inlier_count, depth_outlier_trunc,
-                depth_huber_delta, intensity_huber_delta);
+                A_reduction, delta, inlier_residual, inlier_count,
+                depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
         CUDA_CALL(ComputeOdometryResultHybridCUDA, source_depth, target_depth,
                   source_intensity, target_intensity, target_depth_dx,
                   target_depth_dy, target_intensity_dx, target_intensity_dy,
-                  source_vertex_map, intrinsics_d, trans_d, delta,
+                  source_vertex_map, intrinsics_d, trans_d, A_reduction, delta,
                   inlier_residual, inlier_count, depth_outlier_trunc,
                   depth_huber_delta, intensity_huber_delta);
     } else {
@@ -34,12 +34,16 @@ namespace pipelines {
 namespace kernel {
 namespace odometry {
 
+// A_reduction is a scratch {29} Float32 buffer for the reduced linear system.
+// It is only reallocated if it does not fit the input device, so callers can
+// reuse it across iterations.
 void ComputeOdometryResultPointToPlane(
         const core::Tensor &source_vertex_map,
         const core::Tensor &target_vertex_map,
         const core::Tensor &target_normal_map,
         const core::Tensor &intrinsics,
         const core::Tensor &init_source_to_target,
+        core::Tensor &A_reduction,
         core::Tensor &delta,
         float &inlier_residual,
         int &inlier_count,
@@ -55,6 +59,7 @@ void ComputeOdometryResultIntensity(const core::Tensor &source_depth,
                                     const core::Tensor &source_vertex_map,
                                     const core::Tensor &intrinsics,
                                     const core::Tensor &init_source_to_target,
+                                    core::Tensor &A_reduction,
                                     core::Tensor &delta,
                                     float &inlier_residual,
                                     int &inlier_count,
@@ -72,6 +77,7 @@ void ComputeOdometryResultHybrid(const core::Tensor &source_depth,
                                  const core::Tensor &source_vertex_map,
                                  const core::Tensor &intrinsics,
                                  const core::Tensor &init_source_to_target,
+                                 core::Tensor &A_reduction,
                                  core::Tensor &delta,
                                  float &inlier_residual,
                                  int &inlier_count,
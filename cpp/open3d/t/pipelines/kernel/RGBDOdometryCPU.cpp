@@ -48,6 +48,7 @@ void ComputeOdometryResultPointToPlaneCPU(
         const core::Tensor& target_normal_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction_tensor,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -64,21 +65,17 @@ void ComputeOdometryResultPointToPlaneCPU(
     int64_t rows = source_vertex_indexer.GetShape(0);
     int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Device device = source_vertex_map.GetDevice();
-
     int64_t n = rows * cols;
 
-    std::vector<float> A_1x29(29, 0.0);
-
 #ifdef _MSC_VER
     std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
+    std::vector<float> A_1x29 = tbb::parallel_reduce(
             tbb::blocked_range<int>(0, n), zeros_29,
             [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
                 for (int workload_idx = r.begin(); workload_idx < r.end();
                      workload_idx++) {
 #else
-    float* A_reduction = A_1x29.data();
+    float* A_reduction = A_reduction_tensor.GetDataPtr<float>();
 #pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int workload_idx = 0; workload_idx < n; workload_idx++) {
 #endif
@@ -118,8 +115,9 @@ void ComputeOdometryResultPointToPlaneCPU(
                 }
                 return result;
             });
+    std::copy(A_1x29.begin(), A_1x29.end(),
+              A_reduction_tensor.GetDataPtr<float>());
 #endif
-    core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Float32, device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
 }
 
@@ -133,6 +131,7 @@ void ComputeOdometryResultIntensityCPU(
         const core::Tensor& source_vertex_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction_tensor,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -156,21 +155,17 @@ void ComputeOdometryResultIntensityCPU(
     int64_t rows = source_vertex_indexer.GetShape(0);
     int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Device device = source_vertex_map.GetDevice();
-
     int64_t n = rows * cols;
 
-    std::vector<float> A_1x29(29, 0.0);
-
 #ifdef _MSC_VER
     std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
+    std::vector<float> A_1x29 = tbb::parallel_reduce(
             tbb::blocked_range<int>(0, n), zeros_29,
             [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
                 for (int workload_idx = r.begin(); workload_idx < r.end();
                      workload_idx++) {
 #else
-    float* A_reduction = A_1x29.data();
+    float* A_reduction = A_reduction_tensor.GetDataPtr<float>();
 #pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int workload_idx = 0; workload_idx < n; workload_idx++) {
 #endif
@@ -214,8 +209,9 @@ void ComputeOdometryResultIntensityCPU(
                 }
                 return result;
             });
+    std::copy(A_1x29.begin(), A_1x29.end(),
+              A_reduction_tensor.GetDataPtr<float>());
 #endif
-    core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Float32, device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
 }
 
@@ -230,6 +226,7 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
                                     const core::Tensor& source_vertex_map,
                                     const core::Tensor& intrinsics,
                                     const core::Tensor& init_source_to_target,
+                                    core::Tensor& A_reduction_tensor,
                                     core::Tensor& delta,
                                     float& inlier_residual,
                                     int& inlier_count,
@@ -256,21 +253,17 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
     int64_t rows = source_vertex_indexer.GetShape(0);
     int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Device device = source_vertex_map.GetDevice();
-
     int64_t n = rows * cols;
 
-    std::vector<float> A_1x29(29, 0.0);
-
 #ifdef _MSC_VER
     std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
+    std::vector<float> A_1x29 = tbb::parallel_reduce(
             tbb::blocked_range<int>(0, n), zeros_29,
             [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
                 for (int workload_idx = r.begin(); workload_idx < r.end();
                      workload_idx++) {
 #else
-    float* A_reduction = A_1x29.data();
+    float* A_reduction = A_reduction_tensor.GetDataPtr<float>();
 #pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
     for (int workload_idx = 0; workload_idx < n; workload_idx++) {
 #endif
@@ -321,8 +314,9 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
                 }
                 return result;
             });
+    std::copy(A_1x29.begin(), A_1x29.end(),
+              A_reduction_tensor.GetDataPtr<float>());
 #endif
-    core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Float32, device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
 }
 
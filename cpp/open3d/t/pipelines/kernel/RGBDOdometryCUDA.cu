@@ -129,6 +129,7 @@ void ComputeOdometryResultPointToPlaneCUDA(
         const core::Tensor& target_normal_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -138,16 +139,13 @@ void ComputeOdometryResultPointToPlaneCUDA(
     NDArrayIndexer target_vertex_indexer(target_vertex_map, 2);
     NDArrayIndexer target_normal_indexer(target_normal_map, 2);
 
-    core::Device device = source_vertex_map.GetDevice();
-
     core::Tensor trans = init_source_to_target;
     TransformIndexer ti(intrinsics, trans);
 
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    float* global_sum_ptr = A_reduction.GetDataPtr<float>();
 
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
@@ -159,7 +157,7 @@ void ComputeOdometryResultPointToPlaneCUDA(
             ti, global_sum_ptr, rows, cols, depth_outlier_trunc,
             depth_huber_delta);
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(A_reduction, delta, inlier_residual, inlier_count);
 }
 
 __global__ void ComputeOdometryResultIntensityCUDAKernel(
@@ -230,6 +228,7 @@ void ComputeOdometryResultIntensityCUDA(
         const core::Tensor& source_vertex_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -246,15 +245,13 @@ void ComputeOdometryResultIntensityCUDA(
 
     NDArrayIndexer source_vertex_indexer(source_vertex_map, 2);
 
-    core::Device device = source_vertex_map.GetDevice();
     core::Tensor trans = init_source_to_target;
     t::geometry::kernel::TransformIndexer ti(intrinsics, trans);
 
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    float* global_sum_ptr = A_reduction.GetDataPtr<float>();
 
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
@@ -268,7 +265,7 @@ void ComputeOdometryResultIntensityCUDA(
             source_vertex_indexer, ti, global_sum_ptr, rows, cols,
             depth_outlier_trunc, intensity_huber_delta);
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(A_reduction, delta, inlier_residual, inlier_count);
 }
 
 __global__ void ComputeOdometryResultHybridCUDAKernel(
@@ -348,6 +345,7 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
                                      const core::Tensor& source_vertex_map,
                                      const core::Tensor& intrinsics,
                                      const core::Tensor& init_source_to_target,
+                                     core::Tensor& A_reduction,
                                      core::Tensor& delta,
                                      float& inlier_residual,
                                      int& inlier_count,
@@ -367,15 +365,13 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
 
     NDArrayIndexer source_vertex_indexer(source_vertex_map, 2);
 
-    core::Device device = source_vertex_map.GetDevice();
     core::Tensor trans = init_source_to_target;
     t::geometry::kernel::TransformIndexer ti(intrinsics, trans);
 
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    float* global_sum_ptr = A_reduction.GetDataPtr<float>();
 
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
@@ -390,7 +386,7 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
             source_vertex_indexer, ti, global_sum_ptr, rows, cols,
             depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(A_reduction, delta, inlier_residual, inlier_count);
 }
 
 }  // namespace odometry
@@ -41,6 +41,7 @@ void ComputeOdometryResultPointToPlaneCPU(
         const core::Tensor& source_normal_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -57,6 +58,7 @@ void ComputeOdometryResultIntensityCPU(
         const core::Tensor& source_vertex_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -74,6 +76,7 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
                                     const core::Tensor& source_vertex_map,
                                     const core::Tensor& intrinsics,
                                     const core::Tensor& init_source_to_target,
+                                    core::Tensor& A_reduction,
                                     core::Tensor& delta,
                                     float& inlier_residual,
                                     int& inlier_count,
@@ -88,6 +91,7 @@ void ComputeOdometryResultPointToPlaneCUDA(
         const core::Tensor& source_normal_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -104,6 +108,7 @@ void ComputeOdometryResultIntensityCUDA(
         const core::Tensor& source_vertex_map,
         const core::Tensor& intrinsics,
         const core::Tensor& init_source_to_target,
+        core::Tensor& A_reduction,
         core::Tensor& delta,
         float& inlier_residual,
         int& inlier_count,
@@ -121,6 +126,7 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
                                      const core::Tensor& source_vertex_map,
                                      const core::Tensor& intrinsics,
                                      const core::Tensor& init_source_to_target,
+                                     core::Tensor& A_reduction,
                                      core::Tensor& delta,
                                      float& inlier_residual,
                                      int& inlier_count,
@@ -31,6 +31,7 @@
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Tracing.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -42,147 +43,161 @@ using core::Tensor;
 using t::geometry::Image;
 using t::geometry::RGBDImage;
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
+OdometryPyramid CreateOdometryPyramid(const RGBDImage& image,
+                                      const Tensor& intrinsics,
+                                      const float depth_scale,
+                                      const float depth_max,
+                                      const int64_t n_levels,
+                                      const Method method,
+                                      const OdometryLossParams& params,
+                                      const int roles) {
+    const bool as_source = (roles & OdometryPyramid::Source) != 0;
+    const bool as_target = (roles & OdometryPyramid::Target) != 0;
+    const bool use_intensity = method != Method::PointToPlane;
+
+    OdometryPyramid pyramid;
+    pyramid.intrinsics_.resize(n_levels);
+    pyramid.vertex_map_.resize(n_levels);
+    if (method == Method::PointToPlane) {
+        pyramid.normal_map_.resize(as_target ? n_levels : 0);
+    } else {
+        pyramid.depth_.resize(n_levels);
+        pyramid.intensity_.resize(n_levels);
+        pyramid.intensity_dx_.resize(as_target ? n_levels : 0);
+        pyramid.intensity_dy_.resize(as_target ? n_levels : 0);
+        if (method == Method::Hybrid) {
+            pyramid.depth_dx_.resize(as_target ? n_levels : 0);
+            pyramid.depth_dy_.resize(as_target ? n_levels : 0);
+        }
+    }
 
-OdometryResult RGBDOdometryMultiScale(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& init_source_to_target,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const Method method,
-        const OdometryLossParams& params) {
-    // TODO (wei): more device check
-    core::Device device = source.depth_.GetDevice();
-    if (target.depth_.GetDevice() != device) {
-        utility::LogError(
-                "Device mismatch, got {} for source and {} for target.",
-                device.ToString(), target.depth_.GetDevice().ToString());
+    Image depth = image.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    Image intensity;
+    if (use_intensity) {
+        intensity = image.color_.RGBToGray().To(core::Float32);
     }
+    Tensor intrinsics_pyr = intrinsics.Clone();
 
-    // 4x4 transformations are always float64 and stay on CPU.
-    core::Device host("CPU:0");
-    Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
-    Tensor trans_d = init_source_to_target.To(host, core::Float64).Clone();
+    for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
+        pyramid.intrinsics_[level] = intrinsics_pyr.Clone();
+
+        // PointToPlane associates vertices of both images, the photometric
+        // methods only unproject the source.
+        if (!use_intensity || as_source) {
+            pyramid.vertex_map_[level] =
+                    depth.CreateVertexMap(intrinsics_pyr, NAN).AsTensor();
+        }
+        if (!use_intensity && as_target) {
+            Image depth_smooth = depth.FilterBilateral(5, 5, 10);
+            Image vertex_map_smooth =
+                    depth_smooth.CreateVertexMap(intrinsics_pyr, NAN);
+            pyramid.normal_map_[level] =
+                    vertex_map_smooth.CreateNormalMap(NAN).AsTensor();
+        }
+        if (use_intensity) {
+            pyramid.depth_[level] = depth.AsTensor();
+            pyramid.intensity_[level] = intensity.AsTensor();
+            if (as_target) {
+                auto intensity_grad = intensity.FilterSobel();
+                pyramid.intensity_dx_[level] = intensity_grad.first.AsTensor();
+                pyramid.intensity_dy_[level] = intensity_grad.second.AsTensor();
+            }
+            if (as_target && method == Method::Hybrid) {
+                auto depth_grad = depth.FilterSobel();
+                pyramid.depth_dx_[level] = depth_grad.first.AsTensor();
+                pyramid.depth_dy_[level] = depth_grad.second.AsTensor();
+            }
+        }
 
-    Image source_depth = source.depth_;
-    Image target_depth = target.depth_;
+        if (i != n_levels - 1) {
+            depth = depth.PyrDownDepth(params.depth_outlier_trunc_ * 2, NAN);
+            if (use_intensity) {
+                intensity = intensity.PyrDown();
+            }
+            intrinsics_pyr /= 2;
+            intrinsics_pyr[-1][-1] = 1;
+        }
+    }
+    return pyramid;
+}
 
-    Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
+namespace {
 
-    RGBDImage source_processed(source.color_, source_depth_processed);
-    RGBDImage target_processed(target.color_, target_depth_processed);
+OdometryResult DecodeOdometryResult(const Tensor& delta,
+                                    float inlier_residual,
+                                    int inlier_count,
+                                    const Tensor& source_vertex_map) {
+    // Check inlier_count, source_vertex_map's shape is non-zero guaranteed.
+    if (inlier_count <= 0) {
+        utility::LogError("Invalid inlier_count value {}, must be > 0.",
+                          inlier_count);
+    }
+    return OdometryResult(
+            pipelines::kernel::PoseToTransformation(delta),
+            inlier_residual / inlier_count,
+            double(inlier_count) / double(source_vertex_map.GetShape(0) *
+                                          source_vertex_map.GetShape(1)));
+}
 
+// One iteration of \p method at pyramid \p level, reducing into A_reduction.
+OdometryResult ComputeOdometryResultAtLevel(const OdometryPyramid& source,
+                                            const OdometryPyramid& target,
+                                            const int64_t level,
+                                            const Tensor& trans,
+                                            const Method method,
+                                            const OdometryLossParams& params,
+                                            Tensor& A_reduction) {
+    Tensor delta;
+    float inlier_residual;
+    int inlier_count;
     if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
+        kernel::odometry::ComputeOdometryResultPointToPlane(
+                source.vertex_map_[level], target.vertex_map_[level],
+                target.normal_map_[level], source.intrinsics_[level], trans,
+                A_reduction, delta, inlier_residual, inlier_count,
+                params.depth_outlier_trunc_, params.depth_huber_delta_);
     } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
+        kernel::odometry::ComputeOdometryResultIntensity(
+                source.depth_[level], target.depth_[level],
+                source.intensity_[level], target.intensity_[level],
+                target.intensity_dx_[level], target.intensity_dy_[level],
+                source.vertex_map_[level], source.intrinsics_[level], trans,
+                A_reduction, delta, inlier_residual, inlier_count,
+                params.depth_outlier_trunc_, params.intensity_huber_delta_);
     } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
+        kernel::odometry::ComputeOdometryResultHybrid(
+                source.depth_[level], target.depth_[level],
+                source.intensity_[level], target.intensity_[level],
+                target.depth_dx_[level], target.depth_dy_[level],
+                target.intensity_dx_[level], target.intensity_dy_[level],
+                source.vertex_map_[level], source.intrinsics_[level], trans,
+                A_reduction, delta, inlier_residual, inlier_count,
+                params.depth_outlier_trunc_, params.depth_huber_delta_,
+                params.intensity_huber_delta_);
     } else {
         utility::LogError("Odometry method not implemented.");
     }
-
-    return OdometryResult(trans_d);
+    return DecodeOdometryResult(delta, inlier_residual, inlier_count,
+                                source.vertex_map_[level]);
 }
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+OdometryResult ComputeOdometryResultMultiScale(
+        const OdometryPyramid& source,
+        const OdometryPyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
-    std::vector<Tensor> target_vertex_maps(n_levels);
-    std::vector<Tensor> target_normal_maps(n_levels);
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-
-        Image target_depth_curr_smooth =
-                target_depth_curr.FilterBilateral(5, 5, 10);
-        Image target_vertex_map_smooth =
-                target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
+        const Method method,
+        const OdometryLossParams& params,
+        Tensor& A_reduction) {
+    const int64_t n_levels = int64_t(criteria.size());
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultPointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_);
+            OPEN3D_TRACE_SCOPE("pipelines", "OdometryIteration");
+            auto delta_result = ComputeOdometryResultAtLevel(
+                    source, target, i, result.transformation_, method, params,
+                    A_reduction);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
@@ -206,205 +221,121 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
     return result;
 }
 
-OdometryResult RGBDOdometryMultiScaleIntensity(
+}  // namespace
+
+OdometryResult RGBDOdometryMultiScale(
         const RGBDImage& source,
         const RGBDImage& target,
         const Tensor& intrinsics,
-        const Tensor& trans,
+        const Tensor& init_source_to_target,
         const float depth_scale,
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+    // TODO (wei): more device check
+    core::Device device = source.depth_.GetDevice();
+    if (target.depth_.GetDevice() != device) {
+        utility::LogError(
+                "Device mismatch, got {} for source and {} for target.",
+                device.ToString(), target.depth_.GetDevice().ToString());
     }
 
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
-                    params.depth_outlier_trunc_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
+    // 4x4 transformations are always float64 and stay on CPU.
+    Tensor intrinsics_d =
+            intrinsics.To(core::Device("CPU:0"), core::Float64).Clone();
+
+    const int64_t n_levels = int64_t(criteria.size());
+    OdometryPyramid source_pyramid = CreateOdometryPyramid(
+            source, intrinsics_d, depth_scale, depth_max, n_levels, method,
+            params, OdometryPyramid::Source);
+    OdometryPyramid target_pyramid = CreateOdometryPyramid(
+            target, intrinsics_d, depth_scale, depth_max, n_levels, method,
+            params, OdometryPyramid::Target);
+    return RGBDOdometryMultiScale(source_pyramid, target_pyramid,
+                                  init_source_to_target, criteria, method,
+                                  params);
+}
 
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryPyramid& source,
+        const OdometryPyramid& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
+        const OdometryLossParams& params) {
+    const size_t n_levels = criteria.size();
+    if (source.vertex_map_.size() != n_levels ||
+        target.intrinsics_.size() != n_levels) {
+        utility::LogError(
+                "Expected pyramids of {} levels, got {} for source and {} for "
+                "target.",
+                n_levels, source.vertex_map_.size(),
+                target.intrinsics_.size());
+    }
+    core::Device device = source.vertex_map_.back().GetDevice();
+    core::Device target_device = method == Method::PointToPlane
+                                         ? target.vertex_map_.back().GetDevice()
+                                         : target.depth_.back().GetDevice();
+    if (target_device != device) {
+        utility::LogError(
+                "Device mismatch, got {} for source and {} for target.",
+                device.ToString(), target_device.ToString());
     }
 
-    return result;
+    Tensor trans_d = init_source_to_target.To(core::Device("CPU:0"),
+                                              core::Float64)
+                             .Clone();
+    Tensor A_reduction;
+    return ComputeOdometryResultMultiScale(source, target, trans_d, criteria,
+                                           method, params, A_reduction);
 }
 
-OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
+RGBDOdometryContext::RGBDOdometryContext(
         const Tensor& intrinsics,
-        const Tensor& trans,
         const float depth_scale,
         const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+        const std::vector<OdometryConvergenceCriteria>& criteria_list,
+        const Method method,
+        const OdometryLossParams& params)
+    : intrinsics_(intrinsics.To(core::Device("CPU:0"), core::Float64).Clone()),
+      depth_scale_(depth_scale),
+      depth_max_(depth_max),
+      criteria_(criteria_list),
+      method_(method),
+      params_(params) {}
+
+void RGBDOdometryContext::SetSource(const RGBDImage& source) {
+    source_ = CreateOdometryPyramid(source, intrinsics_, depth_scale_,
+                                    depth_max_, int64_t(criteria_.size()),
+                                    method_, params_, OdometryPyramid::Source);
+    has_source_ = true;
+}
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+OdometryResult RGBDOdometryContext::Compute(
+        const RGBDImage& target, const Tensor& init_source_to_target) {
+    if (!has_source_) {
+        utility::LogError("No source image, call SetSource first.");
     }
-
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
+    core::Device device = source_.vertex_map_.back().GetDevice();
+    if (target.depth_.GetDevice() != device) {
+        utility::LogError(
+                "Device mismatch, got {} for source and {} for target.",
+                device.ToString(), target.depth_.GetDevice().ToString());
     }
 
+    // The target is the next source, so build the maps of both roles.
+    OdometryPyramid target_pyramid = CreateOdometryPyramid(
+            target, intrinsics_, depth_scale_, depth_max_,
+            int64_t(criteria_.size()), method_, params_,
+            OdometryPyramid::Source | OdometryPyramid::Target);
+    Tensor trans_d = init_source_to_target.To(core::Device("CPU:0"),
+                                              core::Float64)
+                             .Clone();
+    OdometryResult result = ComputeOdometryResultMultiScale(
+            source_, target_pyramid, trans_d, criteria_, method_, params_,
+            A_reduction_);
+    source_ = std::move(target_pyramid);
     return result;
 }
 
@@ -417,23 +348,16 @@ OdometryResult ComputeOdometryResultPointToPlane(
         const float depth_outlier_trunc,
         const float depth_huber_delta) {
     // Delta target_to_source on host.
+    Tensor A_reduction;
     Tensor se3_delta;
     float inlier_residual;
     int inlier_count;
     kernel::odometry::ComputeOdometryResultPointToPlane(
             source_vertex_map, target_vertex_map, target_normal_map, intrinsics,
-            init_source_to_target, se3_delta, inlier_residual, inlier_count,
-            depth_outlier_trunc, depth_huber_delta);
-    // Check inlier_count, source_vertex_map's shape is non-zero guaranteed.
-    if (inlier_count <= 0) {
-        utility::LogError("Invalid inlier_count value {}, must be > 0.",
-                          inlier_count);
-    }
-    return OdometryResult(
-            pipelines::kernel::PoseToTransformation(se3_delta),
-            inlier_residual / inlier_count,
-            double(inlier_count) / double(source_vertex_map.GetShape(0) *
-                                          source_vertex_map.GetShape(1)));
+            init_source_to_target, A_reduction, se3_delta, inlier_residual,
+            inlier_count, depth_outlier_trunc, depth_huber_delta);
+    return DecodeOdometryResult(se3_delta, inlier_residual, inlier_count,
+                                source_vertex_map);
 }
 
 OdometryResult ComputeOdometryResultIntensity(
@@ -449,24 +373,18 @@ OdometryResult ComputeOdometryResultIntensity(
         const float depth_outlier_trunc,
         const float intensity_huber_delta) {
     // Delta target_to_source on host.
+    Tensor A_reduction;
     Tensor se3_delta;
     float inlier_residual;
     int inlier_count;
     kernel::odometry::ComputeOdometryResultIntensity(
             source_depth, target_depth, source_intensity, target_intensity,
             target_intensity_dx, target_intensity_dy, source_vertex_map,
-            intrinsics, init_source_to_target, se3_delta, inlier_residual,
-            inlier_count, depth_outlier_trunc, intensity_huber_delta);
-    // Check inlier_count, source_vertex_map's shape is non-zero guaranteed.
-    if (inlier_count <= 0) {
-        utility::LogError("Invalid inlier_count value {}, must be > 0.",
-                          inlier_count);
-    }
-    return OdometryResult(
-            pipelines::kernel::PoseToTransformation(se3_delta),
-            inlier_residual / inlier_count,
-            double(inlier_count) / double(source_vertex_map.GetShape(0) *
-                                          source_vertex_map.GetShape(1)));
+            intrinsics, init_source_to_target, A_reduction, se3_delta,
+            inlier_residual, inlier_count, depth_outlier_trunc,
+            intensity_huber_delta);
+    return DecodeOdometryResult(se3_delta, inlier_residual, inlier_count,
+                                source_vertex_map);
 }
 
 OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
@@ -484,6 +402,7 @@ OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
                                            const float depth_huber_delta,
                                            const float intensity_huber_delta) {
     // Delta target_to_source on host.
+    Tensor A_reduction;
     Tensor se3_delta;
     float inlier_residual;
     int inlier_count;
@@ -491,18 +410,11 @@ OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
             source_depth, target_depth, source_intensity, target_intensity,
             target_depth_dx, target_depth_dy, target_intensity_dx,
             target_intensity_dy, source_vertex_map, intrinsics,
-            init_source_to_target, se3_delta, inlier_residual, inlier_count,
-            depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
-    // Check inlier_count, source_vertex_map's shape is non-zero guaranteed.
-    if (inlier_count <= 0) {
-        utility::LogError("Invalid inlier_count value {}, must be > 0.",
-                          inlier_count);
-    }
-    return OdometryResult(
-            pipelines::kernel::PoseToTransformation(se3_delta),
-            inlier_residual / inlier_count,
-            double(inlier_count) / double(source_vertex_map.GetShape(0) *
-                                          source_vertex_map.GetShape(1)));
+            init_source_to_target, A_reduction, se3_delta, inlier_residual,
+            inlier_count, depth_outlier_trunc, depth_huber_delta,
+            intensity_huber_delta);
+    return DecodeOdometryResult(se3_delta, inlier_residual, inlier_count,
+                                source_vertex_map);
 }
 
 }  // namespace odometry
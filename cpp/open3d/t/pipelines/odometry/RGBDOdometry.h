@@ -174,6 +174,143 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Image pyramid of one RGBD image holding the maps used by RGBD
+/// odometry. Every member holds one tensor per level, ordered from coarse to
+/// fine like the convergence criteria. Maps that the odometry method does not
+/// use are left empty.
+class OdometryPyramid {
+public:
+    /// Roles an image plays in odometry, selecting the maps to build.
+    enum Role { Source = (1 << 0), Target = (1 << 1) };
+
+    /// (3, 3) Float64 intrinsic matrices on CPU.
+    std::vector<core::Tensor> intrinsics_;
+    /// Depth in meters after clipping, invalid pixels set to NAN.
+    std::vector<core::Tensor> depth_;
+    std::vector<core::Tensor> vertex_map_;
+    /// Normal maps of the bilaterally filtered depth, used by PointToPlane.
+    std::vector<core::Tensor> normal_map_;
+    /// Float32 intensity and gradients, used by Intensity and Hybrid.
+    std::vector<core::Tensor> intensity_;
+    std::vector<core::Tensor> intensity_dx_;
+    std::vector<core::Tensor> intensity_dy_;
+    /// Depth gradients, used by Hybrid.
+    std::vector<core::Tensor> depth_dx_;
+    std::vector<core::Tensor> depth_dy_;
+};
+
+/// \brief Build the pyramid of \p image used by RGBD odometry.
+/// \param image RGBD image. Color is only read by the Intensity and Hybrid
+/// methods.
+/// \param intrinsics (3, 3) Float64 intrinsic matrix on CPU at the finest
+/// level.
+/// \param depth_scale Converts depth pixel values to meters by dividing the
+/// scale factor.
+/// \param depth_max Max depth to truncate depth image with noisy measurements.
+/// \param n_levels Number of pyramid levels.
+/// \param method Method the pyramid is used with.
+/// \param params Parameters used in loss function. The depth outlier
+/// threshold also bounds pyramid down sampling.
+/// \param roles Bitwise or of OdometryPyramid::Role values.
+/// \return pyramid with the maps of \p method for \p roles.
+OdometryPyramid CreateOdometryPyramid(const t::geometry::RGBDImage& image,
+                                      const core::Tensor& intrinsics,
+                                      const float depth_scale,
+                                      const float depth_max,
+                                      const int64_t n_levels,
+                                      const Method method,
+                                      const OdometryLossParams& params,
+                                      const int roles);
+
+/// \brief Multi-scale RGBD odometry between pyramids built by
+/// CreateOdometryPyramid, e.g. when the source pyramid is computed ahead of
+/// time. Same as RGBDOdometryMultiScale on the images the pyramids were built
+/// from.
+/// \param source Pyramid built with OdometryPyramid::Source.
+/// \param target Pyramid built with OdometryPyramid::Target, on the same
+/// device as \p source.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria per pyramid level, from coarse to fine. Its
+/// size must match the number of levels of the pyramids.
+/// \param method Method the pyramids were built for.
+/// \param params Parameters used in loss function.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryPyramid& source,
+        const OdometryPyramid& target,
+        const core::Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria_list,
+        const Method method,
+        const OdometryLossParams& params = OdometryLossParams());
+
+/// \class RGBDOdometryContext
+///
+/// \brief Frame-to-frame RGBD odometry that reuses work across calls.
+///
+/// RGBDOdometryMultiScale builds the pyramids of both images on every call,
+/// so in a sequence every frame's pyramid is built twice. The context builds
+/// each frame's pyramid once: after Compute(target), the pyramid of
+/// \p target is kept and used as the source of the next call. The buffer for
+/// the linear system reduction is also reused across iterations and calls.
+/// Results are the same as RGBDOdometryMultiScale with the same arguments.
+class RGBDOdometryContext {
+public:
+    /// \param intrinsics (3, 3) intrinsic matrix for projection.
+    /// \param depth_scale Converts depth pixel values to meters by dividing
+    /// the scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param criteria_list Criteria per pyramid level, from coarse to fine.
+    /// \param method Method used to apply RGBD odometry.
+    /// \param params Parameters used in loss function.
+    RGBDOdometryContext(
+            const core::Tensor& intrinsics,
+            const float depth_scale = 1000.0f,
+            const float depth_max = 3.0f,
+            const std::vector<OdometryConvergenceCriteria>& criteria_list =
+                    {10, 5, 3},
+            const Method method = Method::Hybrid,
+            const OdometryLossParams& params = OdometryLossParams());
+
+    /// Set the source image of the next Compute call.
+    void SetSource(const t::geometry::RGBDImage& source);
+
+    /// Returns true if a source is available for Compute.
+    bool HasSource() const { return has_source_; }
+
+    /// Drop the cached source pyramid.
+    void Reset() {
+        source_ = OdometryPyramid();
+        has_source_ = false;
+    }
+
+    /// \brief Estimate the transformation from the current source to
+    /// \p target, as RGBDOdometryMultiScale does. Afterwards \p target is
+    /// the source of the next call.
+    /// \param target Target RGBD image, on the same device as the source.
+    /// \param init_source_to_target (4, 4) initial transformation matrix from
+    /// source to target of core::Float64 on CPU.
+    OdometryResult Compute(const t::geometry::RGBDImage& target,
+                           const core::Tensor& init_source_to_target =
+                                   core::Tensor::Eye(4,
+                                                     core::Float64,
+                                                     core::Device("CPU:0")));
+
+private:
+    core::Tensor intrinsics_;
+    float depth_scale_;
+    float depth_max_;
+    std::vector<OdometryConvergenceCriteria> criteria_;
+    Method method_;
+    OdometryLossParams params_;
+
+    OdometryPyramid source_;
+    bool has_source_ = false;
+    core::Tensor A_reduction_;
+};
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
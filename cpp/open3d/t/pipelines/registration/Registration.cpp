@@ -31,6 +31,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -228,6 +229,7 @@ static RegistrationResult DoSingleScaleIterationsICP(
         const core::Dtype &dtype) {
     RegistrationResult result;
     for (int j = 0; j < criteria.max_iteration_; j++) {
+        OPEN3D_TRACE_SCOPE("pipelines", "ICPIteration");
         result = GetRegistrationResultAndCorrespondences(
                 source.GetPoints(), target_nns, max_correspondence_distance,
                 transformation);
@@ -280,6 +282,7 @@ RegistrationResult RegistrationMultiScaleICP(
     core::Dtype dtype = source.GetPoints().GetDtype();
     int64_t num_iterations = int64_t(criterias.size());
 
+    OPEN3D_TRACE_SCOPE("pipelines", "RegistrationMultiScaleICP");
     AssertInputMultiScaleICP(source, target, voxel_sizes, criterias,
                              max_correspondence_distances,
                              init_source_to_target, estimation, num_iterations,
@@ -32,6 +32,7 @@
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Prefetcher.h"
 
 namespace open3d {
 namespace t {
@@ -52,6 +53,49 @@ static PointCloud CreateTPCDFromFile(
     return PointCloud::FromLegacyPointCloud(*pcd, core::Float32, device);
 }
 
+// Loads the point cloud pairs of the given pose graph edges in background
+// threads, in the order of edge_ids, so that reading the next pair overlaps
+// with processing the current one.
+static std::unique_ptr<utility::Prefetcher<std::pair<PointCloud, PointCloud>>>
+PrefetchPointCloudPairs(const std::vector<std::string>& fnames,
+                        const PoseGraph& pose_graph,
+                        const std::vector<size_t>& edge_ids,
+                        const core::Device& device) {
+    std::vector<std::pair<int, int>> node_ids;
+    for (size_t edge_id : edge_ids) {
+        const auto& edge = pose_graph.edges_[edge_id];
+        node_ids.emplace_back(edge.source_node_id_, edge.target_node_id_);
+    }
+    auto loader = [&fnames, node_ids, device](int64_t k) {
+        return std::make_pair(
+                CreateTPCDFromFile(fnames[node_ids[k].first], device),
+                CreateTPCDFromFile(fnames[node_ids[k].second], device));
+    };
+    return std::make_unique<
+            utility::Prefetcher<std::pair<PointCloud, PointCloud>>>(
+            static_cast<int64_t>(edge_ids.size()), loader, /*num_workers=*/2,
+            /*queue_size=*/2);
+}
+
+// Returns the ids of the edges whose correspondences have been saved.
+static std::vector<size_t> GetEdgesWithCorrespondences(
+        const PoseGraph& pose_graph, const SLACOptimizerParams& params) {
+    std::vector<size_t> edge_ids;
+    for (size_t k = 0; k < pose_graph.edges_.size(); ++k) {
+        int i = pose_graph.edges_[k].source_node_id_;
+        int j = pose_graph.edges_[k].target_node_id_;
+
+        std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
+                                               params.GetSubfolderName(), i, j);
+        if (!utility::filesystem::FileExists(corres_fname)) {
+            utility::LogWarning("Correspondence {} {} skipped!", i, j);
+            continue;
+        }
+        edge_ids.push_back(k);
+    }
+    return edge_ids;
+}
+
 static void FillInRigidAlignmentTerm(Tensor& AtA,
                                      Tensor& Atb,
                                      Tensor& residual,
@@ -80,19 +124,21 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     core::Device device(params.device_);
 
     // Enumerate pose graph edges
-    for (auto& edge : pose_graph.edges_) {
+    std::vector<size_t> edge_ids =
+            GetEdgesWithCorrespondences(pose_graph, params);
+    auto pcd_pairs =
+            PrefetchPointCloudPairs(fnames, pose_graph, edge_ids, device);
+    for (size_t edge_id : edge_ids) {
+        const auto& edge = pose_graph.edges_[edge_id];
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
         std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
                                                params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
-            utility::LogWarning("Correspondence {} {} skipped!", i, j);
-            continue;
-        }
         Tensor corres_ij = Tensor::Load(corres_fname).To(device);
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        std::pair<PointCloud, PointCloud> pcd_pair = pcd_pairs->Next();
+        PointCloud& tpcd_i = pcd_pair.first;
+        PointCloud& tpcd_j = pcd_pair.second;
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPoints().IndexGet({corres_ij.T()[0]}));
@@ -179,20 +225,22 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     int n_frags = pose_graph.nodes_.size();
 
     // Enumerate pose graph edges.
-    for (auto& edge : pose_graph.edges_) {
+    std::vector<size_t> edge_ids =
+            GetEdgesWithCorrespondences(pose_graph, params);
+    auto pcd_pairs =
+            PrefetchPointCloudPairs(fnames, pose_graph, edge_ids, device);
+    for (size_t edge_id : edge_ids) {
+        const auto& edge = pose_graph.edges_[edge_id];
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
         std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
                                                params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
-            utility::LogWarning("Correspondence {} {} skipped!", i, j);
-            continue;
-        }
         Tensor corres_ij = Tensor::Load(corres_fname).To(device);
 
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        std::pair<PointCloud, PointCloud> pcd_pair = pcd_pairs->Next();
+        PointCloud& tpcd_i = pcd_pair.first;
+        PointCloud& tpcd_j = pcd_pair.second;
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPoints().IndexGet({corres_ij.T()[0]}));
@@ -31,6 +31,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Prefetcher.h"
 
 namespace open3d {
 namespace t {
@@ -49,15 +50,28 @@ static std::vector<std::string> PreprocessPointClouds(
     }
 
     std::vector<std::string> fnames_processed;
+    std::vector<size_t> ids_to_process;
 
-    for (auto& fname : fnames) {
+    for (size_t k = 0; k < fnames.size(); ++k) {
         std::string fname_processed = fmt::format(
                 "{}/{}", subdir_name,
-                utility::filesystem::GetFileNameWithoutDirectory(fname));
+                utility::filesystem::GetFileNameWithoutDirectory(fnames[k]));
         fnames_processed.emplace_back(fname_processed);
         if (utility::filesystem::FileExists(fname_processed)) continue;
+        ids_to_process.push_back(k);
+    }
 
-        auto pcd = io::CreatePointCloudFromFile(fname);
+    // Read the next fragments while the current one is being processed.
+    utility::Prefetcher<std::shared_ptr<open3d::geometry::PointCloud>> pcds(
+            static_cast<int64_t>(ids_to_process.size()),
+            [&fnames, &ids_to_process](int64_t k) {
+                return io::CreatePointCloudFromFile(
+                        fnames[ids_to_process[k]]);
+            });
+    for (size_t k : ids_to_process) {
+        const std::string& fname_processed = fnames_processed[k];
+
+        auto pcd = pcds.Next();
         if (pcd == nullptr) {
             utility::LogError("Internal error: pcd is nullptr.");
         }
@@ -228,8 +242,21 @@ void SaveCorrespondencesForPointClouds(
         const PoseGraph& pose_graph,
         const SLACOptimizerParams& params,
         const SLACDebugOption& debug_option) {
-    // Enumerate pose graph edges.
-    for (auto& edge : pose_graph.edges_) {
+    // Enumerate pose graph edges whose correspondences are not saved yet.
+    std::vector<size_t> edge_ids;
+    for (size_t k = 0; k < pose_graph.edges_.size(); ++k) {
+        std::string correspondences_fname = fmt::format(
+                "{}/{:03d}_{:03d}.npy", params.GetSubfolderName(),
+                pose_graph.edges_[k].source_node_id_,
+                pose_graph.edges_[k].target_node_id_);
+        if (utility::filesystem::FileExists(correspondences_fname)) continue;
+        edge_ids.push_back(k);
+    }
+
+    auto pcd_pairs = PrefetchPointCloudPairs(fnames_processed, pose_graph,
+                                             edge_ids, params.device_);
+    for (size_t edge_id : edge_ids) {
+        const auto& edge = pose_graph.edges_[edge_id];
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
@@ -237,12 +264,10 @@ void SaveCorrespondencesForPointClouds(
 
         std::string correspondences_fname = fmt::format(
                 "{}/{:03d}_{:03d}.npy", params.GetSubfolderName(), i, j);
-        if (utility::filesystem::FileExists(correspondences_fname)) continue;
 
-        PointCloud tpcd_i =
-                CreateTPCDFromFile(fnames_processed[i], params.device_);
-        PointCloud tpcd_j =
-                CreateTPCDFromFile(fnames_processed[j], params.device_);
+        std::pair<PointCloud, PointCloud> pcd_pair = pcd_pairs->Next();
+        PointCloud& tpcd_i = pcd_pair.first;
+        PointCloud& tpcd_j = pcd_pair.second;
 
         // pose of i in model frame.
         core::Tensor T_i = core::eigen_converter::EigenMatrixToTensor(
@@ -271,10 +296,15 @@ void SaveCorrespondencesForPointClouds(
 static void InitializeControlGrid(ControlGrid& ctr_grid,
                                   const std::vector<std::string>& fnames) {
     core::Device device(ctr_grid.GetDevice());
+    utility::Prefetcher<PointCloud> tpcds(
+            static_cast<int64_t>(fnames.size()),
+            [&fnames, &device](int64_t k) {
+                return CreateTPCDFromFile(fnames[k], device);
+            });
     for (auto& fname : fnames) {
         utility::LogInfo("Initializing grid for {}", fname);
 
-        auto tpcd = CreateTPCDFromFile(fname, device);
+        auto tpcd = tpcds.Next();
         ctr_grid.Touch(tpcd);
     }
     utility::LogInfo("Initialization finished.");
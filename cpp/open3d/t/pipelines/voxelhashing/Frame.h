@@ -60,6 +60,19 @@ public:
     void SetData(const std::string& name, const core::Tensor& data) {
         data_[name] = data.To(device_);
     }
+    /// Copy \p data into the existing buffer of \p name if it has the same
+    /// shape and dtype, so that a reused frame does not reallocate its maps
+    /// on the device. Otherwise behaves like SetData. Tensors previously
+    /// returned by GetData(name) share the buffer and see the new values.
+    void UpdateData(const std::string& name, const core::Tensor& data) {
+        auto it = data_.find(name);
+        if (it != data_.end() && it->second.GetShape() == data.GetShape() &&
+            it->second.GetDtype() == data.GetDtype()) {
+            it->second.CopyFrom(data);
+        } else {
+            SetData(name, data);
+        }
+    }
     core::Tensor GetData(const std::string& name) const {
         if (data_.count(name) == 0) {
             utility::LogError("Property not found for {}!", name);
@@ -75,6 +88,10 @@ public:
     t::geometry::Image GetDataAsImage(const std::string& name) const {
         return t::geometry::Image(GetData(name));
     }
+    void UpdateDataFromImage(const std::string& name,
+                             const t::geometry::Image& data) {
+        UpdateData(name, data.AsTensor());
+    }
 
 private:
     int height_;
@@ -39,6 +39,12 @@ namespace t {
 namespace pipelines {
 namespace voxelhashing {
 
+namespace {
+// Iterations per pyramid level for frame-to-model tracking, coarse to fine.
+const std::vector<odometry::OdometryConvergenceCriteria> kTrackingCriteria{
+        6, 3, 1};
+}  // namespace
+
 Model::Model(float voxel_size,
              float sdf_trunc,
              int block_resolution,
@@ -92,11 +98,63 @@ odometry::OdometryResult Model::TrackFrameToModel(const Frame& input_frame,
             t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
                                    raycast_frame.GetDataAsImage("depth")),
             raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
-            std::vector<odometry::OdometryConvergenceCriteria>{6, 3, 1},
-            odometry::Method::PointToPlane,
+            kTrackingCriteria, odometry::Method::PointToPlane,
             odometry::OdometryLossParams(depth_diff));
 }
 
+void Model::PreprocessInputFrame(Frame& input_frame,
+                                 float depth_scale,
+                                 float depth_max,
+                                 float depth_diff) const {
+    const int64_t n_levels = int64_t(kTrackingCriteria.size());
+    odometry::OdometryPyramid pyramid = odometry::CreateOdometryPyramid(
+            t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
+                                   input_frame.GetDataAsImage("depth")),
+            input_frame.GetIntrinsics().To(core::Device("CPU:0"),
+                                           core::Float64),
+            depth_scale, depth_max, n_levels, odometry::Method::PointToPlane,
+            odometry::OdometryLossParams(depth_diff),
+            odometry::OdometryPyramid::Source);
+    // The pyramid is ordered from coarse to fine. Copy into the buffers the
+    // frame already holds, so pooled frames keep their maps.
+    for (int64_t i = 0; i < n_levels; ++i) {
+        input_frame.UpdateData("vertex_map_" + std::to_string(i),
+                               pyramid.vertex_map_[n_levels - 1 - i]);
+    }
+}
+
+odometry::OdometryResult Model::TrackPreprocessedFrameToModel(
+        const Frame& input_frame,
+        const Frame& raycast_frame,
+        float depth_scale,
+        float depth_max,
+        float depth_diff) {
+    const int64_t n_levels = int64_t(kTrackingCriteria.size());
+    const odometry::OdometryLossParams params(depth_diff);
+
+    odometry::OdometryPyramid target = odometry::CreateOdometryPyramid(
+            t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
+                                   raycast_frame.GetDataAsImage("depth")),
+            raycast_frame.GetIntrinsics().To(core::Device("CPU:0"),
+                                             core::Float64),
+            depth_scale, depth_max, n_levels, odometry::Method::PointToPlane,
+            params, odometry::OdometryPyramid::Target);
+
+    // Both frames share the camera, as in TrackFrameToModel.
+    odometry::OdometryPyramid source;
+    source.intrinsics_ = target.intrinsics_;
+    source.vertex_map_.resize(n_levels);
+    for (int64_t i = 0; i < n_levels; ++i) {
+        source.vertex_map_[n_levels - 1 - i] =
+                input_frame.GetData("vertex_map_" + std::to_string(i));
+    }
+
+    return odometry::RGBDOdometryMultiScale(
+            source, target,
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            kTrackingCriteria, odometry::Method::PointToPlane, params);
+}
+
 void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max) {
@@ -89,6 +89,31 @@ public:
                                                float depth_max,
                                                float depth_diff);
 
+    /// Precompute the input side of the tracking pyramid. The depth of
+    /// \p input_frame is clipped and converted to meters, and the vertex map
+    /// of each pyramid level is stored in the frame as "vertex_map_<level>",
+    /// where level 0 is the finest. Only the input frame is accessed, so this
+    /// may run concurrently with tracking and integration of another frame.
+    /// \param input_frame Input RGBD frame.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    /// \param depth_diff Depth difference threshold used for pyramid down
+    /// sampling and association, as in TrackFrameToModel.
+    void PreprocessInputFrame(Frame& input_frame,
+                              float depth_scale,
+                              float depth_max,
+                              float depth_diff) const;
+
+    /// Same as TrackFrameToModel, but reuses the vertex maps computed by
+    /// PreprocessInputFrame instead of rebuilding the input pyramid.
+    odometry::OdometryResult TrackPreprocessedFrameToModel(
+            const Frame& input_frame,
+            const Frame& raycast_frame,
+            float depth_scale,
+            float depth_max,
+            float depth_diff);
+
     /// Integrate RGBD frame into the volumetric voxel grid.
     /// \param input_frame Input RGBD frame.
     /// \param depth_scale Scale factor to convert raw data into meter metric.
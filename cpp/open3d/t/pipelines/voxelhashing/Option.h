@@ -49,6 +49,13 @@ struct Option {
     float depth_scale = 1000.0f;
     float depth_max = 3.0f;
     float depth_diff = 0.07f;
+
+    /// Tracking options. A frame whose tracking fitness is below
+    /// min_tracking_fitness or whose translation from the previous frame
+    /// exceeds max_tracking_translation (in meters) keeps the previous pose
+    /// and is not integrated.
+    float min_tracking_fitness = 0.1f;
+    float max_tracking_translation = 0.15f;
 };
 
 }  // namespace voxelhashing
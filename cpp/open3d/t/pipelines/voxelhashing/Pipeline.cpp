@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/voxelhashing/Pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Prefetcher.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+void StageStatistics::Add(double ms) {
+    min_ms_ = count_ > 0 ? std::min(min_ms_, ms) : ms;
+    max_ms_ = count_ > 0 ? std::max(max_ms_, ms) : ms;
+    total_ms_ += ms;
+    ++count_;
+}
+
+Pipeline::Pipeline(Model& model,
+                   const core::Tensor& intrinsics,
+                   const Option& option,
+                   int num_workers,
+                   int64_t queue_size)
+    : model_(model),
+      intrinsics_(intrinsics),
+      option_(option),
+      num_workers_(num_workers),
+      queue_size_(queue_size) {
+    if (queue_size_ <= 0) {
+        utility::LogError("queue_size must be positive, but got {}.",
+                          queue_size_);
+    }
+    // The consumer holds one frame while up to queue_size frames are loaded
+    // ahead, so this many frames are enough for the loaders never to
+    // overwrite a frame in use.
+    input_frames_.resize(queue_size_ + 1);
+}
+
+void Pipeline::Run(const std::vector<std::string>& depth_filenames,
+                   const std::vector<std::string>& color_filenames) {
+    if (depth_filenames.size() != color_filenames.size()) {
+        utility::LogError(
+                "Numbers of depth ({}) and color ({}) images mismatch.",
+                depth_filenames.size(), color_filenames.size());
+    }
+    const core::Device device = model_.voxel_grid_.GetDevice();
+    const int64_t num_frames = int64_t(depth_filenames.size());
+
+    // Loads frame i into its input frame and returns the input frame index.
+    auto load_frame = [&](int64_t i) -> int64_t {
+        utility::Timer timer;
+        timer.Start();
+        t::geometry::Image depth, color;
+        if (!t::io::ReadImage(depth_filenames[i], depth) ||
+            !t::io::ReadImage(color_filenames[i], color)) {
+            utility::LogError("Unable to read frame {}.", i);
+        }
+        const int64_t slot = i % int64_t(input_frames_.size());
+        std::unique_ptr<Frame>& frame = input_frames_[slot];
+        if (!frame || frame->GetHeight() != depth.GetRows() ||
+            frame->GetWidth() != depth.GetCols()) {
+            frame.reset(new Frame(depth.GetRows(), depth.GetCols(),
+                                  intrinsics_, device));
+        }
+        frame->UpdateDataFromImage("depth", depth);
+        frame->UpdateDataFromImage("color", color);
+        timer.Stop();
+        AddStatistics("load", timer.GetDuration());
+
+        timer.Start();
+        model_.PreprocessInputFrame(*frame, option_.depth_scale,
+                                    option_.depth_max, option_.depth_diff);
+        timer.Stop();
+        AddStatistics("preprocess", timer.GetDuration());
+        return slot;
+    };
+    utility::Prefetcher<int64_t> frames(num_frames, load_frame, num_workers_,
+                                        queue_size_);
+
+    core::Tensor T_frame_to_model = model_.GetCurrentFramePose();
+    for (int64_t i = 0; i < num_frames; ++i) {
+        utility::Timer frame_timer, timer;
+        frame_timer.Start();
+
+        timer.Start();
+        const Frame& input_frame = *input_frames_[frames.Next()];
+        timer.Stop();
+        AddStatistics("wait", timer.GetDuration());
+
+        const int frame_id = model_.frame_id_ + 1;
+        bool tracking_success = true;
+        if (!raycast_frame_ ||
+            raycast_frame_->GetHeight() != input_frame.GetHeight() ||
+            raycast_frame_->GetWidth() != input_frame.GetWidth()) {
+            raycast_frame_.reset(new Frame(input_frame.GetHeight(),
+                                           input_frame.GetWidth(), intrinsics_,
+                                           device));
+        } else {
+            timer.Start();
+            auto result = model_.TrackPreprocessedFrameToModel(
+                    input_frame, *raycast_frame_, option_.depth_scale,
+                    option_.depth_max, option_.depth_diff);
+            timer.Stop();
+            AddStatistics("track", timer.GetDuration());
+
+            core::Tensor translation =
+                    result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
+            double translation_norm = std::sqrt(
+                    (translation * translation).Sum({0, 1}).Item<double>());
+            if (result.fitness_ >= option_.min_tracking_fitness &&
+                translation_norm < option_.max_tracking_translation) {
+                T_frame_to_model =
+                        T_frame_to_model.Matmul(result.transformation_);
+            } else {
+                tracking_success = false;
+                utility::LogWarning(
+                        "Tracking failed for frame {}, fitness: {:.3f}, "
+                        "translation: {:.3f}. Using previous frame's pose.",
+                        frame_id, result.fitness_, translation_norm);
+            }
+        }
+
+        model_.UpdateFramePose(frame_id, T_frame_to_model);
+        if (tracking_success) {
+            timer.Start();
+            model_.Integrate(input_frame, option_.depth_scale,
+                             option_.depth_max);
+            timer.Stop();
+            AddStatistics("integrate", timer.GetDuration());
+        }
+
+        timer.Start();
+        model_.SynthesizeModelFrame(*raycast_frame_, option_.depth_scale, 0.1,
+                                    option_.depth_max);
+        timer.Stop();
+        AddStatistics("raycast", timer.GetDuration());
+
+        trajectory_.push_back(T_frame_to_model.Clone());
+        frame_timer.Stop();
+        AddStatistics("frame", frame_timer.GetDuration());
+    }
+}
+
+std::map<std::string, StageStatistics> Pipeline::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    return statistics_;
+}
+
+void Pipeline::LogStatistics() const {
+    for (const auto& kv : GetStatistics()) {
+        const StageStatistics& stats = kv.second;
+        utility::LogInfo(
+                "{:>10}: {} calls, mean {:.2f} ms, min {:.2f} ms, max {:.2f} "
+                "ms",
+                kv.first, stats.count_, stats.GetMean(), stats.min_ms_,
+                stats.max_ms_);
+    }
+}
+
+void Pipeline::AddStatistics(const std::string& stage, double ms) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[stage].Add(ms);
+}
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/voxelhashing/Frame.h"
+#include "open3d/t/pipelines/voxelhashing/Model.h"
+#include "open3d/t/pipelines/voxelhashing/Option.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+/// Latency statistics of one pipeline stage, in milliseconds.
+struct StageStatistics {
+    void Add(double ms);
+    double GetMean() const { return count_ > 0 ? total_ms_ / count_ : 0.0; }
+
+    int64_t count_ = 0;
+    double total_ms_ = 0.0;
+    double min_ms_ = 0.0;
+    double max_ms_ = 0.0;
+};
+
+/// \class Pipeline
+///
+/// \brief Frame-to-model reconstruction driver that overlaps loading and
+/// preprocessing of upcoming frames with tracking and integration of the
+/// current frame.
+///
+/// Worker threads decode the depth and color images of frame k + 1, upload
+/// them and compute the input tracking pyramid (Model::PreprocessInputFrame)
+/// while the calling thread tracks frame k against the model, integrates it
+/// and ray casts the model frame for frame k + 1. Input frames come from a
+/// fixed pool whose buffers are reused, so at most queue_size frames are
+/// loaded ahead of the one being processed.
+///
+/// Statistics are collected for the stages "load" (decode and upload),
+/// "preprocess", "wait" (time the calling thread is blocked on the next
+/// frame), "track", "integrate", "raycast" and "frame" (the whole iteration
+/// on the calling thread).
+class Pipeline {
+public:
+    /// \param model Model to track against and integrate into. Tracking
+    /// starts from the model's current frame pose.
+    /// \param intrinsics (3, 3) intrinsic matrix of the input camera.
+    /// \param option Depth and tracking options.
+    /// \param num_workers Number of loading threads. 0 loads each frame on the
+    /// calling thread, which disables the overlap.
+    /// \param queue_size Maximum number of frames loaded ahead.
+    Pipeline(Model& model,
+             const core::Tensor& intrinsics,
+             const Option& option = Option(),
+             int num_workers = 1,
+             int64_t queue_size = 2);
+
+    /// Reconstruct from a sequence of depth and color images of the same
+    /// length. May be called multiple times to continue the sequence.
+    void Run(const std::vector<std::string>& depth_filenames,
+             const std::vector<std::string>& color_filenames);
+
+    /// Frame-to-world poses of all frames processed so far.
+    const std::vector<core::Tensor>& GetTrajectory() const {
+        return trajectory_;
+    }
+
+    /// Per-stage latency statistics of all frames processed so far.
+    std::map<std::string, StageStatistics> GetStatistics() const;
+
+    /// Log the per-stage latency statistics.
+    void LogStatistics() const;
+
+private:
+    void AddStatistics(const std::string& stage, double ms);
+
+    Model& model_;
+    core::Tensor intrinsics_;
+    Option option_;
+    int num_workers_;
+    int64_t queue_size_;
+
+    /// Input frames reused across iterations, allocated on first use.
+    std::vector<std::unique_ptr<Frame>> input_frames_;
+    std::unique_ptr<Frame> raycast_frame_;
+
+    std::vector<core::Tensor> trajectory_;
+
+    mutable std::mutex statistics_mutex_;
+    std::map<std::string, StageStatistics> statistics_;
+};
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
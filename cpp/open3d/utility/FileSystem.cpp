@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -562,6 +563,123 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename,
+                      bool copy_on_write,
+                      AccessPattern access_pattern) {
+    Close();
+    copy_on_write_ = copy_on_write;
+#ifdef _WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_ = fmt::format("CreateFileW failed with error {}",
+                             GetLastError());
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        error_ = fmt::format("GetFileSizeEx failed with error {}",
+                             GetLastError());
+        CloseHandle(file);
+        return false;
+    }
+    file_handle_ = file;
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        return true;
+    }
+    HANDLE mapping = CreateFileMappingW(
+            file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0,
+            nullptr);
+    if (!mapping) {
+        error_ = fmt::format("CreateFileMappingW failed with error {}",
+                             GetLastError());
+        Close();
+        return false;
+    }
+    mapping_handle_ = mapping;
+    data_ = static_cast<char *>(MapViewOfFile(
+            mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        error_ = fmt::format("MapViewOfFile failed with error {}",
+                             GetLastError());
+        Close();
+        return false;
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_ = GetIOErrorString(errno);
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        error_ = GetIOErrorString(errno);
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    if (size_ > 0) {
+        const int protection =
+                copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void *data = mmap(nullptr, size_, protection, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            error_ = GetIOErrorString(errno);
+            size_ = 0;
+            close(fd);
+            return false;
+        }
+        switch (access_pattern) {
+            case AccessPattern::Normal:
+                madvise(data, size_, MADV_NORMAL);
+                break;
+            case AccessPattern::Sequential:
+                madvise(data, size_, MADV_SEQUENTIAL);
+                break;
+            case AccessPattern::Random:
+                madvise(data, size_, MADV_RANDOM);
+                break;
+        }
+        data_ = static_cast<char *>(data);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+#endif
+    return true;
+}
+
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+#else
+    if (data_) {
+        munmap(data_, size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
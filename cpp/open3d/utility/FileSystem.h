@@ -147,6 +147,71 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// \class MappedFile
+///
+/// \brief Memory mapping of a whole file.
+///
+/// The mapping is released when the object is destroyed. Empty files are
+/// opened successfully with a null data pointer.
+///
+/// A copy-on-write mapping can be written to. Written pages become private to
+/// the process and are never stored back to the file.
+class MappedFile {
+public:
+    /// Expected order in which the mapped pages are accessed, passed to the
+    /// kernel as a hint. Ignored on Windows.
+    enum class AccessPattern {
+        /// Default read-ahead, e.g. for tensors that are accessed later.
+        Normal,
+        /// Aggressive read-ahead for files parsed from front to back.
+        Sequential,
+        /// No read-ahead, for sparse accesses such as gathers.
+        Random,
+    };
+
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file into memory.
+    ///
+    /// \param filename Path to the file.
+    /// \param copy_on_write If true, the mapped pages are writable, see
+    /// GetWritableData().
+    /// \param access_pattern Expected access pattern of the mapped pages.
+    bool Open(const std::string &filename,
+              bool copy_on_write = false,
+              AccessPattern access_pattern = AccessPattern::Sequential);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError() const { return error_; }
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns the first byte of the mapped file.
+    const char *GetData() const { return data_; }
+
+    /// Returns the first byte of a copy-on-write mapping, or nullptr if the
+    /// file is mapped read-only.
+    char *GetWritableData() { return copy_on_write_ ? data_ : nullptr; }
+
+    /// Returns the file size in bytes.
+    size_t GetSize() const { return size_; }
+
+private:
+    char *data_ = nullptr;
+    size_t size_ = 0;
+    bool copy_on_write_ = false;
+    std::string error_;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
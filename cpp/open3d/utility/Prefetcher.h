@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+/// \class Prefetcher
+///
+/// \brief Loads a sequence of items in background threads and hands them out
+/// in order.
+///
+/// Items 0, 1, ..., num_items - 1 are produced by calling \p loader from
+/// \p num_workers worker threads. At most \p queue_size items ahead of the
+/// consumer are loaded at any time, which bounds the memory held by
+/// prefetched items. Next() blocks until the next item in order is ready. If
+/// \p loader throws, the exception is rethrown from the Next() call that
+/// would have returned the item.
+///
+/// With \p num_workers == 0 no threads are started and Next() calls
+/// \p loader on the calling thread.
+template <typename T>
+class Prefetcher {
+public:
+    Prefetcher(int64_t num_items,
+               std::function<T(int64_t)> loader,
+               int num_workers = 2,
+               int64_t queue_size = 4)
+        : num_items_(num_items),
+          loader_(std::move(loader)),
+          queue_size_(queue_size) {
+        if (num_items_ < 0) {
+            utility::LogError("num_items must be non-negative, but got {}.",
+                              num_items_);
+        }
+        if (queue_size_ <= 0) {
+            utility::LogError("queue_size must be positive, but got {}.",
+                              queue_size_);
+        }
+        int64_t num_threads = std::min<int64_t>(num_workers, num_items_);
+        for (int64_t i = 0; i < num_threads; ++i) {
+            workers_.emplace_back(&Prefetcher::WorkerLoop, this);
+        }
+    }
+
+    Prefetcher(const Prefetcher &) = delete;
+    Prefetcher &operator=(const Prefetcher &) = delete;
+
+    ~Prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        load_cv_.notify_all();
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /// Returns true if Next() has items left to return.
+    bool HasNext() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_to_consume_ < num_items_;
+    }
+
+    /// Returns the next item in order, blocking until it is loaded.
+    T Next() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (next_to_consume_ >= num_items_) {
+            utility::LogError("All {} items have been consumed.", num_items_);
+        }
+        int64_t index = next_to_consume_++;
+        if (workers_.empty()) {
+            lock.unlock();
+            return loader_(index);
+        }
+        ready_cv_.wait(lock, [&]() {
+            return ready_.count(index) > 0 || errors_.count(index) > 0;
+        });
+        auto error_it = errors_.find(index);
+        if (error_it != errors_.end()) {
+            std::exception_ptr error = error_it->second;
+            errors_.erase(error_it);
+            lock.unlock();
+            load_cv_.notify_all();
+            std::rethrow_exception(error);
+        }
+        auto it = ready_.find(index);
+        T item = std::move(it->second);
+        ready_.erase(it);
+        lock.unlock();
+        load_cv_.notify_all();
+        return item;
+    }
+
+    int64_t GetNumItems() const { return num_items_; }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            int64_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                load_cv_.wait(lock, [&]() {
+                    return stop_ || next_to_load_ >= num_items_ ||
+                           next_to_load_ < next_to_consume_ + queue_size_;
+                });
+                if (stop_ || next_to_load_ >= num_items_) {
+                    return;
+                }
+                index = next_to_load_++;
+            }
+            try {
+                T item = loader_(index);
+                std::lock_guard<std::mutex> lock(mutex_);
+                ready_.emplace(index, std::move(item));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                errors_.emplace(index, std::current_exception());
+            }
+            ready_cv_.notify_all();
+        }
+    }
+
+    const int64_t num_items_;
+    std::function<T(int64_t)> loader_;
+    const int64_t queue_size_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable load_cv_;
+    std::condition_variable ready_cv_;
+    int64_t next_to_load_ = 0;
+    int64_t next_to_consume_ = 0;
+    bool stop_ = false;
+    std::map<int64_t, T> ready_;
+    std::map<int64_t, std::exception_ptr> errors_;
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace utility
+}  // namespace open3d
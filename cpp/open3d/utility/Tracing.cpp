@@ -0,0 +1,293 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Events recorded by one thread. The mutex is only contended while events
+/// are read or cleared.
+struct ThreadBuffer {
+    std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+};
+
+int GetThreadId() {
+    static std::atomic<int> next_thread_id(0);
+    thread_local int thread_id = next_thread_id++;
+    return thread_id;
+}
+
+std::string EscapeJsonString(const char* str) {
+    std::string escaped;
+    for (const char* c = str; *c != '\0'; ++c) {
+        switch (*c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+struct Tracer::Impl {
+    std::chrono::steady_clock::time_point epoch_;
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::function<void(const std::string&)> device_synchronizer_;
+
+    ThreadBuffer* GetThreadBuffer() {
+        // Buffers are owned by the Tracer as well, so that events of finished
+        // threads stay available.
+        thread_local std::shared_ptr<ThreadBuffer> buffer;
+        if (!buffer) {
+            buffer = std::make_shared<ThreadBuffer>();
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers_.push_back(buffer);
+        }
+        return buffer.get();
+    }
+};
+
+Tracer& Tracer::GetInstance() {
+    static Tracer instance;
+    return instance;
+}
+
+Tracer::Tracer() : enabled_(false), impl_(new Tracer::Impl()) {
+    impl_->epoch_ = std::chrono::steady_clock::now();
+}
+
+Tracer::~Tracer() {}
+
+std::function<void(const std::string& device)> Tracer::SetDeviceSynchronizer(
+        std::function<void(const std::string& device)> synchronizer) {
+    std::swap(impl_->device_synchronizer_, synchronizer);
+    return synchronizer;
+}
+
+void Tracer::SynchronizeDevice(const std::string& device) const {
+    if (impl_->device_synchronizer_) {
+        impl_->device_synchronizer_(device);
+    }
+}
+
+void Tracer::Enable() { enabled_.store(true, std::memory_order_relaxed); }
+
+void Tracer::Disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+void Tracer::Clear() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    for (auto& buffer : impl_->buffers_) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+        buffer->events_.clear();
+    }
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() const {
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        for (auto& buffer : impl_->buffers_) {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+            events.insert(events.end(), buffer->events_.begin(),
+                          buffer->events_.end());
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const TraceEvent& a, const TraceEvent& b) {
+                         return a.start_us_ < b.start_us_;
+                     });
+    return events;
+}
+
+std::vector<TraceStatistics> Tracer::GetStatistics() const {
+    std::map<std::pair<std::string, std::string>, TraceStatistics> stats_map;
+    for (const TraceEvent& event : GetEvents()) {
+        TraceStatistics& stats = stats_map[{event.category_, event.name_}];
+        const double ms = event.duration_us_ / 1000.0;
+        if (stats.count_ == 0) {
+            stats.category_ = event.category_;
+            stats.name_ = event.name_;
+            stats.min_ms_ = ms;
+            stats.max_ms_ = ms;
+        } else {
+            stats.min_ms_ = std::min(stats.min_ms_, ms);
+            stats.max_ms_ = std::max(stats.max_ms_, ms);
+        }
+        stats.count_++;
+        stats.total_ms_ += ms;
+        stats.bytes_ += std::max<int64_t>(event.bytes_, 0);
+        stats.num_elements_ += std::max<int64_t>(event.num_elements_, 0);
+    }
+
+    std::vector<TraceStatistics> stats;
+    for (auto& kv : stats_map) {
+        stats.push_back(kv.second);
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const TraceStatistics& a, const TraceStatistics& b) {
+                  return a.total_ms_ > b.total_ms_;
+              });
+    return stats;
+}
+
+std::string Tracer::GetStatisticsString() const {
+    std::string str = fmt::format(
+            "{:<40} {:>8} {:>12} {:>10} {:>10} {:>10} {:>12}\n", "Scope",
+            "Count", "Total (ms)", "Mean (ms)", "Min (ms)", "Max (ms)", "GB/s");
+    for (const TraceStatistics& stats : GetStatistics()) {
+        std::string gb_per_s = "-";
+        if (stats.bytes_ > 0 && stats.total_ms_ > 0) {
+            gb_per_s = fmt::format("{:.3f}",
+                                   stats.bytes_ / (stats.total_ms_ * 1e6));
+        }
+        str += fmt::format(
+                "{:<40} {:>8} {:>12.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>12}\n",
+                stats.category_ + "::" + stats.name_, stats.count_,
+                stats.total_ms_, stats.MeanMs(), stats.min_ms_, stats.max_ms_,
+                gb_per_s);
+    }
+    return str;
+}
+
+bool Tracer::WriteChromeTrace(const std::string& filename) const {
+    FILE* file = filesystem::FOpen(filename, "w");
+    if (file == nullptr) {
+        LogWarning("Write Chrome trace failed: unable to open file: {}",
+                   filename);
+        return false;
+    }
+    fmt::print(file, "{{\"traceEvents\":[");
+    bool first = true;
+    for (const TraceEvent& event : GetEvents()) {
+        fmt::print(file,
+                   "{}\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\","
+                   "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{},"
+                   "\"args\":{{",
+                   first ? "" : ",", EscapeJsonString(event.name_),
+                   EscapeJsonString(event.category_), event.start_us_,
+                   event.duration_us_, event.thread_id_);
+        std::string args;
+        if (!event.device_.empty()) {
+            args += fmt::format("\"device\":\"{}\"",
+                                EscapeJsonString(event.device_.c_str()));
+        }
+        if (event.bytes_ >= 0) {
+            args += fmt::format("{}\"bytes\":{}", args.empty() ? "" : ",",
+                                event.bytes_);
+        }
+        if (event.num_elements_ >= 0) {
+            args += fmt::format("{}\"elements\":{}", args.empty() ? "" : ",",
+                                event.num_elements_);
+        }
+        fmt::print(file, "{}}}}}", args);
+        first = false;
+    }
+    fmt::print(file, "\n],\"displayTimeUnit\":\"ms\"}}\n");
+    bool success = !ferror(file);
+    fclose(file);
+    if (!success) {
+        LogWarning("Write Chrome trace failed: unable to write file: {}",
+                   filename);
+    }
+    return success;
+}
+
+double Tracer::GetTimeInMicroseconds() const {
+    return std::chrono::duration<double, std::micro>(
+                   std::chrono::steady_clock::now() - impl_->epoch_)
+            .count();
+}
+
+void Tracer::Record(TraceEvent&& event) {
+    ThreadBuffer* buffer = impl_->GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer->mutex_);
+    buffer->events_.push_back(std::move(event));
+}
+
+TraceScope::TraceScope(const char* category, const char* name)
+    : active_(Tracer::GetInstance().IsEnabled()) {
+    if (active_) {
+        event_.category_ = category;
+        event_.name_ = name;
+        event_.thread_id_ = GetThreadId();
+        event_.bytes_ = -1;
+        event_.num_elements_ = -1;
+        event_.start_us_ = Tracer::GetInstance().GetTimeInMicroseconds();
+    }
+}
+
+TraceScope::~TraceScope() {
+    if (active_) {
+        Tracer& tracer = Tracer::GetInstance();
+        if (!event_.device_.empty()) {
+            tracer.SynchronizeDevice(event_.device_);
+        }
+        event_.duration_us_ = tracer.GetTimeInMicroseconds() - event_.start_us_;
+        tracer.Record(std::move(event_));
+    }
+}
+
+void TraceScope::SetDetails(const std::string& device,
+                            int64_t bytes,
+                            int64_t num_elements) {
+    event_.device_ = device;
+    event_.bytes_ = bytes;
+    event_.num_elements_ = num_elements;
+    if (!device.empty()) {
+        // Exclude work queued before this scope.
+        Tracer& tracer = Tracer::GetInstance();
+        tracer.SynchronizeDevice(device);
+        event_.start_us_ = tracer.GetTimeInMicroseconds();
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
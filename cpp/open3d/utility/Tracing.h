@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \brief A completed trace scope.
+struct TraceEvent {
+    /// Category of the scope, e.g. "core" or "pipelines".
+    const char* category_;
+    /// Name of the scope. Category and name must outlive the Tracer; string
+    /// literals are used throughout Open3D.
+    const char* name_;
+    /// Device the scope ran on, or empty if not recorded.
+    std::string device_;
+    /// Start time in microseconds since the Tracer was created.
+    double start_us_;
+    /// Duration in microseconds.
+    double duration_us_;
+    /// Sequential id of the thread that recorded the scope.
+    int thread_id_;
+    /// Number of bytes processed, or -1 if not recorded.
+    int64_t bytes_;
+    /// Number of elements processed, or -1 if not recorded.
+    int64_t num_elements_;
+};
+
+/// \brief Aggregate statistics of all events with the same category and name.
+struct TraceStatistics {
+    std::string category_;
+    std::string name_;
+    int64_t count_ = 0;
+    double total_ms_ = 0;
+    double min_ms_ = 0;
+    double max_ms_ = 0;
+    /// Sum of recorded bytes and elements. Events without them are skipped.
+    int64_t bytes_ = 0;
+    int64_t num_elements_ = 0;
+
+    double MeanMs() const { return count_ > 0 ? total_ms_ / count_ : 0; }
+};
+
+/// \brief Global recorder of named trace scopes.
+///
+/// Recording is disabled by default and is switched on at runtime with
+/// Enable(). Open3D's own instrumentation (core kernels, hashmap, NNS and
+/// pipeline stages) is compiled in with the BUILD_TRACING CMake option; when
+/// it is off, the OPEN3D_TRACE_* macros expand to nothing. While recording is
+/// disabled, a scope costs one relaxed atomic load.
+///
+/// Each thread appends to its own buffer, so recording from OpenMP or TBB
+/// workers does not contend on a global lock. Events can be exported in the
+/// Chrome trace event format (chrome://tracing, Perfetto) or aggregated per
+/// scope name.
+class Tracer {
+public:
+    static Tracer& GetInstance();
+
+    ~Tracer();
+    Tracer(const Tracer&) = delete;
+    void operator=(const Tracer&) = delete;
+
+    /// Starts recording trace scopes.
+    void Enable();
+
+    /// Stops recording. Already recorded events are kept.
+    void Disable();
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Removes all recorded events.
+    void Clear();
+
+    /// Returns all recorded events, sorted by start time.
+    std::vector<TraceEvent> GetEvents() const;
+
+    /// Returns per-scope statistics, sorted by total time in descending order.
+    std::vector<TraceStatistics> GetStatistics() const;
+
+    /// Returns GetStatistics() formatted as a table.
+    std::string GetStatisticsString() const;
+
+    /// Writes all recorded events to \p filename as Chrome trace JSON.
+    /// Returns false if the file cannot be written.
+    bool WriteChromeTrace(const std::string& filename) const;
+
+    /// Returns the current time in microseconds since the Tracer was created.
+    double GetTimeInMicroseconds() const;
+
+    /// Appends a completed event to the buffer of the calling thread.
+    void Record(TraceEvent&& event);
+
+    /// Sets the function that waits until the work queued by the calling
+    /// thread on a device has finished, e.g. by synchronizing the current CUDA
+    /// stream. Core registers it for CUDA devices. Must be set before
+    /// recording starts. Returns the previous synchronizer.
+    std::function<void(const std::string& device)> SetDeviceSynchronizer(
+            std::function<void(const std::string& device)> synchronizer);
+
+    /// Calls the device synchronizer for \p device, if one is set.
+    void SynchronizeDevice(const std::string& device) const;
+
+private:
+    Tracer();
+
+    std::atomic<bool> enabled_;
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \brief RAII trace scope, recorded when it goes out of scope.
+///
+/// The scope is only recorded if the Tracer was enabled at construction.
+/// Prefer the OPEN3D_TRACE_SCOPE macros, which compile out without
+/// BUILD_TRACING.
+///
+/// Kernels on CUDA devices are launched asynchronously. A scope with a device
+/// therefore synchronizes the device when SetDetails() is called and again
+/// when the scope ends, so that its duration covers the execution of the
+/// queued kernels rather than the launch overhead. This serializes the device
+/// work while tracing is enabled.
+class TraceScope {
+public:
+    TraceScope(const char* category, const char* name);
+    ~TraceScope();
+    TraceScope(const TraceScope&) = delete;
+    void operator=(const TraceScope&) = delete;
+
+    /// True if this scope will be recorded.
+    bool IsActive() const { return active_; }
+
+    /// Attaches the device and the amount of processed data to the scope.
+    /// Pass -1 for unknown sizes.
+    void SetDetails(const std::string& device,
+                    int64_t bytes,
+                    int64_t num_elements);
+
+private:
+    bool active_;
+    TraceEvent event_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+#define OPEN3D_TRACE_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_TRACE_CONCAT(a, b) OPEN3D_TRACE_CONCAT_IMPL(a, b)
+#define OPEN3D_TRACE_VAR OPEN3D_TRACE_CONCAT(open3d_trace_scope_, __LINE__)
+
+#ifdef BUILD_TRACING
+/// Records the enclosing block as a trace scope.
+#define OPEN3D_TRACE_SCOPE(category, name) \
+    ::open3d::utility::TraceScope OPEN3D_TRACE_VAR(category, name)
+
+/// Records the enclosing block as a trace scope with device, bytes and element
+/// count. The detail arguments are only evaluated while tracing is enabled.
+#define OPEN3D_TRACE_SCOPE_DETAILED(category, name, device, bytes,         \
+                                    num_elements)                          \
+    OPEN3D_TRACE_SCOPE(category, name);                                    \
+    if (OPEN3D_TRACE_VAR.IsActive()) {                                     \
+        OPEN3D_TRACE_VAR.SetDetails(device, bytes, num_elements);          \
+    }                                                                      \
+    static_assert(true, "")
+#else
+#define OPEN3D_TRACE_SCOPE(category, name) static_assert(true, "")
+#define OPEN3D_TRACE_SCOPE_DETAILED(category, name, device, bytes, \
+                                    num_elements)                  \
+    static_assert(true, "")
+#endif
@@ -346,6 +346,15 @@ void pybind_trianglemesh(py::module &m) {
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
                     "pcd"_a, "radii"_a)
+            .def_static(
+                    "create_from_point_cloud_ball_pivoting_parallel",
+                    &TriangleMesh::CreateFromPointCloudBallPivotingParallel,
+                    "Parallel variant of "
+                    "create_from_point_cloud_ball_pivoting. The point cloud "
+                    "is split into slabs along the longest axis of its "
+                    "bounding box that are reconstructed concurrently and "
+                    "stitched afterwards.",
+                    "pcd"_a, "radii"_a, "n_partitions"_a = -1)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -676,6 +685,17 @@ void pybind_trianglemesh(py::module &m) {
              {"radii",
               "The radii of the ball that are used for the surface "
               "reconstruction."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_ball_pivoting_parallel",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"radii",
+              "The radii of the ball that are used for the surface "
+              "reconstruction."},
+             {"n_partitions",
+              "Number of spatial partitions that are reconstructed "
+              "concurrently. Set to -1 to use one partition per thread."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
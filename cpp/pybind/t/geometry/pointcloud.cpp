@@ -127,6 +127,50 @@ void pybind_pointcloud(py::module& m) {
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask,
+                   "boolean_mask"_a, "invert"_a = false,
+                   "Select points and their attributes by a boolean mask.");
+    pointcloud.def("remove_radius_outliers",
+                   &PointCloud::RemoveRadiusOutliers, "nb_points"_a,
+                   "search_radius"_a,
+                   "Remove points that have less than nb_points neighbors in "
+                   "a sphere of a given radius. Returns the filtered point "
+                   "cloud and a boolean mask of the kept points.");
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers, "nb_neighbors"_a,
+                   "std_ratio"_a,
+                   "Remove points that are further away from their neighbors "
+                   "in average. Returns the filtered point cloud and a boolean "
+                   "mask of the kept points.");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN, "eps"_a,
+                   "min_points"_a,
+                   "Cluster PointCloud using the DBSCAN algorithm Ester et "
+                   "al., 'A Density-Based Algorithm for Discovering Clusters "
+                   "in Large Spatial Databases with Noise', 1996. Returns an "
+                   "Int32 tensor of point labels, -1 indicates noise according "
+                   "to the algorithm.");
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   "distance_threshold"_a = 0.01, "num_iterations"_a = 100,
+                   "seed"_a = -1,
+                   "Segments a plane in the point cloud using batched RANSAC. "
+                   "Returns the plane model ax + by + cz + d = 0 and a boolean "
+                   "inlier mask. Set seed to -1 to use a random seed with each "
+                   "call.");
+    pointcloud.def("segment_sphere", &PointCloud::SegmentSphere,
+                   "distance_threshold"_a = 0.01, "num_iterations"_a = 1000,
+                   "seed"_a = -1,
+                   "Segments a sphere in the point cloud using batched RANSAC. "
+                   "Returns the sphere model (cx, cy, cz, radius) and a "
+                   "boolean inlier mask. Set seed to -1 to use a random seed "
+                   "with each call.");
+    pointcloud.def("segment_cylinder", &PointCloud::SegmentCylinder,
+                   "distance_threshold"_a = 0.01, "num_iterations"_a = 1000,
+                   "seed"_a = -1,
+                   "Segments a cylinder in the point cloud using batched "
+                   "RANSAC. Requires point normals. Returns the cylinder model "
+                   "(point on the axis, axis direction, radius) and a boolean "
+                   "inlier mask. Set seed to -1 to use a random seed with each "
+                   "call.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
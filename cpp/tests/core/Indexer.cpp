@@ -172,5 +172,72 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor points({4, 3}, core::Float32, device);
+    core::Tensor other({4, 3}, core::Float32, device);
+    core::Tensor center({3}, core::Float32, device);
+    core::Tensor output({4, 3}, core::Float32, device);
+    core::Tensor homogeneous({4, 4}, core::Float32, device);
+
+    EXPECT_TRUE(core::Indexer({points, other}, output).IsContiguous());
+    EXPECT_FALSE(core::Indexer({points, center}, output).IsContiguous());
+    EXPECT_FALSE(core::Indexer({homogeneous.Slice(1, 0, 3), other}, output)
+                         .IsContiguous());
+    EXPECT_FALSE(core::Indexer({points.T()}, output.T()).IsContiguous());
+
+    // Different dtypes are contiguous with their own element sizes.
+    core::Tensor output_bool({4, 3}, core::Bool, device);
+    EXPECT_TRUE(core::Indexer({points, other}, output_bool,
+                              core::DtypePolicy::INPUT_SAME_OUTPUT_BOOL)
+                        .IsContiguous());
+
+    // The reduced output is not contiguous in the input's shape.
+    core::Tensor reduced({1, 3}, core::Float32, device);
+    EXPECT_FALSE(core::Indexer({points}, reduced, core::DtypePolicy::ALL_SAME,
+                               {0})
+                         .IsContiguous());
+}
+
+TEST_P(IndexerPermuteDevices, GetPointersNDims) {
+    core::Device device = GetParam();
+
+    core::Tensor homogeneous({5, 4}, core::Float32, device);
+    core::Tensor cube({2, 3, 4, 5}, core::Float32, device);
+    std::vector<std::pair<core::Tensor, core::Tensor>> cases = {
+            // Broadcasting, 2 dims.
+            {core::Tensor({5, 3}, core::Float32, device),
+             core::Tensor({3}, core::Float32, device)},
+            // Strided columns, 2 dims.
+            {homogeneous.Slice(1, 0, 3),
+             core::Tensor({5, 3}, core::Float32, device)},
+            // Permuted, 3 dims.
+            {core::Tensor({4, 3, 5}, core::Float32, device).Permute({1, 0, 2}),
+             core::Tensor({3, 4, 5}, core::Float32, device)},
+            // Permuted, 4 dims, dispatched to DYNAMIC_DIMS.
+            {cube.Permute({3, 2, 1, 0}),
+             core::Tensor({5, 4, 3, 2}, core::Float32, device)},
+    };
+
+    std::vector<int64_t> ndims;
+    for (const auto& lhs_rhs : cases) {
+        core::Tensor output(lhs_rhs.first.GetShape(), core::Float32, device);
+        core::Indexer indexer({lhs_rhs.first, lhs_rhs.second}, output);
+        ndims.push_back(indexer.NumDims());
+        DISPATCH_NDIMS_TO_TEMPLATE(indexer.NumDims(), [&]() {
+            for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+                EXPECT_EQ(indexer.GetInputPtr<kNDims>(0, i),
+                          indexer.GetInputPtr(0, i));
+                EXPECT_EQ(indexer.GetInputPtr<kNDims>(1, i),
+                          indexer.GetInputPtr(1, i));
+                EXPECT_EQ(indexer.GetOutputPtr<kNDims>(i),
+                          indexer.GetOutputPtr(i));
+            }
+        });
+    }
+    EXPECT_EQ(ndims, std::vector<int64_t>({2, 2, 3, 4}));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -33,6 +35,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/Batched.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
@@ -515,5 +518,232 @@ TEST_P(LinalgPermuteDevices, KernelOps) {
     EXPECT_TRUE(output3x1.AllClose(Solve_Expected));
 }
 
+static core::Tensor RandomMatrices(const core::SizeVector& shape,
+                                   core::Dtype dtype,
+                                   const core::Device& device,
+                                   int seed) {
+    std::vector<double> values(shape.NumElements());
+    Rand(values, -1.0, 1.0, seed);
+    return core::Tensor(values, shape, core::Float64, device).To(dtype);
+}
+
+TEST_P(LinalgPermuteDevices, BatchedMatmul) {
+    core::Device device = GetParam();
+
+    // Small kernel sizes and the per-matrix fallback for n > 8.
+    for (const auto& mkn : std::vector<std::array<int64_t, 3>>{
+                 {3, 3, 3}, {3, 3, 1}, {6, 1, 6}, {2, 5, 4}, {9, 10, 2}}) {
+        int64_t m = mkn[0], k = mkn[1], n = mkn[2];
+        core::Tensor A = RandomMatrices({2, 3, m, k}, core::Float32, device,
+                                        static_cast<int>(m * k));
+        core::Tensor B = RandomMatrices({2, 3, k, n}, core::Float32, device,
+                                        static_cast<int>(k * n + 1));
+        core::Tensor C;
+        core::BatchedMatmul(A, B, C);
+        EXPECT_EQ(C.GetShape(), core::SizeVector({2, 3, m, n}));
+        for (int64_t i = 0; i < 2; ++i) {
+            for (int64_t j = 0; j < 3; ++j) {
+                EXPECT_TRUE(C[i][j].AllClose(A[i][j].Matmul(B[i][j]), 1e-5,
+                                             1e-5));
+            }
+        }
+    }
+
+    // Empty batch.
+    core::Tensor C;
+    core::BatchedMatmul(core::Tensor::Zeros({0, 3, 3}, core::Float32, device),
+                        core::Tensor::Zeros({0, 3, 2}, core::Float32, device),
+                        C);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({0, 3, 2}));
+
+    // Shape test.
+    core::Tensor A = core::Tensor::Ones({4, 3, 3}, core::Float32, device);
+    EXPECT_ANY_THROW(core::BatchedMatmul(
+            A, core::Tensor::Ones({4, 2, 3}, core::Float32, device), C));
+    EXPECT_ANY_THROW(core::BatchedMatmul(
+            A, core::Tensor::Ones({5, 3, 3}, core::Float32, device), C));
+    EXPECT_ANY_THROW(core::BatchedMatmul(
+            A, core::Tensor::Ones({3}, core::Float32, device), C));
+    EXPECT_ANY_THROW(core::BatchedMatmul(
+            A.To(core::Int32), core::Tensor::Ones({4, 3, 3}, core::Int32),
+            C));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedInverse) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {1, 2, 3, 4, 6, 9}) {
+        // Diagonally dominant matrices are well conditioned.
+        core::Tensor A =
+                RandomMatrices({5, n, n}, core::Float64, device,
+                               static_cast<int>(n)) +
+                core::Tensor::Eye(n, core::Float64, device) *
+                        static_cast<double>(2 * n);
+        core::Tensor A_inv;
+        core::BatchedInverse(A, A_inv);
+        EXPECT_EQ(A_inv.GetShape(), core::SizeVector({5, n, n}));
+        for (int64_t i = 0; i < 5; ++i) {
+            EXPECT_TRUE(A_inv[i].AllClose(A[i].Inverse(), 1e-7, 1e-9));
+        }
+    }
+
+    // A permutation matrix has a negative determinant.
+    core::Tensor P = core::Tensor::Init<float>(
+            {{{0, 1, 0}, {1, 0, 0}, {0, 0, 1}}}, device);
+    core::Tensor P_inv;
+    core::BatchedInverse(P, P_inv);
+    EXPECT_TRUE(P_inv.AllClose(P));
+
+    // Singular test.
+    core::Tensor A = core::Tensor::Eye(4, core::Float32, device)
+                             .Reshape({1, 4, 4})
+                             .Expand({3, 4, 4})
+                             .Contiguous();
+    A[1][2][2] = 0.0f;
+    EXPECT_ANY_THROW(core::BatchedInverse(A, P_inv));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 4}, core::Float32, device), P_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({3}, core::Float32, device), P_inv));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSolve) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {1, 3, 6, 10}) {
+        core::Tensor A =
+                RandomMatrices({2, 4, n, n}, core::Float64, device,
+                               static_cast<int>(n)) +
+                core::Tensor::Eye(n, core::Float64, device) *
+                        static_cast<double>(2 * n);
+
+        // Batch of vectors.
+        core::Tensor b = RandomMatrices({2, 4, n}, core::Float64, device,
+                                        static_cast<int>(n + 1));
+        core::Tensor x;
+        core::BatchedSolve(A, b, x);
+        EXPECT_EQ(x.GetShape(), b.GetShape());
+        for (int64_t i = 0; i < 2; ++i) {
+            for (int64_t j = 0; j < 4; ++j) {
+                EXPECT_TRUE(A[i][j]
+                                    .Matmul(x[i][j].Reshape({n, 1}))
+                                    .AllClose(b[i][j].Reshape({n, 1}), 1e-7,
+                                              1e-9));
+            }
+        }
+
+        // Batch of matrices.
+        core::Tensor B = RandomMatrices({2, 4, n, 3}, core::Float64, device,
+                                        static_cast<int>(n + 2));
+        core::Tensor X;
+        core::BatchedSolve(A, B, X);
+        EXPECT_EQ(X.GetShape(), B.GetShape());
+        for (int64_t i = 0; i < 2; ++i) {
+            for (int64_t j = 0; j < 4; ++j) {
+                EXPECT_TRUE(A[i][j].Matmul(X[i][j]).AllClose(B[i][j], 1e-7,
+                                                             1e-9));
+            }
+        }
+    }
+
+    // Singular test.
+    core::Tensor x;
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Zeros({2, 3, 3}, core::Float32, device),
+            core::Tensor::Ones({2, 3}, core::Float32, device), x));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({2, 3, 3}, core::Float32, device),
+            core::Tensor::Ones({2, 4}, core::Float32, device), x));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({2, 3, 3}, core::Float32, device),
+            core::Tensor::Ones({3, 3, 1}, core::Float32, device), x));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSVD) {
+    core::Device device = GetParam();
+
+    for (const auto& dtype : {core::Float32, core::Float64}) {
+        const double tolerance = dtype == core::Float32 ? 1e-4 : 1e-9;
+        for (const auto& mn : std::vector<std::array<int64_t, 2>>{
+                     {2, 2}, {3, 3}, {4, 4}, {6, 6}, {5, 3}}) {
+            int64_t m = mn[0], n = mn[1];
+            core::Tensor A = RandomMatrices({7, m, n}, dtype, device,
+                                            static_cast<int>(m * n));
+            // Rank deficient matrix: the last column repeats the first one.
+            A[0].Slice(1, n - 1, n) = A[0].Slice(1, 0, 1);
+
+            core::Tensor U, S, VT;
+            core::BatchedSVD(A, U, S, VT);
+            EXPECT_EQ(U.GetShape(), core::SizeVector({7, m, m}));
+            EXPECT_EQ(S.GetShape(), core::SizeVector({7, n}));
+            EXPECT_EQ(VT.GetShape(), core::SizeVector({7, n, n}));
+
+            core::Tensor I_m = core::Tensor::Eye(m, dtype, device);
+            core::Tensor I_n = core::Tensor::Eye(n, dtype, device);
+            for (int64_t i = 0; i < 7; ++i) {
+                core::Tensor U_i = U[i], S_i = S[i], VT_i = VT[i];
+                EXPECT_TRUE(U_i.Matmul(U_i.T()).AllClose(I_m, tolerance,
+                                                         tolerance));
+                EXPECT_TRUE(VT_i.Matmul(VT_i.T()).AllClose(I_n, tolerance,
+                                                           tolerance));
+                EXPECT_TRUE(
+                        S_i.AllClose(std::get<1>(A[i].SVD()), tolerance,
+                                     tolerance));
+                core::Tensor USVT =
+                        U_i.Slice(1, 0, n).Matmul(
+                                core::Tensor::Diag(S_i).Matmul(VT_i));
+                EXPECT_TRUE(USVT.AllClose(A[i], tolerance, tolerance));
+            }
+        }
+    }
+
+    // Shape test.
+    core::Tensor U, S, VT;
+    EXPECT_ANY_THROW(core::BatchedSVD(
+            core::Tensor::Ones({2, 3, 4}, core::Float32, device), U, S, VT));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedEigh) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {1, 2, 3, 6, 8}) {
+        core::Tensor R = RandomMatrices({5, n, n}, core::Float64, device,
+                                        static_cast<int>(n));
+        core::Tensor A = R + R.Transpose(1, 2);
+        core::Tensor w, V;
+        core::BatchedEigh(A, w, V);
+        EXPECT_EQ(w.GetShape(), core::SizeVector({5, n}));
+        EXPECT_EQ(V.GetShape(), core::SizeVector({5, n, n}));
+
+        core::Tensor I = core::Tensor::Eye(n, core::Float64, device);
+        for (int64_t i = 0; i < 5; ++i) {
+            core::Tensor V_i = V[i];
+            EXPECT_TRUE(V_i.T().Matmul(V_i).AllClose(I, 1e-9, 1e-9));
+            EXPECT_TRUE(V_i.Matmul(core::Tensor::Diag(w[i]))
+                                .Matmul(V_i.T())
+                                .AllClose(A[i], 1e-9, 1e-9));
+            std::vector<double> w_i = w[i].ToFlatVector<double>();
+            EXPECT_TRUE(std::is_sorted(w_i.begin(), w_i.end()));
+        }
+    }
+
+    // Known eigenvalues.
+    core::Tensor A = core::Tensor::Init<float>(
+            {{{2, 1, 0}, {1, 2, 0}, {0, 0, 5}}}, device);
+    core::Tensor w, V;
+    core::BatchedEigh(A, w, V);
+    EXPECT_TRUE(w.AllClose(core::Tensor::Init<float>({{1, 3, 5}}, device)));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedEigh(
+            core::Tensor::Ones({2, 9, 9}, core::Float32, device), w, V));
+    EXPECT_ANY_THROW(core::BatchedEigh(
+            core::Tensor::Ones({2, 3, 2}, core::Float32, device), w, V));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -29,6 +29,7 @@
 #include <map>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -162,6 +163,83 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, MemoryUsage) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    const core::MemoryUsage before = statistic.GetMemoryUsage(device);
+    statistic.ResetPeakMemoryUsage(device);
+
+    void* ptr0 = core::MemoryManager::Malloc(100, device);
+    void* ptr1 = core::MemoryManager::Malloc(200, device);
+    core::MemoryUsage usage = statistic.GetMemoryUsage(device);
+    EXPECT_EQ(usage.current_bytes_ - before.current_bytes_, 300);
+    EXPECT_EQ(usage.peak_bytes_ - before.current_bytes_, 300);
+    EXPECT_EQ(usage.total_allocated_bytes_ - before.total_allocated_bytes_,
+              300);
+    EXPECT_EQ(usage.count_malloc_ - before.count_malloc_, 2);
+
+    core::MemoryManager::Free(ptr1, device);
+    usage = statistic.GetMemoryUsage(device);
+    EXPECT_EQ(usage.current_bytes_ - before.current_bytes_, 100);
+    EXPECT_EQ(usage.peak_bytes_ - before.current_bytes_, 300);
+    EXPECT_EQ(usage.count_free_ - before.count_free_, 1);
+
+    statistic.ResetPeakMemoryUsage(device);
+    usage = statistic.GetMemoryUsage(device);
+    EXPECT_EQ(usage.peak_bytes_, usage.current_bytes_);
+
+    core::MemoryManager::Free(ptr0, device);
+    usage = statistic.GetMemoryUsage(device);
+    EXPECT_EQ(usage.current_bytes_, before.current_bytes_);
+    EXPECT_EQ(usage.count_free_ - before.count_free_, 2);
+}
+
+TEST_P(MemoryManagerPermuteDevices, MemoryUsageByTag) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    auto tag_usage = statistic.GetMemoryUsageByTag(device);
+    const core::MemoryUsage outer_before = tag_usage["Test"];
+    const core::MemoryUsage inner_before = tag_usage["Test/Inner"];
+
+    void* ptr0;
+    void* ptr1;
+    {
+        core::ScopedMemoryTag outer_tag("Test");
+        ptr0 = core::MemoryManager::Malloc(16, device);
+        {
+            core::ScopedMemoryTag inner_tag("Inner");
+            ptr1 = core::MemoryManager::Malloc(32, device);
+        }
+    }
+    EXPECT_EQ(core::MemoryManagerStatistic::GetCurrentTag(), nullptr);
+
+    tag_usage = statistic.GetMemoryUsageByTag(device);
+    EXPECT_EQ(tag_usage["Test"].current_bytes_ - outer_before.current_bytes_,
+              16);
+    EXPECT_EQ(tag_usage["Test"].count_malloc_ - outer_before.count_malloc_, 1);
+    EXPECT_EQ(tag_usage["Test/Inner"].current_bytes_ -
+                      inner_before.current_bytes_,
+              32);
+
+    const std::string dump = statistic.GetMemoryUsageString(true);
+    EXPECT_NE(dump.find(device.ToString()), std::string::npos);
+    EXPECT_NE(dump.find("Test/Inner"), std::string::npos);
+
+    // Frees are attributed to the allocating tag, whatever the current tag.
+    core::MemoryManager::Free(ptr0, device);
+    core::MemoryManager::Free(ptr1, device);
+    tag_usage = statistic.GetMemoryUsageByTag(device);
+    EXPECT_EQ(tag_usage["Test"].current_bytes_, outer_before.current_bytes_);
+    EXPECT_EQ(tag_usage["Test/Inner"].current_bytes_,
+              inner_before.current_bytes_);
+    EXPECT_EQ(tag_usage["Test/Inner"].count_free_ - inner_before.count_free_,
+              1);
+}
+
 void ExpectStatistic(const std::shared_ptr<DummyMemoryManager>& dummy_mm,
                      int64_t malloc_count,
                      int64_t free_count,
@@ -0,0 +1,252 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/SegmentReduction.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+using core::kernel::SegmentReductionOpCode;
+
+class SegmentReductionPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SegmentReduction,
+                         SegmentReductionPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SegmentReductionPermuteDevices, SegmentIds) {
+    core::Device device = GetParam();
+
+    // Segments 1 and 3 are empty, rows with ids -1 and 5 are skipped.
+    core::Tensor values(std::vector<float>{1, 10, 2, 20, 3, 5, 4, 40, 6, 1, 7,
+                                           70},
+                        {6, 2}, core::Float32, device);
+    core::Tensor segment_ids(std::vector<int64_t>{2, 0, 2, -1, 0, 5}, {6},
+                             core::Int64, device);
+    auto reduce = [&](SegmentReductionOpCode op_code) {
+        return core::kernel::SegmentReduction(values, segment_ids, 4, op_code);
+    };
+
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Sum)
+                        .AllClose(core::Tensor::Init<float>(
+                                {{8, 21}, {0, 0}, {4, 15}, {0, 0}}, device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Mean)
+                        .AllClose(core::Tensor::Init<float>(
+                                {{4, 10.5}, {0, 0}, {2, 7.5}, {0, 0}},
+                                device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Min)
+                        .AllClose(core::Tensor::Init<float>(
+                                {{2, 1}, {0, 0}, {1, 5}, {0, 0}}, device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Max)
+                        .AllClose(core::Tensor::Init<float>(
+                                {{6, 20}, {0, 0}, {3, 10}, {0, 0}}, device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::ArgMin)
+                        .AllClose(core::Tensor::Init<int64_t>(
+                                {{1, 4}, {-1, -1}, {0, 2}, {-1, -1}},
+                                device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::ArgMax)
+                        .AllClose(core::Tensor::Init<int64_t>(
+                                {{4, 1}, {-1, -1}, {2, 0}, {-1, -1}},
+                                device)));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Count)
+                        .AllClose(core::Tensor::Init<int64_t>({2, 0, 2, 0},
+                                                              device)));
+
+    // No segments.
+    EXPECT_EQ(core::kernel::SegmentReduction(values, segment_ids, 0,
+                                             SegmentReductionOpCode::Sum)
+                      .GetShape(),
+              core::SizeVector({0, 2}));
+
+    EXPECT_ANY_THROW(core::kernel::SegmentReduction(
+            values, segment_ids.To(core::Int32), 4,
+            SegmentReductionOpCode::Sum));
+    EXPECT_ANY_THROW(core::kernel::SegmentReduction(
+            values, segment_ids.Slice(0, 0, 5), 4,
+            SegmentReductionOpCode::Sum));
+    EXPECT_ANY_THROW(core::kernel::SegmentReduction(
+            values.To(core::Int32), segment_ids, 4,
+            SegmentReductionOpCode::Mean));
+}
+
+TEST_P(SegmentReductionPermuteDevices, RowSplits) {
+    core::Device device = GetParam();
+
+    core::Tensor values = core::Tensor::Init<int32_t>(
+                                  {{1, 2}, {3, 4}, {5, 6}, {7, 8}}, device)
+                                  .Reshape({4, 1, 2});
+    core::Tensor row_splits =
+            core::Tensor::Init<int64_t>({0, 1, 1, 4}, device);
+    auto reduce = [&](SegmentReductionOpCode op_code) {
+        return core::kernel::SegmentReductionRowSplits(values, row_splits,
+                                                       op_code);
+    };
+
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Sum)
+                        .AllClose(core::Tensor::Init<int32_t>(
+                                          {{1, 2}, {0, 0}, {15, 18}}, device)
+                                          .Reshape({3, 1, 2})));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Min)
+                        .AllClose(core::Tensor::Init<int32_t>(
+                                          {{1, 2}, {0, 0}, {3, 4}}, device)
+                                          .Reshape({3, 1, 2})));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::ArgMax)
+                        .AllClose(core::Tensor::Init<int64_t>(
+                                          {{0, 0}, {-1, -1}, {3, 3}}, device)
+                                          .Reshape({3, 1, 2})));
+    EXPECT_TRUE(reduce(SegmentReductionOpCode::Count)
+                        .AllClose(core::Tensor::Init<int64_t>({1, 0, 3},
+                                                              device)));
+
+    EXPECT_ANY_THROW(core::kernel::SegmentReductionRowSplits(
+            values, core::Tensor::Init<int64_t>({0, 1, 3}, device),
+            SegmentReductionOpCode::Sum));
+    EXPECT_ANY_THROW(core::kernel::SegmentReductionRowSplits(
+            values, core::Tensor::Init<int64_t>({1, 4}, device),
+            SegmentReductionOpCode::Sum));
+    EXPECT_ANY_THROW(core::kernel::SegmentReductionRowSplits(
+            values, core::Tensor::Init<int64_t>({0, 10, 4}, device),
+            SegmentReductionOpCode::Count));
+}
+
+TEST_P(SegmentReductionPermuteDevices, Random) {
+    core::Device device = GetParam();
+    const int64_t num_rows = 1000;
+    const int64_t num_cols = 3;
+    const int64_t num_segments = 37;
+
+    std::vector<int> ids(num_rows);
+    Rand(ids.data(), ids.size(), 0, num_segments - 1, 0);
+    std::vector<double> values(num_rows * num_cols);
+    Rand(values, -1.0, 1.0, 1);
+
+    std::vector<double> sums(num_segments * num_cols, 0);
+    std::vector<int64_t> argmaxs(num_segments * num_cols, -1);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        for (int64_t j = 0; j < num_cols; ++j) {
+            const int64_t k = ids[i] * num_cols + j;
+            sums[k] += values[i * num_cols + j];
+            if (argmaxs[k] < 0 ||
+                values[i * num_cols + j] > values[argmaxs[k] * num_cols + j]) {
+                argmaxs[k] = i;
+            }
+        }
+    }
+
+    core::Tensor values_t(values, {num_rows, num_cols}, core::Float64, device);
+    core::Tensor ids_t = core::Tensor(ids, {num_rows}, core::Int32, device)
+                                 .To(core::Int64);
+    EXPECT_TRUE(core::kernel::SegmentReduction(values_t, ids_t, num_segments,
+                                               SegmentReductionOpCode::Sum)
+                        .AllClose(core::Tensor(sums, {num_segments, num_cols},
+                                               core::Float64, device)));
+    EXPECT_TRUE(core::kernel::SegmentReduction(values_t, ids_t, num_segments,
+                                               SegmentReductionOpCode::ArgMax)
+                        .AllClose(core::Tensor(argmaxs,
+                                               {num_segments, num_cols},
+                                               core::Int64, device)));
+}
+
+// Segments longer than the chunk size are reduced in chunks whose partial
+// results are combined.
+TEST_P(SegmentReductionPermuteDevices, LargeSegments) {
+    core::Device device = GetParam();
+    const int64_t num_rows = 5000;
+    const int64_t num_cols = 2;
+    const int64_t num_segments = 4;
+
+    // Segment 0 is large, segment 1 is small, segment 2 is empty and segment
+    // 3 is large with all values equal.
+    std::vector<int> ids(num_rows);
+    Rand(ids.data(), ids.size(), 0, 9, 0);
+    for (int& id : ids) {
+        id = id == 0 ? 1 : (id < 5 ? 0 : 3);
+    }
+    std::vector<double> values(num_rows * num_cols);
+    Rand(values, -1.0, 1.0, 1);
+
+    std::vector<double> sums(num_segments * num_cols, 0);
+    std::vector<double> mins(num_segments * num_cols, 0);
+    std::vector<int64_t> counts(num_segments, 0);
+    std::vector<int64_t> argmins(num_segments * num_cols, -1);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        if (ids[i] == 3) {
+            values[i * num_cols] = values[i * num_cols + 1] = 0.5;
+        }
+        ++counts[ids[i]];
+        for (int64_t j = 0; j < num_cols; ++j) {
+            const int64_t k = ids[i] * num_cols + j;
+            const double value = values[i * num_cols + j];
+            sums[k] += value;
+            if (argmins[k] < 0 || value < mins[k]) {
+                mins[k] = value;
+                argmins[k] = i;
+            }
+        }
+    }
+    std::vector<double> means(sums);
+    for (int64_t k = 0; k < num_segments * num_cols; ++k) {
+        means[k] /= std::max<int64_t>(counts[k / num_cols], 1);
+    }
+
+    core::Tensor values_t(values, {num_rows, num_cols}, core::Float64, device);
+    core::Tensor ids_t = core::Tensor(ids, {num_rows}, core::Int32, device)
+                                 .To(core::Int64);
+    const core::SizeVector shape{num_segments, num_cols};
+    EXPECT_TRUE(values_t.SegmentSum(ids_t, num_segments)
+                        .AllClose(core::Tensor(sums, shape, core::Float64,
+                                               device)));
+    EXPECT_TRUE(values_t.SegmentMean(ids_t, num_segments)
+                        .AllClose(core::Tensor(means, shape, core::Float64,
+                                               device)));
+    EXPECT_TRUE(values_t.SegmentMin(ids_t, num_segments)
+                        .AllClose(core::Tensor(mins, shape, core::Float64,
+                                               device)));
+    EXPECT_EQ(values_t.SegmentArgMin(ids_t, num_segments)
+                      .ToFlatVector<int64_t>(),
+              argmins);
+    EXPECT_EQ(core::kernel::SegmentReduction(values_t, ids_t, num_segments,
+                                             SegmentReductionOpCode::Count)
+                      .ToFlatVector<int64_t>(),
+              counts);
+
+    // Float32 sums stay accurate as they are accumulated over chunks.
+    EXPECT_TRUE(values_t.To(core::Float32)
+                        .SegmentSum(ids_t, num_segments)
+                        .AllClose(core::Tensor(sums, shape, core::Float64,
+                                               device)
+                                          .To(core::Float32),
+                                  1e-5, 1e-4));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class StreamPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Stream,
+                         StreamPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST(Stream, EnqueueInOrder) {
+    core::Stream stream(core::Device("CPU:0"));
+    std::vector<int> values;
+    for (int i = 0; i < 100; ++i) {
+        stream.Enqueue([&values, i]() { values.push_back(i); });
+    }
+    stream.Synchronize();
+    EXPECT_TRUE(stream.IsCompleted());
+    ASSERT_EQ(values.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+}
+
+TEST(Stream, Event) {
+    core::Stream stream(core::Device("CPU:0"));
+    core::Event never_recorded;
+    EXPECT_TRUE(never_recorded.IsCompleted());
+
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+    stream.Enqueue([gate_future]() { gate_future.wait(); });
+    core::Event event = stream.Record();
+    EXPECT_FALSE(event.IsCompleted());
+    EXPECT_FALSE(stream.IsCompleted());
+
+    gate.set_value();
+    event.Synchronize();
+    EXPECT_TRUE(event.IsCompleted());
+    stream.Synchronize();
+}
+
+TEST(Stream, WaitEvent) {
+    core::Stream producer(core::Device("CPU:0"));
+    core::Stream consumer(core::Device("CPU:0"));
+
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+    bool produced = false;
+    producer.Enqueue([gate_future, &produced]() {
+        gate_future.wait();
+        produced = true;
+    });
+    core::Event event = producer.Record();
+
+    consumer.Wait(event);
+    bool seen = false;
+    consumer.Enqueue([&produced, &seen]() { seen = produced; });
+    EXPECT_FALSE(consumer.IsCompleted());
+
+    gate.set_value();
+    consumer.Synchronize();
+    EXPECT_TRUE(seen);
+    producer.Synchronize();
+}
+
+TEST(Stream, WaitEventRecordedAgain) {
+    core::Stream producer(core::Device("CPU:0"));
+    core::Stream consumer(core::Device("CPU:0"));
+    core::Stream blocked(core::Device("CPU:0"));
+
+    core::Event event;
+    event.Record(producer);
+    consumer.Wait(event);
+    bool seen = false;
+    consumer.Enqueue([&seen]() { seen = true; });
+
+    // The consumer waits on the first recording only, which completes
+    // although the second one is blocked.
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+    blocked.Enqueue([gate_future]() { gate_future.wait(); });
+    event.Record(blocked);
+    for (int i = 0; i < 1000 && !consumer.IsCompleted(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_TRUE(consumer.IsCompleted());
+    EXPECT_FALSE(event.IsCompleted());
+
+    gate.set_value();
+    consumer.Synchronize();
+    EXPECT_TRUE(seen);
+    blocked.Synchronize();
+    EXPECT_TRUE(event.IsCompleted());
+}
+
+TEST(Stream, Concurrent) {
+    // Each task waits for the other, which only succeeds if the two streams
+    // run concurrently.
+    core::Stream stream0(core::Device("CPU:0"));
+    core::Stream stream1(core::Device("CPU:0"));
+    std::promise<void> started0, started1;
+    std::shared_future<void> future0 = started0.get_future().share();
+    std::shared_future<void> future1 = started1.get_future().share();
+    bool concurrent0 = false, concurrent1 = false;
+    stream0.Enqueue([&]() {
+        started0.set_value();
+        concurrent0 = future1.wait_for(std::chrono::seconds(10)) ==
+                      std::future_status::ready;
+    });
+    stream1.Enqueue([&]() {
+        started1.set_value();
+        concurrent1 = future0.wait_for(std::chrono::seconds(10)) ==
+                      std::future_status::ready;
+    });
+    stream0.Synchronize();
+    stream1.Synchronize();
+    EXPECT_TRUE(concurrent0);
+    EXPECT_TRUE(concurrent1);
+}
+
+TEST(Stream, Exception) {
+    core::Stream stream(core::Device("CPU:0"));
+    bool executed = false;
+    stream.Enqueue([]() { throw std::runtime_error("Task failed."); });
+    stream.Enqueue([&executed]() { executed = true; });
+    EXPECT_THROW(stream.Synchronize(), std::runtime_error);
+    EXPECT_TRUE(executed);
+    // The exception is only reported once.
+    stream.Synchronize();
+}
+
+TEST_P(StreamPermuteDevices, ToAsync) {
+    core::Device device = GetParam();
+    core::Device host("CPU:0");
+    core::Stream stream(device);
+
+    core::Tensor src = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, host);
+    core::Tensor dst = src.T().ToAsync(device, stream);
+    core::Tensor back = dst.ToAsync(host, stream);
+    stream.Synchronize();
+
+    EXPECT_EQ(dst.GetDevice(), device);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_TRUE(back.AllClose(src.T()));
+}
+
+TEST(Stream, RecordCurrentStream) {
+    // Work outside of streams is synchronous on CPU.
+    core::Event event;
+    event.RecordCurrentStream(core::Device("CPU:0"));
+    EXPECT_TRUE(event.IsCompleted());
+}
+
+TEST_P(StreamPermuteDevices, ToAsyncOverlap) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CUDA) {
+        return;
+    }
+    core::Device host("CPU:0");
+
+    // Keep the current stream busy for a while.
+    core::Tensor busy_tensor =
+            core::Tensor::Zeros({1 << 26}, core::Float32, device);
+    for (int i = 0; i < 100; ++i) {
+        busy_tensor.Add_(1);
+    }
+    core::Event busy;
+    busy.RecordCurrentStream(device);
+
+    // An upload on another stream runs while the current stream is busy.
+    core::Stream stream(device);
+    core::Tensor src = core::Tensor::Init<float>({0, 1, 2}, host);
+    core::Tensor dst = src.ToAsync(device, stream);
+    stream.Synchronize();
+    EXPECT_FALSE(busy.IsCompleted());
+
+    // A download waits for the work on the current stream that writes its
+    // source.
+    core::Tensor result = busy_tensor.ToAsync(host, stream);
+    stream.Synchronize();
+    EXPECT_TRUE(busy.IsCompleted());
+    EXPECT_EQ(result.Min({0}).Item<float>(), 100);
+    EXPECT_EQ(result.Max({0}).Item<float>(), 100);
+    EXPECT_TRUE(dst.To(host).AllClose(src));
+}
+
+}  // namespace tests
+}  // namespace open3d
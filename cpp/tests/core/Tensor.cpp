@@ -1172,6 +1172,128 @@ TEST_P(TensorPermuteDevicePairs, IndexSetBroadcast) {
                                   0, 0, 0, 0, 20, 20, 20, 0, 0, 0, 0, 0}));
 }
 
+TEST_P(TensorPermuteDevicePairs, IndexGetRows) {
+    core::Device idx_device;
+    core::Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, src_device);
+
+    // t[[2, 0, -1, 2]]
+    core::Tensor index_t =
+            core::Tensor::Init<int64_t>({2, 0, -1, 2}, idx_device);
+    core::Tensor dst_t = src_t.IndexGet({index_t});
+    EXPECT_TRUE(dst_t.IsContiguous());
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({4, 3}));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 0, 1, 2, 9, 10, 11, 6, 7, 8}));
+
+    // t[[2, 0], :] gives the same rows.
+    dst_t = src_t.GetItem(
+            {core::TensorKey::IndexTensor(
+                     core::Tensor::Init<int64_t>({2, 0}, idx_device)),
+             core::TensorKey::Slice(core::None, core::None, core::None)});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 0, 1, 2}));
+
+    // Rows of a strided view, t[::2][[1, 0]].
+    dst_t = src_t.Slice(0, 0, 4, 2).IndexGet(
+            {core::Tensor::Init<int64_t>({1, 0}, idx_device)});
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({6, 7, 8, 0, 1, 2}));
+
+    // Non row-contiguous tensors use the generic path, t.T[[2, 0]].
+    dst_t = src_t.T().IndexGet(
+            {core::Tensor::Init<int64_t>({2, 0}, idx_device)});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({2, 5, 8, 11, 0, 3, 6, 9}));
+
+    // Empty index.
+    dst_t = src_t.IndexGet({core::Tensor({0}, core::Int64, idx_device)});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({0, 3}));
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexGetRowsByMask) {
+    core::Device idx_device;
+    core::Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<int32_t>(
+            {{0, 1}, {2, 3}, {4, 5}, {6, 7}}, src_device);
+    core::Tensor mask_t =
+            core::Tensor::Init<bool>({false, true, false, true}, idx_device);
+    core::Tensor dst_t = src_t.IndexGet({mask_t});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({2, 2}));
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 3, 6, 7}));
+
+    mask_t = core::Tensor::Zeros({4}, core::Bool, idx_device);
+    dst_t = src_t.IndexGet({mask_t});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({0, 2}));
+
+    // Large enough to be compacted in multiple chunks, keeping the order.
+    const int64_t n = 100000;
+    src_t = core::Tensor::Arange(0, 2 * n, 1, core::Int64, src_device)
+                    .View({n, 2});
+    mask_t = core::Tensor::Zeros({n}, core::Bool, idx_device);
+    mask_t.Slice(0, 0, n, 3).Fill(true);
+    dst_t = src_t.IndexGet({mask_t});
+    core::Tensor expected_t = src_t.Slice(0, 0, n, 3);
+    EXPECT_TRUE(dst_t.AllClose(expected_t));
+
+    // Same as the kernel called directly, and as IndexGet with NonZero.
+    EXPECT_TRUE(core::kernel::IndexGetRowsByMask(src_t, mask_t.To(src_device))
+                        .AllClose(expected_t));
+    EXPECT_TRUE(src_t.IndexGet({mask_t.NonZero()[0]}).AllClose(expected_t));
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexSetRows) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    core::Tensor dst_t = core::Tensor::Zeros({4, 2}, core::Float32, dst_device);
+    core::Tensor src_t =
+            core::Tensor::Init<float>({{1, 2}, {3, 4}, {5, 6}}, src_device);
+
+    // t[[3, 0, -3]] = src
+    dst_t.IndexSet({core::Tensor::Init<int64_t>({3, 0, -3}, src_device)},
+                   src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({3, 4, 5, 6, 0, 0, 1, 2}));
+
+    // t[mask] = src
+    dst_t = core::Tensor::Zeros({4, 2}, core::Float32, dst_device);
+    dst_t.IndexSet({core::Tensor::Init<bool>({true, false, true, true},
+                                             src_device)},
+                   src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 0, 0, 3, 4, 5, 6}));
+
+    // t[mask] = value is broadcast by the generic path.
+    dst_t.IndexSet({core::Tensor::Init<bool>({true, true, false, false},
+                                             src_device)},
+                   core::Tensor::Init<float>({9}, src_device));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({9, 9, 9, 9, 3, 4, 5, 6}));
+
+    // Rows of a strided view are written through, t[::2][[1]] = src[:1].
+    dst_t = core::Tensor::Zeros({4, 2}, core::Float32, dst_device);
+    core::Tensor dst_view = dst_t.Slice(0, 0, 4, 2);
+    dst_view.IndexSet({core::Tensor::Init<int64_t>({1}, src_device)},
+                      src_t.Slice(0, 0, 1));
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 0, 1, 2, 0, 0}));
+
+    // Mismatched dtypes are rejected.
+    EXPECT_ANY_THROW(dst_t.IndexSet(
+            {core::Tensor::Init<int64_t>({0, 1, 2}, src_device)},
+            src_t.To(core::Float64)));
+}
+
 TEST_P(TensorPermuteDevices, Permute) {
     core::Device device = GetParam();
 
@@ -2000,6 +2122,139 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceContiguousDims) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Arange(0, 2 * 3 * 4 * 5, 1, core::Int64, device)
+                    .View({2, 3, 4, 5});
+    // Non-contiguous copy, reduced by the generic engine.
+    core::Tensor src_strided = src.Permute({3, 2, 1, 0})
+                                       .Contiguous()
+                                       .Permute({3, 2, 1, 0});
+    EXPECT_FALSE(src_strided.IsContiguous());
+
+    for (const core::SizeVector& dims : std::vector<core::SizeVector>{
+                 {0}, {1}, {3}, {1, 2}, {2, 1}, {0, 1, 2}, {1, 2, 3}, {-1},
+                 {0, 1, 2, 3}}) {
+        for (bool keepdim : {true, false}) {
+            EXPECT_TRUE(src.Sum(dims, keepdim)
+                                .AllClose(src_strided.Sum(dims, keepdim)));
+            EXPECT_TRUE(src.Min(dims, keepdim)
+                                .AllClose(src_strided.Min(dims, keepdim)));
+            EXPECT_TRUE(src.Max(dims, keepdim)
+                                .AllClose(src_strided.Max(dims, keepdim)));
+        }
+    }
+}
+
+TEST_P(TensorPermuteDevices, ReduceSumFloatPrecision) {
+    core::Device device = GetParam();
+
+    // Naive sequential float32 summation stalls at 2^24 = 16777216.
+    const int64_t n = 1 << 25;
+    core::Tensor src = core::Tensor::Ones({n}, core::Float32, device);
+    EXPECT_EQ(src.Sum({0}).Item<float>(), static_cast<float>(n));
+
+    src = core::Tensor::Full({n / 4, 4}, 0.1, core::Float32, device);
+    core::Tensor expected =
+            core::Tensor::Full({4}, 0.1 * (n / 4), core::Float32, device);
+    EXPECT_TRUE(src.Sum({0}).AllClose(expected, 1e-6));
+    EXPECT_TRUE(src.Mean({0}).AllClose(
+            core::Tensor::Full({4}, 0.1, core::Float32, device), 1e-6));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMinMax) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>(
+            {{{3, -2, 5}, {0, 7, -4}}, {{-1, 6, 2}, {8, -3, 1}}}, device);
+
+    for (const core::SizeVector& dims : std::vector<core::SizeVector>{
+                 {}, {0}, {1}, {2}, {1, 2}, {0, 1, 2}, {0, 2}}) {
+        for (bool keepdim : {true, false}) {
+            core::Tensor min, max;
+            std::tie(min, max) = src.MinMax(dims, keepdim);
+            EXPECT_TRUE(min.AllClose(src.Min(dims, keepdim)));
+            EXPECT_TRUE(max.AllClose(src.Max(dims, keepdim)));
+        }
+    }
+
+    // Large enough to be split into chunks.
+    const int64_t n = 1 << 20;
+    src = core::Tensor::Arange(0, n, 1, core::Int32, device);
+    src[12345] = core::Tensor::Init<int32_t>(-7, device);
+    core::Tensor min, max;
+    std::tie(min, max) = src.MinMax({0});
+    EXPECT_EQ(min.Item<int32_t>(), -7);
+    EXPECT_EQ(max.Item<int32_t>(), n - 1);
+
+    EXPECT_ANY_THROW(core::Tensor::Ones({0, 3}, core::Float32, device)
+                             .MinMax({0}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMeanVar) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<double>(
+            {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 13}}, device);
+
+    core::Tensor mean, var;
+    std::tie(mean, var) = src.MeanVar({0});
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({4}));
+    EXPECT_TRUE(mean.AllClose(
+            core::Tensor::Init<double>({5, 6, 7, 25. / 3}, device)));
+    EXPECT_TRUE(var.AllClose(core::Tensor::Init<double>(
+            {32. / 3, 32. / 3, 32. / 3, 122. / 9},
+            device)));
+
+    for (const core::SizeVector& dims : std::vector<core::SizeVector>{
+                 {0}, {1}, {0, 1}, {1, 0}}) {
+        for (bool keepdim : {true, false}) {
+            std::tie(mean, var) = src.MeanVar(dims, keepdim);
+            core::Tensor expected_mean = src.Mean(dims, true);
+            core::Tensor diff = src - expected_mean;
+            core::Tensor expected_var = (diff * diff).Mean(dims, keepdim);
+            EXPECT_TRUE(mean.AllClose(src.Mean(dims, keepdim)));
+            EXPECT_TRUE(var.AllClose(expected_var));
+        }
+    }
+
+    // A large offset makes E[x^2] - E[x]^2 cancel out in float32.
+    const int64_t n = 1 << 20;
+    core::Tensor offset_src =
+            core::Tensor::Full({n}, 1e4, core::Float32, device);
+    offset_src.Slice(0, 0, n, 2).Add_(1);
+    std::tie(mean, var) = offset_src.MeanVar({0});
+    EXPECT_NEAR(mean.Item<float>(), 1e4 + 0.5, 1e-3);
+    EXPECT_NEAR(var.Item<float>(), 0.25, 1e-4);
+
+    EXPECT_ANY_THROW(
+            core::Tensor::Ones({2, 3}, core::Int32, device).MeanVar({0}));
+}
+
+TEST_P(TensorPermuteDevices, ReduceMeanCov) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 2, 0}, {2, 4, 1}, {3, 6, 0}, {4, 8, 1}}, device);
+
+    core::Tensor mean, cov;
+    std::tie(mean, cov) = src.MeanCov();
+    EXPECT_TRUE(mean.AllClose(
+            core::Tensor::Init<float>({2.5, 5, 0.5}, device)));
+    EXPECT_TRUE(cov.AllClose(core::Tensor::Init<float>(
+            {{1.25, 2.5, 0.25}, {2.5, 5, 0.5}, {0.25, 0.5, 0.25}}, device)));
+
+    // Same as centering and multiplying, for enough samples to be chunked.
+    const int64_t n = 100000;
+    src = core::Tensor::Arange(0, 3 * n, 1, core::Float64, device)
+                  .View({n, 3})
+                  .Sqrt();
+    std::tie(mean, cov) = src.MeanCov();
+    core::Tensor diff = src - src.Mean({0});
+    EXPECT_TRUE(mean.AllClose(src.Mean({0})));
+    EXPECT_TRUE(cov.AllClose(diff.T().Matmul(diff).Div(n)));
+
+    EXPECT_ANY_THROW(core::Tensor::Ones({3}, core::Float32, device).MeanCov());
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2788,6 +3043,55 @@ TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST_P(TensorPermuteDevices, FromMappedFile) {
+    core::Device device = GetParam();
+    const std::string file_name = "tensor_mapped.bin";
+
+    // Raw file: a 4-byte header followed by {2, 3} Int32 values.
+    std::vector<int32_t> values = {0, 1, 2, 3, 4, 5};
+    {
+        utility::filesystem::CFile file;
+        ASSERT_TRUE(file.Open(file_name, "wb"));
+        fwrite("head", 1, 4, file.GetFILE());
+        fwrite(values.data(), sizeof(int32_t), values.size(), file.GetFILE());
+    }
+
+    core::Tensor t = core::Tensor::FromMappedFile(file_name, 4, {2, 3},
+                                                  core::Int32);
+    EXPECT_EQ(t.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(t.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(t.ToFlatVector<int32_t>(), values);
+    EXPECT_EQ(t.To(device).Sum({0}).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 5, 7}));
+
+    // Copy-on-write mappings are writable without changing the file.
+    core::Tensor t_cow = core::Tensor::FromMappedFile(
+            file_name, 4, {2, 3}, core::Int32, /*copy_on_write=*/true);
+    t_cow.Fill(7);
+    EXPECT_EQ(t_cow.ToFlatVector<int32_t>(), std::vector<int32_t>(6, 7));
+    EXPECT_EQ(t.ToFlatVector<int32_t>(), values);
+
+    // Tensors of an open mapping keep it alive after the caller releases it.
+    auto mapped_file = std::make_shared<utility::filesystem::MappedFile>();
+    ASSERT_TRUE(mapped_file->Open(
+            file_name, false,
+            utility::filesystem::MappedFile::AccessPattern::Random));
+    core::Tensor t_row =
+            core::Tensor::FromMappedFile(mapped_file, 16, {3}, core::Int32);
+    EXPECT_ANY_THROW(
+            core::Tensor::FromMappedFile(mapped_file, 8, {2, 3}, core::Int32));
+    mapped_file.reset();
+    EXPECT_EQ(t_row.ToFlatVector<int32_t>(), std::vector<int32_t>({3, 4, 5}));
+
+    // The file is too small or missing.
+    EXPECT_ANY_THROW(
+            core::Tensor::FromMappedFile(file_name, 8, {2, 3}, core::Int32));
+    EXPECT_ANY_THROW(core::Tensor::FromMappedFile("missing_tensor.bin", 0,
+                                                  {2, 3}, core::Int32));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 TEST_P(TensorPermuteDevices, IsSame) {
     core::Device device = GetParam();
 
@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(int size) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(size);
+    pcd.colors_.resize(size);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    return pcd;
+}
+
+TEST(LinearOctree, ConvertFromPointCloud) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd);
+
+    EXPECT_EQ(linear_octree.points_.size(), pcd.points_.size());
+    EXPECT_EQ(linear_octree.level_offsets_.size(), 6u);
+    EXPECT_EQ(linear_octree.level_offsets_[1], 1);
+    int64_t num_points = 0;
+    for (int64_t nidx = linear_octree.level_offsets_[4];
+         nidx < linear_octree.level_offsets_[5]; ++nidx) {
+        const geometry::LinearOctreeNode& leaf = linear_octree.nodes_[nidx];
+        EXPECT_TRUE(leaf.IsLeaf());
+        num_points += leaf.point_end_ - leaf.point_begin_;
+    }
+    EXPECT_EQ(num_points, 1000);
+}
+
+TEST(LinearOctree, ToOctree) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(5);
+    linear_octree.ConvertFromPointCloud(pcd);
+    geometry::Octree octree(5);
+    octree.ConvertFromPointCloud(pcd);
+
+    EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+    geometry::LinearOctree from_octree;
+    from_octree.CreateFromOctree(octree);
+    EXPECT_EQ(from_octree.nodes_.size(), linear_octree.nodes_.size());
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(5);
+    linear_octree.ConvertFromPointCloud(pcd);
+    geometry::Octree octree(5);
+    octree.ConvertFromPointCloud(pcd);
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 10) {
+        int64_t nidx = linear_octree.LocateLeafNode(pcd.points_[idx]);
+        ASSERT_GE(nidx, 0);
+        geometry::OctreeNodeInfo info =
+                linear_octree.GetNodeInfo(linear_octree.nodes_[nidx]);
+        auto octree_info = octree.LocateLeafNode(pcd.points_[idx]).second;
+        ExpectEQ(info.origin_, octree_info->origin_);
+        EXPECT_DOUBLE_EQ(info.size_, octree_info->size_);
+        EXPECT_EQ(info.child_index_, octree_info->child_index_);
+    }
+    EXPECT_EQ(linear_octree.LocateLeafNode(Eigen::Vector3d(10, 10, 10)), -1);
+}
+
+TEST(LinearOctree, Traverse) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd);
+
+    size_t num_nodes = 0;
+    size_t num_leaves = 0;
+    linear_octree.Traverse([&](const geometry::LinearOctreeNode& node,
+                               const geometry::OctreeNodeInfo& info) {
+        num_nodes++;
+        num_leaves += node.IsLeaf();
+        EXPECT_EQ(node.depth_, info.depth_);
+        return false;
+    });
+    EXPECT_EQ(num_nodes, linear_octree.nodes_.size());
+    EXPECT_EQ(int64_t(num_leaves), linear_octree.level_offsets_[5] -
+                                           linear_octree.level_offsets_[4]);
+}
+
+TEST(LinearOctree, SearchKNN) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd);
+    geometry::KDTreeFlann kdtree(pcd);
+
+    std::vector<int> indices, ref_indices;
+    std::vector<double> distance2, ref_distance2;
+    for (const Eigen::Vector3d& query :
+         {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(0.5, -0.3, 0.9),
+          Eigen::Vector3d(2, 2, 2)}) {
+        EXPECT_EQ(linear_octree.SearchKNN(query, 30, indices, distance2), 30);
+        kdtree.SearchKNN(query, 30, ref_indices, ref_distance2);
+        ExpectEQ(indices, ref_indices);
+        ExpectEQ(distance2, ref_distance2);
+    }
+}
+
+TEST(LinearOctree, SearchRadius) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd);
+    geometry::KDTreeFlann kdtree(pcd);
+
+    std::vector<int> indices, ref_indices;
+    std::vector<double> distance2, ref_distance2;
+    for (const Eigen::Vector3d& query :
+         {Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(0.5, -0.3, 0.9)}) {
+        int result = linear_octree.SearchRadius(query, 0.3, indices, distance2);
+        EXPECT_EQ(result, kdtree.SearchRadius(query, 0.3, ref_indices,
+                                              ref_distance2));
+        ExpectEQ(indices, ref_indices);
+        ExpectEQ(distance2, ref_distance2);
+    }
+}
+
+TEST(LinearOctree, VoxelGrid) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::LinearOctree linear_octree(4);
+    linear_octree.ConvertFromPointCloud(pcd);
+    int64_t num_leaves =
+            linear_octree.level_offsets_[5] - linear_octree.level_offsets_[4];
+
+    auto voxel_grid = linear_octree.ToVoxelGrid();
+    EXPECT_EQ(int64_t(voxel_grid->voxels_.size()), num_leaves);
+    EXPECT_DOUBLE_EQ(voxel_grid->voxel_size_, linear_octree.size_ / 16);
+
+    geometry::LinearOctree from_voxel_grid;
+    from_voxel_grid.CreateFromVoxelGrid(*voxel_grid);
+    EXPECT_EQ(int64_t(from_voxel_grid.points_.size()), num_leaves);
+    const size_t max_depth = from_voxel_grid.max_depth_;
+    EXPECT_EQ(from_voxel_grid.level_offsets_[max_depth + 1] -
+                      from_voxel_grid.level_offsets_[max_depth],
+              num_leaves);
+}
+
+}  // namespace tests
+}  // namespace open3d
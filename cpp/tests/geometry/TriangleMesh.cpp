@@ -26,6 +26,9 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <array>
+#include <set>
+
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
@@ -1890,6 +1893,56 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertex_normals_;
+    const std::vector<double> radii = {0.1, 0.2};
+
+    auto mesh_serial =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd,
+                                                                     radii);
+    auto mesh_parallel =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+                    pcd, radii, 4);
+
+    // The stitched seams may be triangulated differently, but the surface
+    // has to be covered to the same extent.
+    EXPECT_EQ(mesh_parallel->vertices_.size(), pcd.points_.size());
+    EXPECT_GT(mesh_serial->triangles_.size(), 0u);
+    EXPECT_NEAR(double(mesh_parallel->triangles_.size()),
+                double(mesh_serial->triangles_.size()),
+                0.05 * mesh_serial->triangles_.size());
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingParallelManifold) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 30);
+    sphere->ComputeVertexNormals();
+    auto pcd = sphere->SamplePointsUniformly(3000, false, 0);
+    const std::vector<double> radii = {0.05, 0.1};
+
+    // Triangles of neighbouring slabs and of the stitching pass must not
+    // overlap: no triangle is created twice and every edge has at most two
+    // adjacent triangles.
+    for (int n_partitions : {2, 4, 8}) {
+        auto mesh = geometry::TriangleMesh::
+                CreateFromPointCloudBallPivotingParallel(*pcd, radii,
+                                                         n_partitions);
+        EXPECT_GT(mesh->triangles_.size(), 0u);
+        std::set<std::array<int, 3>> triangles;
+        for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+            std::array<int, 3> vertices{triangle(0), triangle(1), triangle(2)};
+            std::sort(vertices.begin(), vertices.end());
+            EXPECT_TRUE(triangles.insert(vertices).second);
+        }
+        for (const auto& edge : mesh->GetEdgeToTrianglesMap()) {
+            EXPECT_LE(edge.second.size(), 2u);
+        }
+    }
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
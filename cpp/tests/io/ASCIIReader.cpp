@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ASCIIReader.h"
+
+#include <cstdio>
+#include <limits>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ASCIIReader, ParseASCIIDouble) {
+    auto parse = [](const std::string &str, double &value) {
+        const char *ptr = str.data();
+        const bool success =
+                io::ParseASCIIDouble(ptr, str.data() + str.size(), value);
+        return success ? static_cast<int>(ptr - str.data()) : -1;
+    };
+    double value = 0;
+    EXPECT_EQ(parse("1.5", value), 3);
+    EXPECT_EQ(value, 1.5);
+    EXPECT_EQ(parse(" \t-2.5e3 4", value), 8);
+    EXPECT_EQ(value, -2500);
+    EXPECT_EQ(parse("0.1", value), 3);
+    EXPECT_EQ(value, 0.1);
+    EXPECT_EQ(parse("3.14159265358979323846", value), 22);
+    EXPECT_EQ(value, 3.14159265358979323846);
+    EXPECT_EQ(parse("1e-320", value), 6);
+    EXPECT_EQ(value, 1e-320);
+    EXPECT_EQ(parse("0x1p3", value), 5);
+    EXPECT_EQ(value, 8);
+    EXPECT_EQ(parse("7e", value), 1);
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(parse("-inf", value), 4);
+    EXPECT_EQ(value, -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(parse("nan", value), 3);
+    EXPECT_TRUE(std::isnan(value));
+    EXPECT_EQ(parse("", value), -1);
+    EXPECT_EQ(parse("  \r", value), -1);
+    EXPECT_EQ(parse("x1", value), -1);
+    EXPECT_EQ(parse("\n1", value), -1);
+}
+
+TEST(ASCIIReader, ReadASCIIRows) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_ascii_rows.xyz";
+    std::vector<double> expected;
+    FILE *file = fopen(filename.c_str(), "w");
+    fprintf(file, "header\n");
+    for (int i = 0; i < 50000; ++i) {
+        if (i % 7 == 0) {
+            fprintf(file, "# comment\n");
+        } else if (i % 11 == 0) {
+            fprintf(file, "%d %d\r\n", i, i);
+        } else {
+            fprintf(file, "%d.25\t%d %de-3 %d\r\n", i, -i, i, i);
+            expected.insert(expected.end(),
+                            {i + 0.25, -i * 1.0, i / 1000.0});
+        }
+    }
+    // The last line has no newline.
+    fprintf(file, "1 2 3");
+    expected.insert(expected.end(), {1, 2, 3});
+    fclose(file);
+
+    utility::filesystem::MappedFile mapped_file;
+    ASSERT_TRUE(mapped_file.Open(filename));
+    double last_percent = 0;
+    utility::CountingProgressReporter reporter([&](double percent) {
+        EXPECT_GE(percent, last_percent);
+        last_percent = percent;
+        return true;
+    });
+    reporter.SetTotal(mapped_file.GetSize());
+
+    int64_t num_lines = 0;
+    std::vector<double> values = io::ReadASCIIRows(mapped_file, 7, 3, -1,
+                                                   reporter, &num_lines);
+    EXPECT_EQ(num_lines, 50001);
+    EXPECT_EQ(values, expected);
+    EXPECT_EQ(last_percent, 100);
+
+    // Only the first 20 lines, 16 of which are valid.
+    last_percent = 0;
+    values = io::ReadASCIIRows(mapped_file, 7, 3, 20, reporter, &num_lines);
+    EXPECT_EQ(num_lines, 20);
+    EXPECT_EQ(values, std::vector<double>(expected.begin(),
+                                          expected.begin() + 16 * 3));
+
+    // The same rows split into xy and z columns. Lines with only two values
+    // fill the first group before they are skipped.
+    std::vector<double> xy, z;
+    const int64_t num_rows = io::ReadASCIIColumns(
+            mapped_file, 7, {2, 1}, -1, reporter,
+            [&](int64_t max_rows) {
+                EXPECT_EQ(max_rows, 50001);
+                xy.resize(max_rows * 2);
+                z.resize(max_rows);
+                return std::vector<double *>{xy.data(), z.data()};
+            },
+            &num_lines);
+    ASSERT_EQ(num_rows * 3, static_cast<int64_t>(expected.size()));
+    for (int64_t i = 0; i < num_rows; ++i) {
+        EXPECT_EQ(xy[i * 2], expected[i * 3]);
+        EXPECT_EQ(xy[i * 2 + 1], expected[i * 3 + 1]);
+        EXPECT_EQ(z[i], expected[i * 3 + 2]);
+    }
+
+    mapped_file.Close();
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
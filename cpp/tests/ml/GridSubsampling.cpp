@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/contrib/GridSubsampling.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+using ml::contrib::PointXYZ;
+
+std::vector<float> Flatten(const std::vector<PointXYZ>& points) {
+    std::vector<float> values;
+    for (const PointXYZ& p : points) {
+        values.insert(values.end(), {p.x, p.y, p.z});
+    }
+    return values;
+}
+
+// Points in the cells (0,0,0), (0,0,0), (1,0,0), (0,0,0) and (0,0,1) with two
+// feature and two label channels.
+const std::vector<PointXYZ> points{{0.2, 0.2, 0.2},
+                                   {0.6, 0.6, 0.6},
+                                   {1.5, 0.5, 0.5},
+                                   {0.4, 0.4, 0.4},
+                                   {0.5, 0.5, 1.5}};
+const std::vector<float> features{1, 4, 3, 2, 5, 6, 2, 3, 7, 8};
+const std::vector<int> classes{3, 1, 1, 2, 2, 0, 3, 0, 4, 5};
+
+}  // namespace
+
+TEST(GridSubsampling, GridSubsampling) {
+    std::vector<PointXYZ> in_points = points;
+    std::vector<float> in_features = features;
+    std::vector<int> in_classes = classes;
+    std::vector<PointXYZ> out_points;
+    std::vector<float> out_features;
+    std::vector<int> out_classes;
+
+    // Subsampled points are ordered by cell and label ties go to the smallest
+    // class.
+    ml::contrib::grid_subsampling(in_points, out_points, in_features,
+                                  out_features, in_classes, out_classes, 1.f,
+                                  0);
+    ExpectEQ(Flatten(out_points),
+             std::vector<float>({0.4, 0.4, 0.4, 1.5, 0.5, 0.5, 0.5, 0.5, 1.5}));
+    ExpectEQ(out_features, std::vector<float>({2, 3, 5, 6, 7, 8}));
+    ExpectEQ(out_classes, std::vector<int>({3, 0, 2, 0, 4, 5}));
+
+    // Features and classes are optional.
+    std::vector<float> no_features;
+    std::vector<int> no_classes;
+    out_points.clear();
+    out_features.clear();
+    out_classes.clear();
+    ml::contrib::grid_subsampling(in_points, out_points, no_features,
+                                  out_features, no_classes, out_classes, 2.f,
+                                  0);
+    ExpectEQ(Flatten(out_points), std::vector<float>({0.64, 0.44, 0.64}));
+    EXPECT_TRUE(out_features.empty());
+    EXPECT_TRUE(out_classes.empty());
+}
+
+TEST(GridSubsampling, BatchGridSubsampling) {
+    // The second batch is the first one shifted by one cell with offset
+    // classes.
+    std::vector<PointXYZ> in_points = points;
+    std::vector<float> in_features = features;
+    std::vector<int> in_classes = classes;
+    for (size_t i = 0; i < points.size(); ++i) {
+        in_points.push_back(points[i] + PointXYZ(1, 0, 0));
+        in_features.insert(in_features.end(),
+                           {features[2 * i], features[2 * i + 1]});
+        in_classes.insert(in_classes.end(),
+                          {classes[2 * i] + 10, classes[2 * i + 1] + 10});
+    }
+    std::vector<int> in_batches{5, 5};
+    std::vector<PointXYZ> out_points;
+    std::vector<float> out_features;
+    std::vector<int> out_classes;
+    std::vector<int> out_batches;
+
+    ml::contrib::batch_grid_subsampling(
+            in_points, out_points, in_features, out_features, in_classes,
+            out_classes, in_batches, out_batches, 1.f, 2);
+    EXPECT_EQ(out_batches, std::vector<int>({2, 2}));
+    ExpectEQ(Flatten(out_points),
+             std::vector<float>({0.4, 0.4, 0.4, 1.5, 0.5, 0.5, 1.4, 0.4, 0.4,
+                                 2.5, 0.5, 0.5}));
+    ExpectEQ(out_features, std::vector<float>({2, 3, 5, 6, 2, 3, 5, 6}));
+    ExpectEQ(out_classes, std::vector<int>({3, 0, 2, 0, 13, 10, 12, 10}));
+
+    // max_p < 1 keeps all subsampled points.
+    out_points.clear();
+    out_features.clear();
+    out_classes.clear();
+    out_batches.clear();
+    ml::contrib::batch_grid_subsampling(
+            in_points, out_points, in_features, out_features, in_classes,
+            out_classes, in_batches, out_batches, 1.f, 0);
+    EXPECT_EQ(out_batches, std::vector<int>({3, 3}));
+    EXPECT_EQ(out_points.size(), 6u);
+    EXPECT_EQ(out_classes.size(), 12u);
+}
+
+TEST(GridSubsampling, BatchGridSubsamplingMaxPoints) {
+    // One point per cell in a column along z. The kept cells must cover the
+    // whole column rather than only its bottom.
+    std::vector<PointXYZ> in_points;
+    for (int i = 0; i < 100; ++i) {
+        in_points.emplace_back(0.5, 0.5, i + 0.5);
+    }
+    std::vector<float> no_features;
+    std::vector<int> no_classes;
+    std::vector<int> in_batches{100};
+    std::vector<PointXYZ> out_points;
+    std::vector<float> out_features;
+    std::vector<int> out_classes;
+    std::vector<int> out_batches;
+
+    ml::contrib::batch_grid_subsampling(
+            in_points, out_points, no_features, out_features, no_classes,
+            out_classes, in_batches, out_batches, 1.f, 10);
+    EXPECT_EQ(out_batches, std::vector<int>({10}));
+    ASSERT_EQ(out_points.size(), 10u);
+    float min_z = out_points[0].z;
+    float max_z = out_points[0].z;
+    for (const PointXYZ& p : out_points) {
+        min_z = std::min(min_z, p.z);
+        max_z = std::max(max_z, p.z);
+    }
+    EXPECT_LT(min_z, 10.f);
+    EXPECT_GT(max_z, 90.f);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/misc/VoxelPooling.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct VoxelPoolingOutputAllocator {
+    void AllocPooledPositions(float** ptr, size_t num) {
+        positions.resize(num * 3);
+        *ptr = positions.data();
+    }
+    void AllocPooledFeatures(float** ptr, size_t num, int channels) {
+        features.resize(num * channels);
+        *ptr = features.data();
+    }
+
+    std::vector<float> positions;
+    std::vector<float> features;
+};
+
+// Points in the voxels (0,0,0), (0,0,0), (1,0,0) and (-1,0,0). The second
+// point is closer to the center of its voxel.
+const std::vector<float> positions{0.2, 0.2, 0.2, 0.6,  0.6, 0.6,
+                                   1.5, 0.5, 0.5, -0.5, 0.5, 0.5};
+const std::vector<float> features{1, 4, 3, 2, 5, 6, 7, 8};
+
+}  // namespace
+
+TEST(VoxelPooling, VoxelPooling) {
+    using namespace ml::impl;
+    VoxelPoolingOutputAllocator output;
+
+    // Pooled points are ordered by voxel index.
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, AVERAGE, AVERAGE);
+    ExpectEQ(output.positions, std::vector<float>({-0.5, 0.5, 0.5, 0.4, 0.4,
+                                                   0.4, 1.5, 0.5, 0.5}));
+    ExpectEQ(output.features, std::vector<float>({7, 8, 2, 3, 5, 6}));
+
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, NEAREST_NEIGHBOR, MAX);
+    ExpectEQ(output.positions, std::vector<float>({-0.5, 0.5, 0.5, 0.6, 0.6,
+                                                   0.6, 1.5, 0.5, 0.5}));
+    ExpectEQ(output.features, std::vector<float>({7, 8, 3, 4, 5, 6}));
+
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, CENTER, NEAREST_NEIGHBOR);
+    ExpectEQ(output.positions, std::vector<float>({-0.5, 0.5, 0.5, 0.5, 0.5,
+                                                   0.5, 1.5, 0.5, 0.5}));
+    ExpectEQ(output.features, std::vector<float>({7, 8, 3, 2, 5, 6}));
+
+    VoxelPooling<float, float>(0, positions.data(), 2, features.data(), 1.f,
+                               output, AVERAGE, AVERAGE);
+    EXPECT_TRUE(output.positions.empty());
+    EXPECT_TRUE(output.features.empty());
+}
+
+TEST(VoxelPooling, VoxelPoolingBackprop) {
+    using namespace ml::impl;
+    VoxelPoolingOutputAllocator output;
+    const std::vector<float> pooled_gradient{1, 1, 2, 4, 3, 3};
+    std::vector<float> backprop(features.size());
+
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, AVERAGE, AVERAGE);
+    VoxelPoolingBackprop<float, float>(
+            backprop.data(), 4, positions.data(), 2, features.data(), 3,
+            output.positions.data(), pooled_gradient.data(), 1.f, AVERAGE,
+            AVERAGE);
+    ExpectEQ(backprop, std::vector<float>({1, 2, 1, 2, 3, 3, 1, 1}));
+
+    // Each channel of the maximum feature gets the gradient.
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, AVERAGE, MAX);
+    VoxelPoolingBackprop<float, float>(
+            backprop.data(), 4, positions.data(), 2, features.data(), 3,
+            output.positions.data(), pooled_gradient.data(), 1.f, AVERAGE,
+            MAX);
+    ExpectEQ(backprop, std::vector<float>({0, 4, 2, 0, 3, 3, 1, 1}));
+
+    VoxelPooling<float, float>(4, positions.data(), 2, features.data(), 1.f,
+                               output, AVERAGE, NEAREST_NEIGHBOR);
+    VoxelPoolingBackprop<float, float>(
+            backprop.data(), 4, positions.data(), 2, features.data(), 3,
+            output.positions.data(), pooled_gradient.data(), 1.f, AVERAGE,
+            NEAREST_NEIGHBOR);
+    ExpectEQ(backprop, std::vector<float>({0, 0, 2, 4, 3, 3, 1, 1}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/impl/misc/Voxelize.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct VoxelizeOutputAllocator {
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        voxel_coords.resize(rows * cols);
+        *ptr = voxel_coords.data();
+    }
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t size) {
+        point_indices.resize(size);
+        *ptr = point_indices.data();
+    }
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t size) {
+        row_splits.resize(size);
+        *ptr = row_splits.data();
+    }
+
+    std::vector<int32_t> voxel_coords;
+    std::vector<int64_t> point_indices;
+    std::vector<int64_t> row_splits;
+};
+
+// Three voxels and one point outside of the range. Voxels are ordered by their
+// linear index and points within a voxel by their index.
+const std::vector<float> points{0.5, 0.5, 0.5, 1.5, 0.5, 0.5, 0.2, 0.1, 0.9,
+                                5.0, 5.0, 5.0, 0.7, 0.7, 0.7, 0.5, 2.5, 0.5};
+const float voxel_size[] = {1, 1, 1};
+const float range_min[] = {0, 0, 0};
+const float range_max[] = {4, 4, 4};
+
+}  // namespace
+
+TEST(Voxelize, VoxelizeCPU) {
+    VoxelizeOutputAllocator output;
+    ml::impl::VoxelizeCPU<float, 3>(points.size() / 3, points.data(),
+                                    voxel_size, range_min, range_max, 100,
+                                    100, output);
+    EXPECT_EQ(output.voxel_coords,
+              std::vector<int32_t>({0, 0, 0, 1, 0, 0, 0, 2, 0}));
+    EXPECT_EQ(output.row_splits, std::vector<int64_t>({0, 3, 4, 5}));
+    EXPECT_EQ(output.point_indices, std::vector<int64_t>({0, 2, 4, 1, 5}));
+}
+
+TEST(Voxelize, VoxelizeCPUMaxPointsPerVoxel) {
+    VoxelizeOutputAllocator output;
+    ml::impl::VoxelizeCPU<float, 3>(points.size() / 3, points.data(),
+                                    voxel_size, range_min, range_max, 2, 100,
+                                    output);
+    EXPECT_EQ(output.voxel_coords,
+              std::vector<int32_t>({0, 0, 0, 1, 0, 0, 0, 2, 0}));
+    EXPECT_EQ(output.row_splits, std::vector<int64_t>({0, 2, 3, 4}));
+    EXPECT_EQ(output.point_indices, std::vector<int64_t>({0, 2, 1, 5}));
+}
+
+TEST(Voxelize, VoxelizeCPUMaxVoxels) {
+    VoxelizeOutputAllocator output;
+    ml::impl::VoxelizeCPU<float, 3>(points.size() / 3, points.data(),
+                                    voxel_size, range_min, range_max, 100, 2,
+                                    output);
+    EXPECT_EQ(output.voxel_coords, std::vector<int32_t>({0, 0, 0, 1, 0, 0}));
+    EXPECT_EQ(output.row_splits, std::vector<int64_t>({0, 3, 4}));
+    EXPECT_EQ(output.point_indices, std::vector<int64_t>({0, 2, 4, 1}));
+}
+
+TEST(Voxelize, VoxelizeCPUEmpty) {
+    VoxelizeOutputAllocator output;
+    ml::impl::VoxelizeCPU<float, 3>(0, points.data(), voxel_size, range_min,
+                                    range_max, 100, 100, output);
+    EXPECT_TRUE(output.voxel_coords.empty());
+    EXPECT_EQ(output.row_splits, std::vector<int64_t>({0}));
+    EXPECT_TRUE(output.point_indices.empty());
+
+    // Only points outside of the range.
+    ml::impl::VoxelizeCPU<float, 3>(1, points.data() + 9, voxel_size,
+                                    range_min, range_max, 100, 100, output);
+    EXPECT_TRUE(output.voxel_coords.empty());
+    EXPECT_EQ(output.row_splits, std::vector<int64_t>({0}));
+    EXPECT_TRUE(output.point_indices.empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
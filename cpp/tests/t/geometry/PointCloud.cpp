@@ -28,6 +28,8 @@
 
 #include <gmock/gmock.h>
 
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/geometry/PointCloud.h"
@@ -42,6 +44,12 @@ INSTANTIATE_TEST_SUITE_P(PointCloud,
                          PointCloudPermuteDevices,
                          testing::ValuesIn(PermuteDevices::TestCases()));
 
+class PointCloudPermuteDevicesWithFaiss : public PermuteDevicesWithFaiss {};
+INSTANTIATE_TEST_SUITE_P(
+        PointCloud,
+        PointCloudPermuteDevicesWithFaiss,
+        testing::ValuesIn(PermuteDevicesWithFaiss::TestCases()));
+
 class PointCloudPermuteDevicePairs : public PermuteDevicePairs {};
 INSTANTIATE_TEST_SUITE_P(
         PointCloud,
@@ -408,6 +416,44 @@ TEST_P(PointCloudPermuteDevices, Append) {
     EXPECT_ANY_THROW(pcd2 + pcd);
 }
 
+TEST_P(PointCloudPermuteDevices, Extend) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Float32;
+
+    t::geometry::PointCloud pcd(device);
+    t::geometry::PointCloud expected(device);
+    for (int i = 0; i < 10; ++i) {
+        t::geometry::PointCloud sweep(device);
+        sweep.SetPoints(core::Tensor::Full({i + 1, 3}, i, dtype, device));
+        sweep.SetPointColors(core::Tensor::Full({i + 1, 3}, -i, dtype, device));
+        pcd.Extend(sweep);
+        expected = i == 0 ? sweep : expected + sweep;
+    }
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 55);
+    EXPECT_GE(pcd.GetCapacity(), 55);
+    EXPECT_TRUE(pcd.GetPoints().AllClose(expected.GetPoints()));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(expected.GetPointColors()));
+
+    // A shallow copy is not affected by extending the original.
+    t::geometry::PointCloud copy = pcd;
+    pcd.Extend(pcd);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 110);
+    EXPECT_EQ(copy.GetPoints().GetLength(), 55);
+    EXPECT_TRUE(pcd.GetPoints()
+                        .Slice(0, 55, 110)
+                        .AllClose(copy.GetPoints()));
+
+    t::geometry::PointCloud reserved(device);
+    reserved.SetPoints(core::Tensor::Zeros({0, 3}, dtype, device));
+    reserved.Reserve(100);
+    EXPECT_EQ(reserved.GetCapacity(), 100);
+    EXPECT_EQ(reserved.GetPoints().GetLength(), 0);
+
+    t::geometry::PointCloud missing_colors(device);
+    missing_colors.SetPoints(core::Tensor::Ones({1, 3}, dtype, device));
+    EXPECT_ANY_THROW(pcd.Extend(missing_colors));
+}
+
 TEST_P(PointCloudPermuteDevices, Has) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -644,5 +690,227 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, SelectByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPoints(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.3, 0.3, 0.3}},
+            device));
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true}, device);
+
+    t::geometry::PointCloud pcd_select = pcd.SelectByMask(mask);
+    EXPECT_TRUE(pcd_select.GetPoints().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(pcd_select.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {0.3, 0.3, 0.3}}, device)));
+
+    t::geometry::PointCloud pcd_invert = pcd.SelectByMask(mask, true);
+    EXPECT_TRUE(pcd_invert.GetPoints().AllClose(
+            core::Tensor::Init<float>({{1, 1, 1}, {2, 2, 2}}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {0, 0.1, 0},
+                                                           {0, 0, 0.1},
+                                                           {5, 5, 5}},
+                                                          device));
+    t::geometry::PointCloud pcd_inlier;
+    core::Tensor mask;
+    std::tie(pcd_inlier, mask) = pcd.RemoveRadiusOutliers(2, 0.5);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, true, false}));
+    EXPECT_EQ(pcd_inlier.GetPoints().GetLength(), 4);
+
+    // Same selection as the legacy implementation.
+    auto pcd_legacy = io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                   "/ICP/cloud_bin_2.pcd");
+    std::vector<size_t> legacy_indices;
+    std::tie(std::ignore, legacy_indices) =
+            pcd_legacy->RemoveRadiusOutliers(16, 0.05);
+    std::tie(std::ignore, mask) =
+            t::geometry::PointCloud::FromLegacyPointCloud(*pcd_legacy,
+                                                          core::Float64, device)
+                    .RemoveRadiusOutliers(16, 0.05);
+    std::vector<int64_t> indices(legacy_indices.begin(),
+                                 legacy_indices.end());
+    EXPECT_EQ(mask.NonZero().ToFlatVector<int64_t>(), indices);
+}
+
+TEST_P(PointCloudPermuteDevicesWithFaiss, RemoveStatisticalOutliers) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {0, 0.1, 0},
+                                                           {0, 0, 0.1},
+                                                           {5, 5, 5}},
+                                                          device));
+    t::geometry::PointCloud pcd_inlier;
+    core::Tensor mask;
+    std::tie(pcd_inlier, mask) = pcd.RemoveStatisticalOutliers(3, 1.0);
+    EXPECT_EQ(mask.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, true, false}));
+    EXPECT_EQ(pcd_inlier.GetPoints().GetLength(), 4);
+
+    // Same selection as the legacy implementation.
+    auto pcd_legacy = io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                   "/ICP/cloud_bin_2.pcd");
+    std::vector<size_t> legacy_indices;
+    std::tie(std::ignore, legacy_indices) =
+            pcd_legacy->RemoveStatisticalOutliers(20, 2.0);
+    core::Dtype dtype = device.GetType() == core::Device::DeviceType::CUDA
+                                ? core::Float32
+                                : core::Float64;
+    std::tie(std::ignore, mask) =
+            t::geometry::PointCloud::FromLegacyPointCloud(*pcd_legacy, dtype,
+                                                          device)
+                    .RemoveStatisticalOutliers(20, 2.0);
+    if (dtype == core::Float64) {
+        std::vector<int64_t> indices(legacy_indices.begin(),
+                                     legacy_indices.end());
+        EXPECT_EQ(mask.NonZero().ToFlatVector<int64_t>(), indices);
+    } else {
+        EXPECT_NEAR(mask.To(core::Int64).Sum({0}).Item<int64_t>(),
+                    static_cast<int64_t>(legacy_indices.size()),
+                    legacy_indices.size() / 1000 + 1);
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // A noise point and two clusters, the second one with a border point.
+    t::geometry::PointCloud pcd(core::Tensor::Init<double>({{5, 5, 5},
+                                                            {1, 0, 0},
+                                                            {1.1, 0, 0},
+                                                            {1, 0.1, 0},
+                                                            {0, 0, 0},
+                                                            {0.1, 0, 0},
+                                                            {0, 0.1, 0},
+                                                            {0, 0.25, 0}},
+                                                           device));
+    core::Tensor labels = pcd.ClusterDBSCAN(0.2, 3);
+    EXPECT_EQ(labels.GetDtype(), core::Int32);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_EQ(labels.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-1, 0, 0, 0, 1, 1, 1, 1}));
+
+    // Same labels as the legacy implementation.
+    auto pcd_legacy = io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                   "/ICP/cloud_bin_2.pcd");
+    std::vector<int> legacy_labels = pcd_legacy->ClusterDBSCAN(0.02, 10);
+    labels = t::geometry::PointCloud::FromLegacyPointCloud(*pcd_legacy,
+                                                           core::Float64,
+                                                           device)
+                     .ClusterDBSCAN(0.02, 10);
+    EXPECT_EQ(labels.ToFlatVector<int32_t>(), legacy_labels);
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlane) {
+    core::Device device = GetParam();
+
+    // Points on the plane 0.2x - z + 0.5 = 0 and uniform outliers.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-1, 1);
+    std::vector<float> points;
+    for (int i = 0; i < 1000; ++i) {
+        float x = uniform(rng), y = uniform(rng);
+        points.insert(points.end(), {x, y, 0.2f * x + 0.5f});
+    }
+    for (int i = 0; i < 200; ++i) {
+        points.insert(points.end(), {uniform(rng), uniform(rng), uniform(rng)});
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {1200, 3}, core::Float32, device));
+
+    core::Tensor plane, mask;
+    std::tie(plane, mask) = pcd.SegmentPlane(0.01, 100, 42);
+    std::vector<double> plane_model = plane.ToFlatVector<double>();
+    double scale = plane_model[2] < 0 ? -1 : 1;
+    double norm = std::sqrt(0.2 * 0.2 + 1);
+    EXPECT_NEAR(plane_model[0] * scale, -0.2 / norm, 1e-4);
+    EXPECT_NEAR(plane_model[1] * scale, 0, 1e-4);
+    EXPECT_NEAR(plane_model[2] * scale, 1 / norm, 1e-4);
+    EXPECT_NEAR(plane_model[3] * scale, -0.5 / norm, 1e-4);
+    EXPECT_TRUE(mask.Slice(0, 0, 1000).All());
+    EXPECT_LT(mask.To(core::Int64).Sum({0}).Item<int64_t>(), 1020);
+
+    // The same seed gives the same segmentation.
+    core::Tensor plane_again, mask_again;
+    std::tie(plane_again, mask_again) = pcd.SegmentPlane(0.01, 100, 42);
+    EXPECT_TRUE(plane_again.AllClose(plane, 0, 0));
+    EXPECT_EQ(mask_again.ToFlatVector<bool>(), mask.ToFlatVector<bool>());
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentSphere) {
+    core::Device device = GetParam();
+
+    // Points on the sphere with center (1, 2, 3) and radius 0.5 and uniform
+    // outliers.
+    std::mt19937 rng(0);
+    std::normal_distribution<float> normal(0, 1);
+    std::uniform_real_distribution<float> uniform(0, 4);
+    std::vector<float> points;
+    for (int i = 0; i < 1000; ++i) {
+        Eigen::Vector3f d(normal(rng), normal(rng), normal(rng));
+        d = d.normalized() * 0.5f + Eigen::Vector3f(1, 2, 3);
+        points.insert(points.end(), {d(0), d(1), d(2)});
+    }
+    for (int i = 0; i < 200; ++i) {
+        points.insert(points.end(), {uniform(rng), uniform(rng), uniform(rng)});
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {1200, 3}, core::Float32, device));
+
+    core::Tensor sphere, mask;
+    std::tie(sphere, mask) = pcd.SegmentSphere(0.01, 200, 42);
+    EXPECT_TRUE(sphere.AllClose(
+            core::Tensor::Init<double>({1, 2, 3, 0.5}, device), 0, 1e-3));
+    EXPECT_TRUE(mask.Slice(0, 0, 1000).All());
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentCylinder) {
+    core::Device device = GetParam();
+
+    // Points on the cylinder with axis (1, 0, z) and radius 0.3 and uniform
+    // outliers with random normals.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-1, 1);
+    std::vector<float> points, normals;
+    for (int i = 0; i < 1000; ++i) {
+        float angle = uniform(rng) * 3.14159265f;
+        float cos = std::cos(angle), sin = std::sin(angle);
+        points.insert(points.end(), {1 + 0.3f * cos, 0.3f * sin, uniform(rng)});
+        normals.insert(normals.end(), {cos, sin, 0});
+    }
+    for (int i = 0; i < 200; ++i) {
+        points.insert(points.end(), {uniform(rng), uniform(rng), uniform(rng)});
+        Eigen::Vector3f n(uniform(rng), uniform(rng), uniform(rng));
+        n.normalize();
+        normals.insert(normals.end(), {n(0), n(1), n(2)});
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {1200, 3}, core::Float32, device));
+    pcd.SetPointNormals(
+            core::Tensor(normals, {1200, 3}, core::Float32, device));
+
+    core::Tensor cylinder, mask;
+    std::tie(cylinder, mask) = pcd.SegmentCylinder(0.01, 200, 42);
+    std::vector<double> model = cylinder.ToFlatVector<double>();
+    EXPECT_NEAR(model[0], 1, 1e-3);
+    EXPECT_NEAR(model[1], 0, 1e-3);
+    EXPECT_NEAR(std::abs(model[5]), 1, 1e-3);
+    EXPECT_NEAR(model[6], 0.3, 1e-3);
+    EXPECT_TRUE(mask.Slice(0, 0, 1000).All());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -113,5 +113,115 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, ReserveAndExtend) {
+    core::Dtype dtype = core::Float32;
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points", {{"points", core::Tensor::Zeros({2, 3}, dtype, device)},
+                       {"labels", core::Tensor::Zeros({2}, core::Int32,
+                                                      device)}});
+    EXPECT_EQ(tm.GetCapacity("points"), 2);
+    tm.Reserve(16);
+    EXPECT_EQ(tm.GetCapacity("points"), 16);
+    EXPECT_EQ(tm.GetCapacity("labels"), 16);
+    EXPECT_EQ(tm.at("points").GetLength(), 2);
+
+    const void* data_ptr = tm.at("points").GetDataPtr();
+    std::vector<float> expected_points(2 * 3, 0);
+    std::vector<int> expected_labels(2, 0);
+    for (int i = 1; i <= 20; ++i) {
+        t::geometry::TensorMap other(
+                "points",
+                {{"points", core::Tensor::Full({1, 3}, i, dtype, device)},
+                 {"labels", core::Tensor::Full({1}, i, core::Int32, device)},
+                 {"ignored", core::Tensor::Zeros({1}, dtype, device)}});
+        tm.Extend(other);
+        expected_points.insert(expected_points.end(), 3, float(i));
+        expected_labels.push_back(i);
+        if (tm.at("points").GetLength() <= 16) {
+            // No reallocation within the reserved capacity.
+            EXPECT_EQ(tm.at("points").GetDataPtr(), data_ptr);
+        }
+        EXPECT_GE(tm.GetCapacity("points"), tm.at("points").GetLength());
+    }
+    EXPECT_EQ(tm.size(), 2);
+    EXPECT_EQ(tm.GetCapacity("points"), 32);
+    EXPECT_EQ(tm.at("points").ToFlatVector<float>(), expected_points);
+    EXPECT_EQ(tm.at("labels").ToFlatVector<int>(), expected_labels);
+    tm.AssertSizeSynchronized();
+
+    tm.Clear();
+    EXPECT_EQ(tm.size(), 0);
+    EXPECT_EQ(tm.GetPrimaryKey(), "points");
+}
+
+TEST_P(TensorMapPermuteDevices, ExtendCopyOnWrite) {
+    core::Dtype dtype = core::Float32;
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm0(
+            "points", {{"points", core::Tensor::Zeros({2, 3}, dtype, device)}});
+    tm0.Reserve(8);
+
+    // The shallow copy shares the reserved buffer. Extending one map must not
+    // overwrite the elements the other one appends.
+    t::geometry::TensorMap tm1 = tm0;
+    t::geometry::TensorMap ones(
+            "points", {{"points", core::Tensor::Ones({2, 3}, dtype, device)}});
+    t::geometry::TensorMap twos(
+            "points",
+            {{"points", core::Tensor::Full({2, 3}, 2, dtype, device)}});
+    tm0.Extend(ones);
+    tm1.Extend(twos);
+
+    EXPECT_TRUE(tm0.at("points").AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0, 0, 0}, {1, 1, 1}, {1, 1, 1}}, device)));
+    EXPECT_TRUE(tm1.at("points").AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0, 0, 0}, {2, 2, 2}, {2, 2, 2}}, device)));
+
+    // Tensors taken from a map are not modified by later extensions.
+    core::Tensor points = tm0.at("points");
+    tm0.Extend(twos);
+    EXPECT_EQ(points.GetLength(), 4);
+    EXPECT_EQ(tm0.at("points").GetLength(), 6);
+
+    // Replacing a tensor detaches it from its reserved buffer.
+    tm1["points"] = core::Tensor::Ones({1, 3}, dtype, device);
+    EXPECT_EQ(tm1.GetCapacity("points"), 1);
+    tm1.Extend(twos);
+    EXPECT_TRUE(tm1.at("points").AllClose(core::Tensor::Init<float>(
+            {{1, 1, 1}, {2, 2, 2}, {2, 2, 2}}, device)));
+}
+
+TEST_P(TensorMapPermuteDevices, ExtendMismatch) {
+    core::Dtype dtype = core::Float32;
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points", {{"points", core::Tensor::Zeros({2, 3}, dtype, device)},
+                       {"colors", core::Tensor::Zeros({2, 3}, dtype, device)}});
+    t::geometry::TensorMap missing(
+            "points", {{"points", core::Tensor::Ones({2, 3}, dtype, device)}});
+    t::geometry::TensorMap wrong_shape(
+            "points", {{"points", core::Tensor::Ones({2, 3}, dtype, device)},
+                       {"colors", core::Tensor::Ones({2, 4}, dtype, device)}});
+    t::geometry::TensorMap wrong_dtype(
+            "points",
+            {{"points", core::Tensor::Ones({2, 3}, core::Float64, device)},
+             {"colors", core::Tensor::Ones({2, 3}, dtype, device)}});
+    EXPECT_ANY_THROW(tm.Extend(missing));
+    EXPECT_ANY_THROW(tm.Extend(wrong_shape));
+    EXPECT_ANY_THROW(tm.Extend(wrong_dtype));
+    EXPECT_EQ(tm.at("points").GetLength(), 2);
+    EXPECT_EQ(tm.at("colors").GetLength(), 2);
+
+    // An empty map takes the tensors of the appended map.
+    t::geometry::TensorMap empty("points");
+    empty.Extend(tm);
+    EXPECT_EQ(empty.size(), 2);
+    EXPECT_EQ(empty.at("points").GetLength(), 2);
+}
+
 }  // namespace tests
 }  // namespace open3d
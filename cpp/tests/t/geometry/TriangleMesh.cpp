@@ -368,5 +368,47 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacyTriangleMesh) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, Extend) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(device);
+    t::geometry::TriangleMesh quad(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}}, device));
+    mesh.Extend(quad);
+    mesh.Extend(quad);
+    mesh.Extend(quad);
+
+    EXPECT_EQ(mesh.GetVertices().GetLength(), 12);
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(core::Tensor::Init<int64_t>(
+            {{0, 1, 2},
+             {0, 2, 3},
+             {4, 5, 6},
+             {4, 6, 7},
+             {8, 9, 10},
+             {8, 10, 11}},
+            device)));
+    // The appended mesh is unchanged.
+    EXPECT_TRUE(quad.GetTriangles().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}}, device)));
+
+    mesh.Reserve(100, 200);
+    EXPECT_EQ(mesh.GetVertices().GetLength(), 12);
+    EXPECT_EQ(mesh.GetTriangles().GetLength(), 6);
+}
+
+TEST_P(TriangleMeshPermuteDevices, Clone) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Zeros({3, 3}, core::Float32, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    t::geometry::TriangleMesh clone = mesh.Clone();
+    clone.GetVertices().Fill(1);
+    EXPECT_TRUE(mesh.GetVertices().AllClose(
+            core::Tensor::Zeros({3, 3}, core::Float32, device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/GeometryArchiveIO.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class GeometryArchiveIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(GeometryArchiveIO,
+                         GeometryArchiveIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// A grid of 100 x 100 x n points with attributes of different dtypes.
+static t::geometry::PointCloud CreatePointCloud(int64_t num_points,
+                                                const core::Device &device) {
+    core::Tensor points({num_points, 3}, core::Float32);
+    float *points_ptr = points.GetDataPtr<float>();
+    for (int64_t i = 0; i < num_points; i++) {
+        points_ptr[i * 3 + 0] = static_cast<float>(i % 100);
+        points_ptr[i * 3 + 1] = static_cast<float>(i / 100 % 100);
+        points_ptr[i * 3 + 2] = static_cast<float>(i / 10000);
+    }
+    const core::Tensor index =
+            core::Tensor::Arange(0, num_points, 1, core::Int64, device);
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPoints(points.To(device));
+    pcd.SetPointColors((index.Reshape({num_points, 1}) *
+                        core::Tensor::Init<int64_t>({{1, 3, 7}}, device))
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     index.To(core::Float64).Reshape({num_points, 1}) / 7);
+    pcd.SetPointAttr("labels", index - index / 5 * 5);
+    pcd.SetPointAttr("index", index);
+    return pcd;
+}
+
+// Sorts the points by their "index" attribute.
+static t::geometry::PointCloud SortByIndex(const t::geometry::PointCloud &pcd) {
+    const core::Tensor index = pcd.GetPointAttr("index").Contiguous();
+    const int64_t *index_ptr = index.GetDataPtr<int64_t>();
+    std::vector<int64_t> order(index.GetLength());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return index_ptr[a] < index_ptr[b];
+    });
+    const core::Tensor order_tensor(order, {index.GetLength()}, core::Int64);
+    t::geometry::PointCloud sorted;
+    for (const auto &it : pcd.GetPointAttr()) {
+        sorted.SetPointAttr(it.first, it.second.IndexGet({order_tensor}));
+    }
+    return sorted;
+}
+
+TEST_P(GeometryArchiveIOPermuteDevices, ReadWritePointCloud) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "test_point_cloud.o3dga";
+    const t::geometry::PointCloud pcd = CreatePointCloud(5000, device);
+
+    for (const bool compressed : {true, false}) {
+        SCOPED_TRACE(fmt::format("compressed {}", compressed));
+        t::io::GeometryArchiveOption option;
+        option.chunk_size = 1000;
+        option.compressed = compressed;
+        option.spatial_chunks = false;
+        ASSERT_TRUE(t::io::WritePointCloudToArchive(file_name, pcd, option));
+        t::geometry::PointCloud pcd_read;
+        ASSERT_TRUE(t::io::ReadPointCloudFromArchive(file_name, pcd_read));
+        EXPECT_EQ(pcd_read.GetPointAttr().size(), pcd.GetPointAttr().size());
+        for (const auto &it : pcd.GetPointAttr()) {
+            SCOPED_TRACE(it.first);
+            const core::Tensor &values = pcd_read.GetPointAttr(it.first);
+            EXPECT_EQ(values.GetDtype(), it.second.GetDtype());
+            EXPECT_EQ(values.GetShape(), it.second.GetShape());
+            EXPECT_TRUE(values.AllClose(it.second.To(core::Device("CPU:0")),
+                                        0, 0));
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+TEST_P(GeometryArchiveIOPermuteDevices, ReadPointCloudInBox) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "test_point_cloud_box.o3dga";
+    const int64_t num_points = 100000;
+    const t::geometry::PointCloud pcd = CreatePointCloud(num_points, device);
+
+    t::io::GeometryArchiveOption option;
+    option.chunk_size = 512;
+    ASSERT_TRUE(t::io::WritePointCloudToArchive(file_name, pcd, option));
+
+    // Points are reordered into spatial chunks.
+    t::geometry::PointCloud pcd_read;
+    ASSERT_TRUE(t::io::ReadPointCloudFromArchive(file_name, pcd_read));
+    const t::geometry::PointCloud pcd_sorted = SortByIndex(pcd_read);
+    for (const auto &it : pcd.GetPointAttr()) {
+        SCOPED_TRACE(it.first);
+        EXPECT_TRUE(pcd_sorted.GetPointAttr(it.first).AllClose(
+                it.second.To(core::Device("CPU:0")), 0, 0));
+    }
+
+    const core::Tensor min_bound = core::Tensor::Init<double>({10, 20, 2});
+    const core::Tensor max_bound = core::Tensor::Init<double>({30, 25, 3});
+    t::geometry::PointCloud pcd_box;
+    ASSERT_TRUE(t::io::ReadPointCloudFromArchive(file_name, pcd_box, min_bound,
+                                                 max_bound));
+    // x in [10, 30], y in [20, 25] and z in [2, 3].
+    EXPECT_EQ(pcd_box.GetPoints().GetLength(), 21 * 6 * 2);
+    const t::geometry::PointCloud pcd_box_sorted = SortByIndex(pcd_box);
+    const int64_t *index_ptr =
+            pcd_box_sorted.GetPointAttr("index").GetDataPtr<int64_t>();
+    std::vector<int64_t> expected_index;
+    for (int64_t z = 2; z <= 3; z++) {
+        for (int64_t y = 20; y <= 25; y++) {
+            for (int64_t x = 10; x <= 30; x++) {
+                expected_index.push_back(z * 10000 + y * 100 + x);
+            }
+        }
+    }
+    EXPECT_EQ(std::vector<int64_t>(index_ptr,
+                                   index_ptr + pcd_box.GetPoints().GetLength()),
+              expected_index);
+    const core::Tensor expected_index_tensor(
+            expected_index, {int64_t(expected_index.size())}, core::Int64);
+    for (const auto &it : pcd.GetPointAttr()) {
+        SCOPED_TRACE(it.first);
+        EXPECT_TRUE(pcd_box_sorted.GetPointAttr(it.first).AllClose(
+                it.second.To(core::Device("CPU:0"))
+                        .IndexGet({expected_index_tensor}),
+                0, 0));
+    }
+
+    // An empty box.
+    ASSERT_TRUE(t::io::ReadPointCloudFromArchive(
+            file_name, pcd_box, min_bound + 1000, max_bound + 1000));
+    EXPECT_EQ(pcd_box.GetPoints().GetLength(), 0);
+    std::remove(file_name.c_str());
+}
+
+TEST_P(GeometryArchiveIOPermuteDevices, ReadWriteTriangleMesh) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "test_mesh.o3dga";
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertices(core::Tensor::Init<double>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.5, 0, 0}, {0, 0.5, 0}, {1, 1, 1}}, device));
+    mesh.SetTriangles(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {2, 1, 3}}, device));
+    mesh.SetTriangleAttr("labels",
+                         core::Tensor::Init<int32_t>({3, 4}, device));
+
+    t::io::GeometryArchiveOption option;
+    option.chunk_size = 3;
+    ASSERT_TRUE(t::io::WriteTriangleMeshToArchive(file_name, mesh, option));
+    t::geometry::TriangleMesh mesh_read;
+    ASSERT_TRUE(t::io::ReadTriangleMeshFromArchive(file_name, mesh_read));
+    for (const auto &it : mesh.GetVertexAttr()) {
+        EXPECT_TRUE(mesh_read.GetVertexAttr(it.first).AllClose(
+                it.second.To(core::Device("CPU:0")), 0, 0));
+    }
+    for (const auto &it : mesh.GetTriangleAttr()) {
+        EXPECT_TRUE(mesh_read.GetTriangleAttr(it.first).AllClose(
+                it.second.To(core::Device("CPU:0")), 0, 0));
+    }
+
+    // A mesh archive is not a point cloud.
+    t::geometry::PointCloud pcd;
+    EXPECT_FALSE(t::io::ReadPointCloudFromArchive(file_name, pcd));
+    std::remove(file_name.c_str());
+}
+
+TEST(GeometryArchiveIO, ReadInvalidFile) {
+    const std::string file_name = "test_invalid.o3dga";
+    FILE *file = fopen(file_name.c_str(), "wb");
+    fprintf(file, "not an archive");
+    fclose(file);
+    t::geometry::PointCloud pcd;
+    EXPECT_FALSE(t::io::ReadPointCloudFromArchive(file_name, pcd));
+    EXPECT_FALSE(t::io::ReadPointCloudFromArchive("does_not_exist.o3dga", pcd));
+    std::remove(file_name.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
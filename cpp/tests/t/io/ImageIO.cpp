@@ -28,6 +28,10 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <string>
+#include <vector>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -102,6 +106,117 @@ TEST(ImageIO, CreateImageFromFile) {
     RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
 }
 
+TEST(ImageIO, PrefetchImages) {
+    WriteTestImage(CreateTestImage());
+    std::vector<std::string> filenames = {
+            std::string(TEST_DATA_DIR) + "/test_imageio.png",
+            std::string(TEST_DATA_DIR) + "/test_imageio.jpg",
+            std::string(TEST_DATA_DIR) + "/test_imageio.png"};
+    t::geometry::Image test_img = CreateTestImage();
+
+    auto images = t::io::PrefetchImages(filenames);
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        EXPECT_TRUE(images->HasNext());
+        t::geometry::Image img = images->Next();
+        EXPECT_EQ(img.GetRows(), 150);
+        EXPECT_EQ(img.GetCols(), 100);
+        EXPECT_EQ(img.GetChannels(), 3);
+        EXPECT_EQ(img.GetDtype(), core::UInt8);
+        EXPECT_TRUE(img.AsTensor().AllClose(test_img.AsTensor()));
+    }
+    EXPECT_FALSE(images->HasNext());
+
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.jpg");
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
+}
+
+TEST(ImageIO, PrefetchImagesMissingFile) {
+    auto images = t::io::PrefetchImages(
+            {std::string(TEST_DATA_DIR) + "/does_not_exist.png"});
+    EXPECT_ANY_THROW(images->Next());
+}
+
+TEST(ImageIO, PrefetchImagesCorruptFile) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_imageio_corrupt.png";
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << "not a png image";
+    }
+    auto images = t::io::PrefetchImages({filename});
+    EXPECT_ANY_THROW(images->Next());
+    RemoveTestImage(filename);
+}
+
+TEST(ImageIO, ReadWriteImages) {
+    t::geometry::Image test_img = CreateTestImage();
+    std::vector<std::string> filenames;
+    for (int i = 0; i < 4; ++i) {
+        filenames.push_back(std::string(TEST_DATA_DIR) + "/test_imageio_" +
+                            std::to_string(i) + ".png");
+    }
+    std::vector<t::geometry::Image> images;
+    for (int i = 0; i < 4; ++i) {
+        images.push_back(t::geometry::Image(test_img.AsTensor() / (i + 1)));
+    }
+    EXPECT_TRUE(t::io::WriteImages(filenames, images));
+    EXPECT_FALSE(t::io::WriteImages(filenames, {test_img}));
+
+    core::Tensor batch;
+    EXPECT_TRUE(t::io::ReadImages(filenames, batch));
+    EXPECT_EQ(batch.GetShape(), core::SizeVector({4, 150, 100, 3}));
+    EXPECT_EQ(batch.GetDtype(), core::UInt8);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(batch[i].AllClose(images[i].AsTensor()));
+    }
+
+    // A buffer of the right shape is decoded into in place.
+    void *data_ptr = batch.GetDataPtr();
+    batch.Fill(0);
+    EXPECT_TRUE(t::io::ReadImages(filenames, batch));
+    EXPECT_EQ(batch.GetDataPtr(), data_ptr);
+    EXPECT_TRUE(batch[3].AllClose(images[3].AsTensor()));
+
+    // PNG images can not be downscaled.
+    EXPECT_FALSE(t::io::ReadImages(filenames, batch, 2));
+
+    // All images must have the same shape.
+    t::io::WriteImage(filenames[2], t::geometry::Image(75, 50, 3, core::UInt8));
+    EXPECT_FALSE(t::io::ReadImages(filenames, batch));
+
+    for (const std::string &filename : filenames) {
+        RemoveTestImage(filename);
+    }
+}
+
+TEST(ImageIO, ReadImagesDownscaleJPG) {
+    WriteTestImage(CreateTestImage());
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_imageio.jpg";
+    t::geometry::Image test_img = CreateTestImage();
+
+    core::Tensor batch;
+    EXPECT_TRUE(t::io::ReadImages({filename, filename}, batch));
+    EXPECT_EQ(batch.GetShape(), core::SizeVector({2, 150, 100, 3}));
+    EXPECT_TRUE(batch[1].AllClose(test_img.AsTensor()));
+
+    for (int downscale : {2, 4, 8}) {
+        EXPECT_TRUE(t::io::ReadImages({filename, filename}, batch, downscale));
+        // libjpeg rounds the scaled size up.
+        EXPECT_EQ(batch.GetShape(),
+                  core::SizeVector({2, (150 + downscale - 1) / downscale,
+                                    (100 + downscale - 1) / downscale, 3}));
+        // The test image has a constant color, which survives scaling.
+        core::Tensor diff = batch[0].To(core::Int32) -
+                            core::Tensor::Init<int32_t>({250, 150, 200});
+        EXPECT_LE(diff.Abs().Max({0, 1, 2}).Item<int32_t>(), 2);
+    }
+    EXPECT_FALSE(t::io::ReadImages({filename}, batch, 3));
+
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.jpg");
+    RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
+}
+
 TEST(ImageIO, ReadImage) {
     WriteTestImage(CreateTestImage());
     t::geometry::Image img;
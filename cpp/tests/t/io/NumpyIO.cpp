@@ -98,5 +98,60 @@ TEST_P(NumpyIOPermuteDevices, NpyIO) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(NumpyIOPermuteDevices, NpyMmap) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Arange(0, 300, 1, core::Float32, device)
+                             .Reshape({100, 3});
+    t.Save(file_name);
+
+    {
+        core::Tensor t_map =
+                t::io::ReadNpy(file_name, t::io::NpyMapMode::ReadOnly);
+        EXPECT_EQ(t_map.GetDevice(), core::Device("CPU:0"));
+        EXPECT_EQ(t_map.GetShape(), core::SizeVector({100, 3}));
+        EXPECT_TRUE(t_map.IsContiguous());
+        EXPECT_TRUE(t_map.To(device).AllClose(t));
+
+        // Views and gathers read from the mapping.
+        core::Tensor t_slice = t_map.Slice(0, 10, 20);
+        EXPECT_EQ(t_slice.GetDataPtr(),
+                  static_cast<const char *>(t_map.GetDataPtr()) +
+                          10 * 3 * sizeof(float));
+        EXPECT_TRUE(t_slice.To(device).AllClose(t.Slice(0, 10, 20)));
+        core::Tensor indices = core::Tensor::Init<int64_t>({99, 0, 42});
+        EXPECT_TRUE(t_map.IndexGet({indices})
+                            .To(device)
+                            .AllClose(t.IndexGet({indices.To(device)})));
+
+        // The mapping stays valid while any view is alive.
+        t_map = core::Tensor();
+        EXPECT_EQ(t_slice.ToFlatVector<float>()[0], 30);
+    }
+
+    // Writes to a copy-on-write mapping are not stored to the file.
+    core::Tensor t_cow =
+            t::io::ReadNpy(file_name, t::io::NpyMapMode::CopyOnWrite);
+    t_cow.Slice(0, 0, 1).Fill(-1);
+    EXPECT_EQ(t_cow.ToFlatVector<float>()[0], -1);
+    EXPECT_TRUE(t::io::ReadNpy(file_name).To(device).AllClose(t));
+
+    // {} and {0} tensors.
+    t = core::Tensor::Init<float>(3.14, device);
+    t.Save(file_name);
+    EXPECT_TRUE(t::io::ReadNpy(file_name, t::io::NpyMapMode::ReadOnly)
+                        .To(device)
+                        .AllClose(t));
+    t = core::Tensor::Ones({0, 3}, core::Float32, device);
+    t.Save(file_name);
+    EXPECT_EQ(t::io::ReadNpy(file_name, t::io::NpyMapMode::ReadOnly)
+                      .GetShape(),
+              core::SizeVector({0, 3}));
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
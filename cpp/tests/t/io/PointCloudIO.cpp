@@ -28,6 +28,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
@@ -82,6 +85,18 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.pcd",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 3
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 4
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -192,6 +207,186 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+TEST(TPointCloudIO, PrefetchPointClouds) {
+    const std::vector<std::string> filenames{
+            std::string(TEST_DATA_DIR) + "/test_sample_ascii.ply",
+            std::string(TEST_DATA_DIR) + "/test_sample_custom.ply",
+            std::string(TEST_DATA_DIR) + "/test_sample_ascii.ply"};
+    auto pcds = t::io::PrefetchPointClouds(filenames, core::Device("CPU:0"),
+                                           {"auto", false, false, false});
+    for (const std::string &filename : filenames) {
+        t::geometry::PointCloud expected;
+        t::io::ReadPointCloud(filename, expected,
+                              {"auto", false, false, false});
+        EXPECT_TRUE(pcds->HasNext());
+        t::geometry::PointCloud pcd = pcds->Next();
+        EXPECT_TRUE(pcd.GetPoints().AllClose(expected.GetPoints()));
+        EXPECT_EQ(pcd.HasPointAttr("intensity"),
+                  expected.HasPointAttr("intensity"));
+    }
+    EXPECT_FALSE(pcds->HasNext());
+}
+
+TEST(TPointCloudIO, PrefetchPointCloudsMissingFile) {
+    const std::vector<std::string> filenames{
+            std::string(TEST_DATA_DIR) + "/test_sample_ascii.ply",
+            std::string(TEST_DATA_DIR) + "/does_not_exist.ply"};
+    auto pcds = t::io::PrefetchPointClouds(filenames, core::Device("CPU:0"),
+                                           {"auto", false, false, false});
+    EXPECT_EQ(pcds->Next().GetPoints().GetLength(), 7);
+    EXPECT_ANY_THROW(pcds->Next());
+}
+
+TEST(TPointCloudIO, PrefetchPointCloudsCorruptFile) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_prefetch_corrupt.ply";
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << "ply\nformat binary_little_endian 1.0\nelement vertex";
+    }
+    auto pcds = t::io::PrefetchPointClouds({filename}, core::Device("CPU:0"),
+                                           {"auto", false, false, false});
+    EXPECT_ANY_THROW(pcds->Next());
+    std::remove(filename.c_str());
+}
+
+// Binary files are read from a memory mapping, ASCII files with rply. Both
+// must give the same point cloud.
+TEST(TPointCloudIO, ReadBinaryPLYMatchesASCII) {
+    const std::vector<std::vector<double>> vertices{
+            {0.5, -3, 1.25, -2.5, 10, 20, 30, 0.125},
+            {-1, 7, 2.75, 3.5, 40, 50, 60, -8},
+            {1024, 65, -0.25, 0, 255, 0, 128, 1e-3}};
+    auto header = [&](const std::string &format) {
+        return "ply\nformat " + format +
+               " 1.0\ncomment test\nelement camera 1\nproperty float view\n"
+               "property uchar flag\nelement vertex 3\nproperty float x\n"
+               "property short label\nproperty float y\nproperty float z\n"
+               "property uchar red\nproperty uchar green\n"
+               "property uchar blue\nproperty double quality\n"
+               "element face 1\nproperty list uchar int vertex_indices\n"
+               "end_header\n";
+    };
+    const std::string ascii_file_name =
+            std::string(TEST_DATA_DIR) + "/test_ascii.ply";
+    const std::string binary_file_name =
+            std::string(TEST_DATA_DIR) + "/test_binary.ply";
+    {
+        std::ofstream ascii_file(ascii_file_name);
+        ascii_file << header("ascii") << "1.5 7\n";
+        for (const auto &v : vertices) {
+            ascii_file << v[0] << " " << v[1] << " " << v[2] << " " << v[3]
+                       << " " << v[4] << " " << v[5] << " " << v[6] << " "
+                       << v[7] << "\n";
+        }
+        ascii_file << "3 0 1 2\n";
+
+        std::ofstream binary_file(binary_file_name, std::ios::binary);
+        auto write = [&](auto value) {
+            binary_file.write(reinterpret_cast<const char *>(&value),
+                              sizeof(value));
+        };
+        binary_file << header("binary_little_endian");
+        write(1.5f);
+        write(uint8_t(7));
+        for (const auto &v : vertices) {
+            write(float(v[0]));
+            write(int16_t(v[1]));
+            write(float(v[2]));
+            write(float(v[3]));
+            write(uint8_t(v[4]));
+            write(uint8_t(v[5]));
+            write(uint8_t(v[6]));
+            write(double(v[7]));
+        }
+        write(uint8_t(3));
+        write(int32_t(0));
+        write(int32_t(1));
+        write(int32_t(2));
+    }
+
+    t::geometry::PointCloud pcd_ascii, pcd_binary;
+    EXPECT_TRUE(t::io::ReadPointCloud(ascii_file_name, pcd_ascii,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(t::io::ReadPointCloud(binary_file_name, pcd_binary,
+                                      {"auto", false, false, false}));
+    EXPECT_FALSE(pcd_binary.HasPointAttr("label"));
+    EXPECT_TRUE(pcd_binary.GetPoints().AllClose(
+            core::Tensor::Init<float>(
+                    {{0.5, 1.25, -2.5}, {-1, 2.75, 3.5}, {1024, -0.25, 0}}),
+            0, 0));
+    for (const std::string attr : {"points", "colors", "quality"}) {
+        SCOPED_TRACE(attr);
+        EXPECT_EQ(pcd_binary.GetPointAttr(attr).GetDtype(),
+                  pcd_ascii.GetPointAttr(attr).GetDtype());
+        EXPECT_TRUE(pcd_binary.GetPointAttr(attr).AllClose(
+                pcd_ascii.GetPointAttr(attr), 0, 0));
+    }
+    std::remove(ascii_file_name.c_str());
+    std::remove(binary_file_name.c_str());
+}
+
+// Binary PLY files keep the dtypes of all attributes.
+TEST(TPointCloudIO, ReadWritePLYNativeDtypes) {
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                          .Reshape({num_points, 3}) *
+                  0.25);
+    pcd.SetPointNormals(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) /
+            3);
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensity",
+                     core::Tensor::Arange(0, num_points, 1, core::Float32)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr("label",
+                     core::Tensor::Arange(0, num_points, 1, core::Int32)
+                             .Reshape({num_points, 1}));
+
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.ply";
+    for (const bool write_ascii : {true, false}) {
+        SCOPED_TRACE(fmt::format("ascii {}", write_ascii));
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {write_ascii}));
+        EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                          {"auto", false, false, false}));
+        for (const std::string attr :
+             {"points", "normals", "colors", "intensity", "label"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(pcd_read.GetPointAttr(attr).GetDtype(),
+                      pcd.GetPointAttr(attr).GetDtype());
+            // ASCII files store 6 significant digits.
+            const double tolerance = write_ascii ? 1e-5 : 0;
+            EXPECT_TRUE(pcd_read.GetPointAttr(attr).AllClose(
+                    pcd.GetPointAttr(attr), tolerance, tolerance));
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+// Interleaved binary PLY vertex properties are strided views of one mapping.
+TEST(TPointCloudIO, ReadPLYStridedViews) {
+    t::geometry::PointCloud pcd, pcd_read;
+    pcd.SetPoints(core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}));
+    pcd.SetPointAttr("intensity", core::Tensor::Init<float>({{7}, {8}}));
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.ply";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, false}));
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    const core::Tensor points = pcd_read.GetPoints();
+    const core::Tensor intensity = pcd_read.GetPointAttr("intensity");
+    EXPECT_EQ(points.GetStrides(), core::SizeVector({4, 1}));
+    EXPECT_EQ(intensity.GetStrides(), core::SizeVector({4, 1}));
+    EXPECT_EQ(points.GetBlob(), intensity.GetBlob());
+    EXPECT_TRUE(points.AllClose(pcd.GetPoints(), 0, 0));
+    EXPECT_TRUE(intensity.AllClose(pcd.GetPointAttr("intensity"), 0, 0));
+    std::remove(file_name.c_str());
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -313,6 +508,175 @@ TEST(TPointCloudIO, WritePTSColorConversion2) {
     std::remove(file_name.c_str());
 }
 
+TEST(TPointCloudIO, ReadPointCloudFromXYZN) {
+    t::geometry::PointCloud pcd;
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_read.xyzn";
+    std::ofstream(file_name) << "1 2 3 0 0 1\n"
+                             << "# comment\n"
+                             << "4.5 -5e1 6 1 0 0 extra\r\n"
+                             << "7 8 9\n"
+                             << "0x1p1 2 3 0 1 0";
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd.GetPoints().GetDtype(), core::Float64);
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<double>(),
+              std::vector<double>({1, 2, 3, 4.5, -50, 6, 2, 2, 3}));
+    EXPECT_EQ(pcd.GetPointNormals().ToFlatVector<double>(),
+              std::vector<double>({0, 0, 1, 1, 0, 0, 0, 1, 0}));
+    EXPECT_FALSE(pcd.HasPointColors());
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, ReadPointCloudFromXYZRGB) {
+    t::geometry::PointCloud pcd;
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_read.xyzrgb";
+    std::ofstream(file_name) << "1 2 3 0.5 0 1\n4 5 6 1 0.25 0\n";
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<double>(),
+              std::vector<double>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(pcd.GetPointColors().ToFlatVector<double>(),
+              std::vector<double>({0.5, 0, 1, 1, 0.25, 0}));
+    std::remove(file_name.c_str());
+}
+
+// Points with nan or inf coordinates are removed on request.
+TEST(TPointCloudIO, ReadPointCloudRemoveNonFinite) {
+    t::geometry::PointCloud pcd;
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_read.xyz";
+    std::ofstream(file_name) << "1 2 3\nnan 0 0\n4 5 6\n0 -inf 0\n7 8 9\n";
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 5);
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", true, false, false}));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 4);
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, true, false}));
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 4);
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", true, true, false}));
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<double>(),
+              std::vector<double>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    std::remove(file_name.c_str());
+}
+
+// PCD fields are read with their own dtype.
+TEST(TPointCloudIO, ReadWritePCDNativeDtypes) {
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                          .Reshape({num_points, 3}) *
+                  0.25);
+    pcd.SetPointNormals(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) /
+            3);
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float32)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr("ring", core::Tensor::Arange(0, num_points, 1, core::Int64)
+                                     .Reshape({num_points, 1})
+                                     .To(core::UInt16));
+
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.pcd";
+    for (const auto &write_option :
+         std::vector<std::pair<bool, bool>>{{true, false},
+                                            {false, false},
+                                            {false, true}}) {
+        SCOPED_TRACE(fmt::format("ascii {} compressed {}", write_option.first,
+                                 write_option.second));
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::WritePointCloud(
+                file_name, pcd, {write_option.first, write_option.second}));
+        EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                          {"auto", false, false, false}));
+        for (const std::string attr :
+             {"points", "normals", "colors", "intensities", "ring"}) {
+            SCOPED_TRACE(attr);
+            EXPECT_EQ(pcd_read.GetPointAttr(attr).GetDtype(),
+                      pcd.GetPointAttr(attr).GetDtype());
+            EXPECT_TRUE(pcd_read.GetPointAttr(attr).AllClose(
+                    pcd.GetPointAttr(attr), 0, 0));
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+// Binary PCD data is mapped into memory, changing the point cloud does not
+// change the file.
+TEST(TPointCloudIO, ReadPCDCopyOnWrite) {
+    t::geometry::PointCloud pcd, pcd_read, pcd_reread;
+    pcd.SetPoints(core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}));
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.pcd";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, false}));
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    pcd_read.GetPoints().Add_(1);
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_reread,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_reread.GetPoints().AllClose(pcd.GetPoints(), 0, 0));
+    EXPECT_TRUE(pcd_read.GetPoints().AllClose(pcd.GetPoints() + 1, 0, 0));
+    std::remove(file_name.c_str());
+}
+
+// Interleaved binary PCD fields are strided views of one mapping.
+TEST(TPointCloudIO, ReadPCDStridedViews) {
+    t::geometry::PointCloud pcd, pcd_read;
+    pcd.SetPoints(core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}));
+    pcd.SetPointAttr("intensities", core::Tensor::Init<float>({{7}, {8}}));
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.pcd";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, false}));
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    const core::Tensor points = pcd_read.GetPoints();
+    const core::Tensor intensities = pcd_read.GetPointAttr("intensities");
+    EXPECT_EQ(points.GetStrides(), core::SizeVector({4, 1}));
+    EXPECT_EQ(intensities.GetStrides(), core::SizeVector({4, 1}));
+    EXPECT_EQ(points.GetBlob(), intensities.GetBlob());
+    EXPECT_TRUE(points.AllClose(pcd.GetPoints(), 0, 0));
+    EXPECT_TRUE(intensities.AllClose(pcd.GetPointAttr("intensities"), 0, 0));
+    std::remove(file_name.c_str());
+}
+
+// Compressed data is split into chunks, which must be readable as one LZF
+// stream by the legacy reader.
+TEST(TPointCloudIO, ReadWriteLargeCompressedPCD) {
+    const int64_t num_points = 200000;
+    t::geometry::PointCloud pcd, pcd_read;
+    pcd.SetPoints(core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                          .Reshape({num_points, 3}));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                             .Reshape({num_points, 1}));
+    const std::string file_name = std::string(TEST_DATA_DIR) + "/test.pcd";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, true}));
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_read.GetPoints().AllClose(pcd.GetPoints(), 0, 0));
+    EXPECT_TRUE(pcd_read.GetPointAttr("intensities")
+                        .AllClose(pcd.GetPointAttr("intensities"), 0, 0));
+
+    geometry::PointCloud legacy_pcd;
+    EXPECT_TRUE(io::ReadPointCloud(file_name, legacy_pcd));
+    EXPECT_TRUE(
+            t::geometry::PointCloud::FromLegacyPointCloud(legacy_pcd,
+                                                          core::Float32)
+                    .GetPoints()
+                    .AllClose(pcd.GetPoints(), 0, 0));
+
+    // Files written by the legacy writer have a single LZF stream.
+    EXPECT_TRUE(io::WritePointCloud(file_name, legacy_pcd, {false, true}));
+    pcd_read.Clear();
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_read.GetPoints().AllClose(pcd.GetPoints(), 0, 0));
+    std::remove(file_name.c_str());
+}
+
 TEST_P(PointCloudIOPermuteDevices, WriteDeviceTestPLY) {
     core::Device device = GetParam();
     std::string filename = std::string(TEST_DATA_DIR) + "/test_write.ply";
@@ -322,5 +322,62 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryContext) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    std::vector<t::geometry::RGBDImage> frames;
+    for (const std::string index : {"00000", "00001", "00002"}) {
+        t::geometry::RGBDImage frame;
+        frame.depth_ = t::io::CreateImageFromFile(std::string(TEST_DATA_DIR) +
+                                                  "/RGBD/depth/" + index +
+                                                  ".png")
+                               ->To(device);
+        frame.color_ = t::io::CreateImageFromFile(std::string(TEST_DATA_DIR) +
+                                                  "/RGBD/color/" + index +
+                                                  ".jpg")
+                               ->To(device);
+        frames.push_back(frame);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> criteria{
+            10, 5, 3};
+    t::pipelines::odometry::OdometryLossParams loss(depth_diff);
+
+    // Frame-to-frame tracking with cached pyramids gives the same results as
+    // tracking each pair from scratch.
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        t::pipelines::odometry::RGBDOdometryContext context(
+                intrinsic_t, depth_scale, depth_max, criteria, method, loss);
+        EXPECT_FALSE(context.HasSource());
+        context.SetSource(frames[0]);
+        for (size_t i = 1; i < frames.size(); ++i) {
+            auto expected = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    frames[i - 1], frames[i], intrinsic_t, trans, depth_scale,
+                    depth_max, criteria, method, loss);
+            auto result = context.Compute(frames[i], trans);
+            EXPECT_TRUE(result.transformation_.AllClose(
+                    expected.transformation_));
+            EXPECT_DOUBLE_EQ(result.fitness_, expected.fitness_);
+            EXPECT_DOUBLE_EQ(result.inlier_rmse_, expected.inlier_rmse_);
+        }
+        context.Reset();
+        EXPECT_FALSE(context.HasSource());
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/voxelhashing/Pipeline.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/voxelhashing/Model.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelHashingPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelHashing,
+                         VoxelHashingPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor CreateIntrinsicTensor() {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    return core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+}
+
+static std::vector<std::string> GetFilenames(const std::string& folder,
+                                             const std::string& extension) {
+    std::vector<std::string> filenames;
+    for (int i = 0; i < 5; ++i) {
+        filenames.push_back(fmt::format("{}/RGBD/{}/{:05d}.{}", TEST_DATA_DIR,
+                                        folder, i, extension));
+    }
+    return filenames;
+}
+
+TEST_P(VoxelHashingPermuteDevices, TrackPreprocessedFrameToModel) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    t::pipelines::voxelhashing::Option option;
+    core::Tensor intrinsics = CreateIntrinsicTensor();
+    t::pipelines::voxelhashing::Model model(
+            option.voxel_size, 0.04f, 16, 1000,
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            device);
+
+    std::vector<std::string> depth_filenames = GetFilenames("depth", "png");
+    std::vector<std::string> color_filenames = GetFilenames("color", "jpg");
+    t::geometry::Image depth0 = *t::io::CreateImageFromFile(depth_filenames[0]);
+    t::geometry::Image depth1 = *t::io::CreateImageFromFile(depth_filenames[1]);
+    t::geometry::Image color0 = *t::io::CreateImageFromFile(color_filenames[0]);
+    t::geometry::Image color1 = *t::io::CreateImageFromFile(color_filenames[1]);
+
+    t::pipelines::voxelhashing::Frame input_frame(
+            depth0.GetRows(), depth0.GetCols(), intrinsics, device);
+    t::pipelines::voxelhashing::Frame raycast_frame(
+            depth0.GetRows(), depth0.GetCols(), intrinsics, device);
+    input_frame.SetDataFromImage("depth", depth0);
+    input_frame.SetDataFromImage("color", color0);
+    model.UpdateFramePose(0, model.GetCurrentFramePose());
+    model.Integrate(input_frame, option.depth_scale, option.depth_max);
+    model.SynthesizeModelFrame(raycast_frame, option.depth_scale, 0.1,
+                               option.depth_max);
+
+    input_frame.UpdateDataFromImage("depth", depth1);
+    input_frame.UpdateDataFromImage("color", color1);
+    auto expected = model.TrackFrameToModel(
+            input_frame, raycast_frame, option.depth_scale, option.depth_max,
+            option.depth_diff);
+    model.PreprocessInputFrame(input_frame, option.depth_scale,
+                               option.depth_max, option.depth_diff);
+    auto result = model.TrackPreprocessedFrameToModel(
+            input_frame, raycast_frame, option.depth_scale, option.depth_max,
+            option.depth_diff);
+    EXPECT_TRUE(result.transformation_.AllClose(expected.transformation_));
+    EXPECT_DOUBLE_EQ(result.fitness_, expected.fitness_);
+    EXPECT_DOUBLE_EQ(result.inlier_rmse_, expected.inlier_rmse_);
+}
+
+TEST_P(VoxelHashingPermuteDevices, Pipeline) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    t::pipelines::voxelhashing::Option option;
+    core::Tensor intrinsics = CreateIntrinsicTensor();
+    std::vector<std::string> depth_filenames = GetFilenames("depth", "png");
+    std::vector<std::string> color_filenames = GetFilenames("color", "jpg");
+
+    // Overlapped loading gives the same trajectory as loading in order.
+    std::vector<std::vector<core::Tensor>> trajectories;
+    for (int num_workers : {0, 2}) {
+        t::pipelines::voxelhashing::Model model(
+                option.voxel_size, 0.04f, 16, 1000,
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+                device);
+        t::pipelines::voxelhashing::Pipeline pipeline(model, intrinsics, option,
+                                                      num_workers, 1);
+        pipeline.Run(depth_filenames, color_filenames);
+        trajectories.push_back(pipeline.GetTrajectory());
+
+        auto statistics = pipeline.GetStatistics();
+        EXPECT_EQ(statistics["load"].count_, 5);
+        EXPECT_EQ(statistics["frame"].count_, 5);
+        EXPECT_EQ(statistics["track"].count_, 4);
+        EXPECT_LE(statistics["frame"].min_ms_, statistics["frame"].max_ms_);
+    }
+    ASSERT_EQ(trajectories[0].size(), 5u);
+    ASSERT_EQ(trajectories[1].size(), 5u);
+    for (size_t i = 0; i < trajectories[0].size(); ++i) {
+        EXPECT_TRUE(trajectories[0][i].AllClose(trajectories[1][i]));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Prefetcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Prefetcher, InOrder) {
+    // Later items finish loading first, but must be returned in order.
+    const int64_t num_items = 20;
+    utility::Prefetcher<int64_t> prefetcher(
+            num_items,
+            [](int64_t i) {
+                std::this_thread::sleep_for(
+                        std::chrono::milliseconds((i % 4) * 2));
+                return i * i;
+            },
+            /*num_workers=*/4, /*queue_size=*/6);
+    EXPECT_EQ(prefetcher.GetNumItems(), num_items);
+    for (int64_t i = 0; i < num_items; ++i) {
+        EXPECT_TRUE(prefetcher.HasNext());
+        EXPECT_EQ(prefetcher.Next(), i * i);
+    }
+    EXPECT_FALSE(prefetcher.HasNext());
+    EXPECT_ANY_THROW(prefetcher.Next());
+}
+
+TEST(Prefetcher, NoWorkers) {
+    utility::Prefetcher<int64_t> prefetcher(
+            5, [](int64_t i) { return i + 1; }, /*num_workers=*/0);
+    for (int64_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(prefetcher.Next(), i + 1);
+    }
+    EXPECT_FALSE(prefetcher.HasNext());
+}
+
+TEST(Prefetcher, BoundedQueue) {
+    // Without consumption, workers may load at most queue_size items.
+    std::atomic<int64_t> num_loaded(0);
+    auto wait_until_loaded = [&num_loaded](int64_t count) {
+        for (int k = 0; k < 1000 && num_loaded.load() < count; ++k) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        // Give the workers a chance to load more than they are allowed to.
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    };
+    {
+        utility::Prefetcher<int64_t> prefetcher(
+                100,
+                [&num_loaded](int64_t i) {
+                    ++num_loaded;
+                    return i;
+                },
+                /*num_workers=*/4, /*queue_size=*/3);
+        wait_until_loaded(3);
+        EXPECT_EQ(num_loaded.load(), 3);
+        EXPECT_EQ(prefetcher.Next(), 0);
+        wait_until_loaded(4);
+        EXPECT_EQ(num_loaded.load(), 4);
+    }
+    // Destroying the prefetcher early stops the workers.
+    EXPECT_EQ(num_loaded.load(), 4);
+}
+
+TEST(Prefetcher, Exception) {
+    utility::Prefetcher<int64_t> prefetcher(
+            4,
+            [](int64_t i) -> int64_t {
+                if (i == 2) {
+                    throw std::runtime_error("Failed to load item.");
+                }
+                return i;
+            },
+            /*num_workers=*/2);
+    EXPECT_EQ(prefetcher.Next(), 0);
+    EXPECT_EQ(prefetcher.Next(), 1);
+    EXPECT_THROW(prefetcher.Next(), std::runtime_error);
+    EXPECT_EQ(prefetcher.Next(), 3);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Tracing.h"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using utility::TraceScope;
+using utility::Tracer;
+
+TEST(Tracing, DisabledByDefault) {
+    Tracer& tracer = Tracer::GetInstance();
+    EXPECT_FALSE(tracer.IsEnabled());
+    tracer.Clear();
+    {
+        TraceScope scope("test", "Disabled");
+        EXPECT_FALSE(scope.IsActive());
+    }
+    EXPECT_TRUE(tracer.GetEvents().empty());
+}
+
+TEST(Tracing, RecordNestedScopes) {
+    Tracer& tracer = Tracer::GetInstance();
+    tracer.Clear();
+    tracer.Enable();
+    {
+        TraceScope outer("test", "Outer");
+        EXPECT_TRUE(outer.IsActive());
+        for (int i = 0; i < 3; ++i) {
+            TraceScope inner("test", "Inner");
+            inner.SetDetails("CPU:0", 64, 16);
+        }
+    }
+    tracer.Disable();
+    {
+        TraceScope ignored("test", "Ignored");
+        EXPECT_FALSE(ignored.IsActive());
+    }
+
+    std::vector<utility::TraceEvent> events = tracer.GetEvents();
+    ASSERT_EQ(events.size(), 4);
+    // Events are sorted by start time, so the outer scope comes first.
+    EXPECT_STREQ(events[0].name_, "Outer");
+    EXPECT_EQ(events[0].bytes_, -1);
+    EXPECT_EQ(events[0].num_elements_, -1);
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_STREQ(events[i].category_, "test");
+        EXPECT_STREQ(events[i].name_, "Inner");
+        EXPECT_EQ(events[i].device_, "CPU:0");
+        EXPECT_EQ(events[i].bytes_, 64);
+        EXPECT_EQ(events[i].num_elements_, 16);
+        EXPECT_EQ(events[i].thread_id_, events[0].thread_id_);
+        EXPECT_GE(events[i].start_us_, events[0].start_us_);
+        EXPECT_LE(events[i].start_us_ + events[i].duration_us_,
+                  events[0].start_us_ + events[0].duration_us_);
+    }
+
+    std::vector<utility::TraceStatistics> stats = tracer.GetStatistics();
+    ASSERT_EQ(stats.size(), 2);
+    // Sorted by total time: the outer scope includes the inner ones.
+    EXPECT_EQ(stats[0].name_, "Outer");
+    EXPECT_EQ(stats[0].count_, 1);
+    EXPECT_EQ(stats[1].name_, "Inner");
+    EXPECT_EQ(stats[1].count_, 3);
+    EXPECT_EQ(stats[1].bytes_, 3 * 64);
+    EXPECT_EQ(stats[1].num_elements_, 3 * 16);
+    EXPECT_LE(stats[1].min_ms_, stats[1].MeanMs());
+    EXPECT_LE(stats[1].MeanMs(), stats[1].max_ms_);
+    EXPECT_NE(tracer.GetStatisticsString().find("Inner"), std::string::npos);
+
+    tracer.Clear();
+    EXPECT_TRUE(tracer.GetEvents().empty());
+}
+
+TEST(Tracing, SynchronizeDevice) {
+    Tracer& tracer = Tracer::GetInstance();
+    tracer.Clear();
+    std::vector<std::string> synchronized;
+    auto previous = tracer.SetDeviceSynchronizer(
+            [&synchronized](const std::string& device) {
+                synchronized.push_back(device);
+            });
+    tracer.Enable();
+    {
+        TraceScope scope("test", "NoDevice");
+    }
+    EXPECT_TRUE(synchronized.empty());
+    {
+        // Once before the timed work starts, once when the scope ends.
+        TraceScope scope("test", "Device");
+        scope.SetDetails("CUDA:0", 64, 16);
+    }
+    tracer.Disable();
+    tracer.SetDeviceSynchronizer(previous);
+
+    EXPECT_EQ(synchronized,
+              std::vector<std::string>({"CUDA:0", "CUDA:0"}));
+    tracer.Clear();
+}
+
+TEST(Tracing, MultipleThreads) {
+    Tracer& tracer = Tracer::GetInstance();
+    tracer.Clear();
+    tracer.Enable();
+    const int num_threads = 4;
+    const int num_scopes = 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < num_scopes; ++i) {
+                TraceScope scope("test", "Worker");
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    tracer.Disable();
+
+    std::vector<utility::TraceEvent> events = tracer.GetEvents();
+    EXPECT_EQ(events.size(), num_threads * num_scopes);
+    std::vector<utility::TraceStatistics> stats = tracer.GetStatistics();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].count_, num_threads * num_scopes);
+    tracer.Clear();
+}
+
+TEST(Tracing, WriteChromeTrace) {
+    Tracer& tracer = Tracer::GetInstance();
+    tracer.Clear();
+    tracer.Enable();
+    {
+        TraceScope scope("test", "Quoted \"name\"");
+        scope.SetDetails("CPU:0", 8, 2);
+    }
+    tracer.Disable();
+
+    const std::string filename = "tmp_trace.json";
+    ASSERT_TRUE(tracer.WriteChromeTrace(filename));
+    std::ifstream file(filename);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    file.close();
+    const std::string json = ss.str();
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("Quoted \\\"name\\\""), std::string::npos);
+    EXPECT_NE(json.find("\"bytes\":8"), std::string::npos);
+    utility::filesystem::RemoveFile(filename);
+    tracer.Clear();
+}
+
+#ifdef BUILD_TRACING
+TEST(Tracing, CoreInstrumentation) {
+    Tracer& tracer = Tracer::GetInstance();
+    tracer.Clear();
+    tracer.Enable();
+    core::Tensor a = core::Tensor::Ones({100}, core::Float32);
+    core::Tensor b = a + a;
+    tracer.Disable();
+
+    bool found = false;
+    for (const utility::TraceEvent& event : tracer.GetEvents()) {
+        if (std::string(event.name_) == "BinaryEW") {
+            found = true;
+            EXPECT_STREQ(event.category_, "core");
+            EXPECT_EQ(event.device_, "CPU:0");
+            EXPECT_EQ(event.num_elements_, 100);
+            EXPECT_EQ(event.bytes_, 3 * 100 * 4);
+        }
+    }
+    EXPECT_TRUE(found);
+    tracer.Clear();
+}
+#endif
+
+}  // namespace tests
+}  // namespace open3d
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -544,6 +545,18 @@ private:
                 t::io::ReadPointCloud(path, pointcloud_local,
                                       {"auto", false, false, true});
 
+                // UInt8 colors (e.g. from PCD files) are scaled to [0, 1].
+                if (pointcloud_local.HasPointColors() &&
+                    pointcloud_local.GetPointColors().GetDtype() ==
+                            core::Dtype::UInt8) {
+                    pointcloud_local.SetPointColors(
+                            pointcloud_local.GetPointColors()
+                                    .To(dtype_)
+                                    .Div(static_cast<double>(
+                                            std::numeric_limits<
+                                                    uint8_t>::max())));
+                }
+
                 // registration module.
                 for (std::string attr : {"points", "colors", "normals"}) {
                     if (pointcloud_local.HasPointAttr(attr)) {
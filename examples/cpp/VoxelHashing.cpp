@@ -51,7 +51,6 @@ void PrintHelp() {
 int main(int argc, char* argv[]) {
     using namespace open3d;
     using core::Tensor;
-    using t::geometry::Image;
     using t::geometry::PointCloud;
 
     utility::SetVerbosityLevel(utility::VerbosityLevel::Info);
@@ -132,56 +131,17 @@ int main(int argc, char* argv[]) {
                                             block_resolution, block_count,
                                             T_frame_to_model, device);
 
-    // Initialize frame
-    Image ref_depth = *t::io::CreateImageFromFile(depth_filenames[0]);
-    t::pipelines::voxelhashing::Frame input_frame(
-            ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
-    t::pipelines::voxelhashing::Frame raycast_frame(
-            ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
-
-    // Iterate over frames
-    for (size_t i = 0; i < iterations; ++i) {
-        utility::LogInfo("Processing {}/{}...", i, iterations);
-        // Load image into frame
-        Image input_depth = *t::io::CreateImageFromFile(depth_filenames[i]);
-        Image input_color = *t::io::CreateImageFromFile(color_filenames[i]);
-        input_frame.SetDataFromImage("depth", input_depth);
-        input_frame.SetDataFromImage("color", input_color);
-
-        bool tracking_success = true;
-        if (i > 0) {
-            auto result =
-                    model.TrackFrameToModel(input_frame, raycast_frame,
-                                            depth_scale, depth_max, depth_diff);
-
-            core::Tensor translation =
-                    result.transformation_.Slice(0, 0, 3).Slice(1, 3, 4);
-            double translation_norm = std::sqrt(
-                    (translation * translation).Sum({0, 1}).Item<double>());
-
-            // TODO(wei): more systematical failure check.
-            // If the overlap is too small or translation is too high between
-            // two consecutive frames, it is likely that the tracking failed.
-            if (result.fitness_ >= 0.1 && translation_norm < 0.15) {
-                T_frame_to_model =
-                        T_frame_to_model.Matmul(result.transformation_);
-            } else {  // Don't update
-                tracking_success = false;
-                utility::LogWarning(
-                        "Tracking failed for frame {}, fitness: {:.3f}, "
-                        "translation: {:.3f}. Using previous frame's "
-                        "pose.",
-                        i, result.fitness_, translation_norm);
-            }
-        }
-
-        // Integrate
-        model.UpdateFramePose(i, T_frame_to_model);
-        if (tracking_success) {
-            model.Integrate(input_frame, depth_scale, depth_max);
-        }
-        model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1, depth_max);
-    }
+    // Frames are decoded and preprocessed in the background while the
+    // previous frame is tracked and integrated.
+    t::pipelines::voxelhashing::Option option;
+    option.depth_scale = depth_scale;
+    option.depth_max = depth_max;
+    option.depth_diff = depth_diff;
+    depth_filenames.resize(iterations);
+    color_filenames.resize(iterations);
+    t::pipelines::voxelhashing::Pipeline pipeline(model, intrinsic_t, option);
+    pipeline.Run(depth_filenames, color_filenames);
+    pipeline.LogStatistics();
 
     if (utility::ProgramOptionExists(argc, argv, "--pointcloud")) {
         std::string filename = utility::GetProgramOptionAsString(